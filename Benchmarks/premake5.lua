@@ -0,0 +1,44 @@
+outputdir = "%{cfg.buildcfg}-%{cfg.platform}-%{cfg.system}-%{cfg.architecture}"
+
+project "Benchmarks"
+	location "."
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+
+	targetdir ("../bin/" .. outputdir .."/%{prj.name}")
+	objdir ("../bin-int/" .. outputdir .."/%{prj.name}")
+
+	files
+	{
+		"src/**.h",
+		"src/**.cpp",
+		"src/**.hpp",
+	}
+
+	includedirs
+	{
+		"../Ohm/src",
+		"src"
+	}
+
+	-- ThreadPool starts std::threads, glibc before 2.34 needs libpthread for them.
+	filter "system:linux"
+		links { "pthread" }
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines { "OHM_DEBUG" }
+		runtime "Debug"
+		symbols "on"
+
+	filter "configurations:Release"
+		runtime "Release"
+		optimize "on"
+
+	filter "configurations:Dist"
+		defines { "OHM_DIST", "NDEBUG" }
+		runtime "Release"
+		optimize "on"
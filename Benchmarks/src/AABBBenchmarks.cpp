@@ -0,0 +1,104 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Geometry/AABBBatch.hpp>
+
+namespace
+{
+	template<typename T>
+	std::vector<Vector3<T>> RandomPoints(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 3, static_cast<T>(-100), static_cast<T>(100), aSeed);
+
+		std::vector<Vector3<T>> points(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			points[i] = Vector3<T>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+		}
+		return points;
+	}
+
+	template<typename T>
+	std::vector<AABB<T>> RandomBoxes(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<Vector3<T>> centers = RandomPoints<T>(aCount, aSeed);
+		const std::vector<T> extents = Benchmark::RandomValues<T>(aCount, static_cast<T>(0.1), static_cast<T>(10), aSeed + 1);
+
+		std::vector<AABB<T>> boxes(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			boxes[i] = AABB<T>::FromCenterExtents(centers[i], Vector3<T>(extents[i]));
+		}
+		return boxes;
+	}
+
+	template<typename T>
+	Matrix4x4<T> TestTransform()
+	{
+		Matrix4x4<T> transform = Matrix4x4<T>::CreateRotation(static_cast<T>(0.3), static_cast<T>(-1.1), static_cast<T>(2));
+		transform(4) = Vector4<T>(static_cast<T>(10), static_cast<T>(-20), static_cast<T>(5), static_cast<T>(1));
+		return transform;
+	}
+
+	// Transforms all eight corners, the naive alternative to Arvo's method.
+	template<typename T>
+	AABB<T> TransformCorners(const AABB<T>& aBox, const Matrix4x4<T>& aMatrix)
+	{
+		AABB<T> result;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			const Vector4<T> point((corner & 1) ? aBox.max.x : aBox.min.x, (corner & 2) ? aBox.max.y : aBox.min.y, (corner & 4) ? aBox.max.z : aBox.min.z, static_cast<T>(1));
+			const Vector4<T> transformed = point * aMatrix;
+			result.Merge(Vector3<T>(transformed.x, transformed.y, transformed.z));
+		}
+		return result;
+	}
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("AABB<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+		const Matrix4x4<T> transform = TestTransform<T>();
+
+		const std::vector<AABB<T>> boxes = RandomBoxes<T>(Benchmark::SampleCount, 1);
+		aRegistry.AddSingle(prefix + "Transform", [boxes, transform](size_t i) { return boxes[i].Transform(transform); });
+		aRegistry.AddSingle(prefix + "TransformCorners", [boxes, transform](size_t i) { return TransformCorners(boxes[i], transform); });
+
+		const std::vector<Vector3<T>> points = RandomPoints<T>(Benchmark::BatchSize, 2);
+		aRegistry.Add(prefix + "ComputeBounds" + suffix, Benchmark::BatchSize, [points](size_t aIterations)
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Benchmark::DoNotOptimize(ComputeBounds(points.data(), points.size()));
+			}
+		});
+
+		const std::vector<AABB<T>> batch = RandomBoxes<T>(Benchmark::BatchSize, 3);
+		aRegistry.Add(prefix + "TransformArray" + suffix, Benchmark::BatchSize, [batch, transform, out = batch](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (size_t j = 0; j < batch.size(); j++)
+				{
+					out[j] = batch[j].Transform(transform);
+				}
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "TransformSoA" + suffix, Benchmark::BatchSize, [soa = AABBSoA<T>(batch.data(), batch.size()), transform, out = AABBSoA<T>(batch.size())](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				AABBSoA<T>::Transform(soa, transform, out);
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterAABBBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
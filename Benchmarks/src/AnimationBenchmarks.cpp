@@ -0,0 +1,104 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Animation/AnimationClip.hpp>
+
+#include <algorithm>
+
+namespace
+{
+	constexpr size_t BoneCount = 10000;
+	constexpr size_t KeyCount = 61;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("AnimationClip<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(BoneCount);
+
+		// Two seconds at 30 keys per second, every other bone with a constant scale.
+		const std::vector<T> values = Benchmark::RandomValues<T>(BoneCount * KeyCount * 10, static_cast<T>(-1), static_cast<T>(1), 1);
+		std::vector<AnimationTrack<T>> tracks(BoneCount);
+		for (size_t bone = 0; bone < BoneCount; bone++)
+		{
+			AnimationTrack<T>& track = tracks[bone];
+			const size_t scaleKeys = bone % 2 == 0 ? 1 : KeyCount;
+			for (size_t key = 0; key < KeyCount; key++)
+			{
+				const T* value = &values[(bone * KeyCount + key) * 10];
+				const T time = static_cast<T>(key) / static_cast<T>(30);
+				track.translationTimes.push_back(time);
+				track.translations.push_back(Vector3<T>(value[0], value[1], value[2]));
+				track.rotationTimes.push_back(time);
+				track.rotations.push_back(Quaternion<T>(value[3], value[4], value[5], value[6]).GetNormalized());
+				if (key < scaleKeys)
+				{
+					track.scaleTimes.push_back(time);
+					track.scales.push_back(Vector3<T>(1 + value[7] * static_cast<T>(0.1), 1 + value[8] * static_cast<T>(0.1), 1 + value[9] * static_cast<T>(0.1)));
+				}
+			}
+		}
+		const AnimationClip<T> clip(tracks.data(), BoneCount);
+		const T duration = clip.GetDuration();
+
+		struct Pose
+		{
+			std::vector<Vector3<T>> translations = std::vector<Vector3<T>>(BoneCount);
+			std::vector<Quaternion<T>> rotations = std::vector<Quaternion<T>>(BoneCount);
+			std::vector<Vector3<T>> scales = std::vector<Vector3<T>>(BoneCount);
+		};
+
+		// Whole skeleton per operation, throughput in bones. Playback advances one 60 Hz frame per sample and loops.
+		aRegistry.Add(prefix + "SampleCursor" + suffix, BoneCount, [clip, duration, cursor = AnimationCursor(), pose = Pose()](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				const T time = std::fmod(static_cast<T>(i) / static_cast<T>(60), duration);
+				clip.Sample(time, cursor, pose.translations.data(), pose.rotations.data(), pose.scales.data());
+				Benchmark::DoNotOptimize(pose.rotations.data());
+			}
+		});
+		aRegistry.Add(prefix + "SampleSearch" + suffix, BoneCount, [clip, duration, pose = Pose()](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				const T time = std::fmod(static_cast<T>(i) / static_cast<T>(60), duration);
+				clip.Sample(time, pose.translations.data(), pose.rotations.data(), pose.scales.data());
+				Benchmark::DoNotOptimize(pose.rotations.data());
+			}
+		});
+
+		// Reference: the uncompressed keys with a binary search per key and a slerp per bone.
+		aRegistry.Add(prefix + "ReferenceSearchSlerp" + suffix, BoneCount, [tracks, duration, pose = Pose()](size_t aIterations) mutable
+		{
+			const auto find = [](const std::vector<T>& aTimes, T aTime, T& aOutFactor)
+			{
+				const size_t next = std::upper_bound(aTimes.begin(), aTimes.end(), aTime) - aTimes.begin();
+				const size_t key = next == 0 ? 0 : next - 1;
+				aOutFactor = next == 0 || next == aTimes.size() ? static_cast<T>(0) : (aTime - aTimes[key]) / (aTimes[next] - aTimes[key]);
+				return key;
+			};
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				const T time = std::fmod(static_cast<T>(i) / static_cast<T>(60), duration);
+				for (size_t bone = 0; bone < BoneCount; bone++)
+				{
+					const AnimationTrack<T>& track = tracks[bone];
+					T factor;
+					size_t key = find(track.translationTimes, time, factor);
+					pose.translations[bone] = factor > 0 ? track.translations[key] + (track.translations[key + 1] - track.translations[key]) * factor : track.translations[key];
+					key = find(track.rotationTimes, time, factor);
+					pose.rotations[bone] = factor > 0 ? Quaternion<T>::Slerp(track.rotations[key], track.rotations[key + 1], factor) : track.rotations[key];
+					key = find(track.scaleTimes, time, factor);
+					pose.scales[bone] = factor > 0 ? track.scales[key] + (track.scales[key + 1] - track.scales[key]) * factor : track.scales[key];
+				}
+				Benchmark::DoNotOptimize(pose.rotations.data());
+			}
+		});
+	}
+}
+
+void RegisterAnimationBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
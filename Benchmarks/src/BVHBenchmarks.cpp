@@ -0,0 +1,107 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Geometry/BVH.hpp>
+
+namespace
+{
+	constexpr size_t PrimitiveCount = 100000;
+	constexpr size_t QueryCount = 1000;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("BVH<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(PrimitiveCount);
+
+		const std::vector<T> positions = Benchmark::RandomValues<T>(PrimitiveCount * 3, static_cast<T>(-500), static_cast<T>(500), 1);
+		const std::vector<T> sizes = Benchmark::RandomValues<T>(PrimitiveCount * 3, static_cast<T>(0.5), static_cast<T>(5), 2);
+		std::vector<AABB<T>> boxes(PrimitiveCount);
+		for (size_t i = 0; i < PrimitiveCount; i++)
+		{
+			const Vector3<T> center(positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+			boxes[i] = AABB<T>::FromCenterExtents(center, Vector3<T>(sizes[i * 3 + 0], sizes[i * 3 + 1], sizes[i * 3 + 2]));
+		}
+
+		// Build throughput in primitives.
+		for (const bool parallel : { false, true })
+		{
+			BVHBuildOptions options;
+			options.pool = parallel ? &Benchmark::GetThreadPool() : nullptr;
+			aRegistry.Add(prefix + (parallel ? "BuildParallel" : "Build") + suffix, PrimitiveCount, [boxes, options](size_t aIterations)
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					BVH<T> bvh(boxes.data(), boxes.size(), options);
+					Benchmark::DoNotOptimize(bvh.GetNodes().data());
+				}
+			});
+		}
+
+		aRegistry.Add(prefix + "Refit" + suffix, PrimitiveCount, [boxes, bvh = BVH<T>(boxes.data(), boxes.size())](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				bvh.Refit(boxes.data());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		// Query throughput in queries, rays from random points towards the middle of the scene.
+		const std::vector<T> origins = Benchmark::RandomValues<T>(QueryCount * 3, static_cast<T>(-600), static_cast<T>(600), 3);
+		const std::vector<T> targets = Benchmark::RandomValues<T>(QueryCount * 3, static_cast<T>(-100), static_cast<T>(100), 4);
+		std::vector<Ray<T>> rays(QueryCount);
+		std::vector<AABB<T>> regions(QueryCount);
+		std::vector<Frustum<T>> frustums(QueryCount);
+		for (size_t i = 0; i < QueryCount; i++)
+		{
+			const Vector3<T> origin(origins[i * 3 + 0], origins[i * 3 + 1], origins[i * 3 + 2]);
+			const Vector3<T> target(targets[i * 3 + 0], targets[i * 3 + 1], targets[i * 3 + 2]);
+			rays[i] = Ray<T>(origin, (target - origin).GetNormalized());
+			regions[i] = AABB<T>::FromCenterExtents(target, Vector3<T>(static_cast<T>(20)));
+
+			const Matrix4x4<T> view = Matrix4x4<T>::GetFastInverse(Matrix4x4<T>::CreateLookAt(origin, target, Vector3<T>(0, 1, 0)));
+			frustums[i] = Frustum<T>(view * Matrix4x4<T>::CreatePerspective(static_cast<T>(0.8), static_cast<T>(1), static_cast<T>(0.1), static_cast<T>(300)));
+		}
+
+		const BVH<T> bvh(boxes.data(), boxes.size());
+		aRegistry.AddSingle(prefix + "Raycast" + suffix, [bvh, rays](size_t i)
+		{
+			T distance = std::numeric_limits<T>::max();
+			return bvh.Raycast(rays[i % QueryCount], distance);
+		});
+		aRegistry.AddSingle(prefix + "QueryOverlap" + suffix, [bvh, regions](size_t i)
+		{
+			size_t count = 0;
+			bvh.QueryOverlap(regions[i % QueryCount], [&](uint32_t) { count++; });
+			return count;
+		});
+		aRegistry.AddSingle(prefix + "QueryFrustum" + suffix, [bvh, frustums](size_t i)
+		{
+			size_t count = 0;
+			bvh.QueryFrustum(frustums[i % QueryCount], [&](uint32_t) { count++; });
+			return count;
+		});
+
+		// Brute force reference for the ray query.
+		aRegistry.AddSingle(prefix + "RaycastLinear" + suffix, [boxes, rays](size_t i)
+		{
+			const Ray<T>& ray = rays[i % QueryCount];
+			T closest = std::numeric_limits<T>::max();
+			for (const AABB<T>& box : boxes)
+			{
+				T distance = 0;
+				if (ray.Intersects(box, distance) && distance < closest)
+				{
+					closest = distance;
+				}
+			}
+			return closest;
+		});
+	}
+}
+
+void RegisterBVHBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
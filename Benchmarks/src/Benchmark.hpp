@@ -0,0 +1,205 @@
+#pragma once
+
+#include <Ohm/Utility/ThreadPool.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Benchmark
+{
+	// Keeps the compiler from discarding a value that is only computed to be measured.
+	template<typename T>
+	inline void DoNotOptimize(const T& aValue)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		const volatile char* sink = reinterpret_cast<const volatile char*>(&aValue);
+		(void)*sink;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(aValue) : "memory");
+#endif
+	}
+
+	inline void ClobberMemory()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+
+	// Inputs for single value benchmarks are cycled through so that results cannot be constant folded.
+	constexpr size_t SampleCount = 256;
+	constexpr size_t BatchSize = 4096;
+
+	template<typename T> inline const char* TypeName();
+	template<> inline const char* TypeName<float>() { return "float"; }
+	template<> inline const char* TypeName<double>() { return "double"; }
+
+	// Pools for the threaded benchmarks, one per worker count, created on first use and kept until exit.
+	inline ThreadPool& GetThreadPool(size_t aWorkerCount = ThreadPool::DefaultWorkerCount())
+	{
+		static std::vector<std::unique_ptr<ThreadPool>> pools;
+		for (const std::unique_ptr<ThreadPool>& pool : pools)
+		{
+			if (pool->GetWorkerCount() == aWorkerCount)
+			{
+				return *pool;
+			}
+		}
+		pools.push_back(std::make_unique<ThreadPool>(aWorkerCount));
+		return *pools.back();
+	}
+
+	// Worker counts for scaling curves: 0, 1, 3, 7, ... up to one worker per hardware thread besides the caller.
+	inline std::vector<size_t> ScalingWorkerCounts()
+	{
+		std::vector<size_t> counts{ 0 };
+		const size_t maximum = ThreadPool::DefaultWorkerCount() > 1 ? ThreadPool::DefaultWorkerCount() : 1;
+		for (size_t threads = 2; threads - 1 <= maximum; threads *= 2)
+		{
+			counts.push_back(threads - 1);
+		}
+		if (counts.back() != maximum)
+		{
+			counts.push_back(maximum);
+		}
+		return counts;
+	}
+
+	// Types other than float and double (Fixed) are drawn as double and converted.
+	template<typename T>
+	inline std::vector<T> RandomValues(size_t aCount, T aMin, T aMax, unsigned aSeed = 1337)
+	{
+		using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+		std::mt19937 generator(aSeed);
+		std::uniform_real_distribution<Real> distribution(static_cast<Real>(aMin), static_cast<Real>(aMax));
+
+		std::vector<T> values(aCount);
+		for (T& value : values)
+		{
+			value = static_cast<T>(distribution(generator));
+		}
+		return values;
+	}
+
+	// A benchmark runs its body aIterations times, each iteration performs myItemsPerIteration operations.
+	struct Entry
+	{
+		std::string myName;
+		size_t myItemsPerIteration;
+		std::function<void(size_t aIterations)> myBody;
+	};
+
+	struct Result
+	{
+		std::string myName;
+		size_t myIterations;
+		size_t myItemsPerIteration;
+		double myNanosecondsPerOperation;
+		double myOperationsPerSecond;
+	};
+
+	struct Options
+	{
+		std::string myFilter;
+		std::string myFormat = "json";
+		double myMinTime = 0.1;
+		size_t myRepetitions = 3;
+	};
+
+	class Registry
+	{
+	public:
+		void Add(std::string aName, size_t aItemsPerIteration, std::function<void(size_t)> aBody)
+		{
+			myEntries.push_back({ std::move(aName), aItemsPerIteration, std::move(aBody) });
+		}
+
+		// Registers a benchmark timing a single call of aFunction(index) per operation.
+		template<typename Function>
+		void AddSingle(std::string aName, Function aFunction)
+		{
+			Add(std::move(aName), 1, [aFunction](size_t aIterations)
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					DoNotOptimize(aFunction(i & (SampleCount - 1)));
+				}
+			});
+		}
+
+		const std::vector<Entry>& GetEntries() const { return myEntries; }
+
+	private:
+		std::vector<Entry> myEntries;
+	};
+
+	// Doubles the iteration count until a run takes at least aMinTime seconds, then keeps the fastest of the repetitions.
+	inline Result Run(const Entry& aEntry, const Options& aOptions)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		const auto time = [&](size_t aIterations)
+		{
+			const auto start = Clock::now();
+			aEntry.myBody(aIterations);
+			ClobberMemory();
+			return std::chrono::duration<double>(Clock::now() - start).count();
+		};
+
+		size_t iterations = 1;
+		double elapsed = time(iterations);
+		while (elapsed < aOptions.myMinTime && iterations < (size_t(1) << 40))
+		{
+			const double scale = elapsed > 0.0 ? aOptions.myMinTime / elapsed * 1.4 : 10.0;
+			iterations = static_cast<size_t>(static_cast<double>(iterations) * (scale < 10.0 ? (scale > 2.0 ? scale : 2.0) : 10.0));
+			elapsed = time(iterations);
+		}
+
+		for (size_t i = 1; i < aOptions.myRepetitions; i++)
+		{
+			const double repetition = time(iterations);
+			if (repetition < elapsed)
+			{
+				elapsed = repetition;
+			}
+		}
+
+		const double operations = static_cast<double>(iterations) * static_cast<double>(aEntry.myItemsPerIteration);
+
+		Result result;
+		result.myName = aEntry.myName;
+		result.myIterations = iterations;
+		result.myItemsPerIteration = aEntry.myItemsPerIteration;
+		result.myNanosecondsPerOperation = elapsed * 1e9 / operations;
+		result.myOperationsPerSecond = operations / elapsed;
+		return result;
+	}
+}
+
+void RegisterVectorBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterMatrixBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterQuaternionBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterFixedBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterCompressionBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterDispatchBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterAABBBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterFrustumBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterRayBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterBVHBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterTransformHierarchyBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterSkinningBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterAnimationBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterMathBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterParallelBenchmarks(Benchmark::Registry& aRegistry);
+void RegisterMemoryBenchmarks(Benchmark::Registry& aRegistry);
@@ -0,0 +1,78 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Quaternion/PackedQuaternion.hpp>
+#include <Ohm/Vector/OctahedralNormal.hpp>
+#include <Ohm/Vector/VectorHalf.hpp>
+
+namespace
+{
+	std::vector<Vector3<float>> RandomDirections(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<float> values = Benchmark::RandomValues<float>(aCount * 3, -1.f, 1.f, aSeed);
+
+		std::vector<Vector3<float>> directions(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			directions[i] = Vector3<float>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2] + 0.01f).GetNormalized();
+		}
+		return directions;
+	}
+
+	std::vector<Quaternion<float>> RandomRotations(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<float> values = Benchmark::RandomValues<float>(aCount * 4, -1.f, 1.f, aSeed);
+
+		std::vector<Quaternion<float>> rotations(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			rotations[i] = Quaternion<float>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3] + 0.01f).GetNormalized();
+		}
+		return rotations;
+	}
+
+	// Runs aFunction(aIn.data(), aOut.data(), size) once per iteration.
+	template<typename In, typename Out, typename F>
+	void AddStream(Benchmark::Registry& aRegistry, const std::string& aName, std::vector<In> aIn, F aFunction)
+	{
+		aRegistry.Add(aName + "/" + std::to_string(Benchmark::BatchSize), Benchmark::BatchSize, [in = std::move(aIn), out = std::vector<Out>(Benchmark::BatchSize), aFunction](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				aFunction(in.data(), out.data(), in.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterCompressionBenchmarks(Benchmark::Registry& aRegistry)
+{
+	const std::vector<Vector3<float>> directions = RandomDirections(Benchmark::BatchSize, 1);
+	const std::vector<Quaternion<float>> rotations = RandomRotations(Benchmark::BatchSize, 2);
+
+	std::vector<Vector3Half> halves(Benchmark::BatchSize);
+	std::vector<OctahedralNormal> normals(Benchmark::BatchSize);
+	std::vector<PackedQuaternion> packed(Benchmark::BatchSize);
+	PackVectors(directions.data(), halves.data(), halves.size());
+	EncodeNormals(directions.data(), normals.data(), normals.size());
+	PackQuaternions(rotations.data(), packed.data(), packed.size());
+
+	AddStream<Vector3<float>, Vector3Half>(aRegistry, "Compression/Vector3Half/Pack", directions,
+		[](const Vector3<float>* aIn, Vector3Half* aOut, size_t aCount) { PackVectors(aIn, aOut, aCount); });
+	AddStream<Vector3Half, Vector3<float>>(aRegistry, "Compression/Vector3Half/Unpack", halves,
+		[](const Vector3Half* aIn, Vector3<float>* aOut, size_t aCount) { UnpackVectors(aIn, aOut, aCount); });
+	AddStream<Vector3<float>, OctahedralNormal>(aRegistry, "Compression/OctahedralNormal/Encode", directions,
+		[](const Vector3<float>* aIn, OctahedralNormal* aOut, size_t aCount) { EncodeNormals(aIn, aOut, aCount); });
+	AddStream<OctahedralNormal, Vector3<float>>(aRegistry, "Compression/OctahedralNormal/Decode", normals,
+		[](const OctahedralNormal* aIn, Vector3<float>* aOut, size_t aCount) { DecodeNormals(aIn, aOut, aCount); });
+	AddStream<Quaternion<float>, PackedQuaternion>(aRegistry, "Compression/PackedQuaternion/Pack", rotations,
+		[](const Quaternion<float>* aIn, PackedQuaternion* aOut, size_t aCount) { PackQuaternions(aIn, aOut, aCount); });
+	AddStream<PackedQuaternion, Quaternion<float>>(aRegistry, "Compression/PackedQuaternion/Unpack", packed,
+		[](const PackedQuaternion* aIn, Quaternion<float>* aOut, size_t aCount) { UnpackQuaternions(aIn, aOut, aCount); });
+
+	// Per element reference for the SIMD paths above.
+	AddStream<Vector3<float>, OctahedralNormal>(aRegistry, "Compression/OctahedralNormal/EncodeScalar", directions,
+		[](const Vector3<float>* aIn, OctahedralNormal* aOut, size_t aCount) { for (size_t i = 0; i < aCount; i++) { aOut[i] = OctahedralNormal(aIn[i]); } });
+	AddStream<PackedQuaternion, Quaternion<float>>(aRegistry, "Compression/PackedQuaternion/UnpackScalar", packed,
+		[](const PackedQuaternion* aIn, Quaternion<float>* aOut, size_t aCount) { for (size_t i = 0; i < aCount; i++) { aOut[i] = aIn[i].ToQuaternion(); } });
+}
@@ -0,0 +1,57 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Utility/Dispatch.hpp>
+
+// Runtime dispatched kernels, run with --instruction-set to compare the code paths in one binary.
+void RegisterDispatchBenchmarks(Benchmark::Registry& aRegistry)
+{
+	const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+	const std::vector<float> values = Benchmark::RandomValues<float>(Benchmark::BatchSize * 3, -10.f, 10.f, 11);
+
+	std::vector<Vector3<float>> points(Benchmark::BatchSize);
+	std::vector<Matrix4x4<float>> matrices(Benchmark::BatchSize);
+	for (size_t i = 0; i < Benchmark::BatchSize; i++)
+	{
+		points[i] = Vector3<float>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+		matrices[i] = Matrix4x4<float>::CreateRotation(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+	}
+
+	const Matrix4x4<float> transform = matrices[0] * Matrix4x4<float>::CreateTranslation(points[1]);
+	const Vector3SoA<float> vectors(points.data(), points.size());
+
+	aRegistry.Add("Dispatch/MultiplyMatrices" + suffix, Benchmark::BatchSize, [matrices, out = matrices](size_t aIterations) mutable
+	{
+		for (size_t i = 0; i < aIterations; i++)
+		{
+			Ohm::Dispatch::MultiplyMatrices(matrices.data(), matrices.data(), out.data(), matrices.size());
+			Benchmark::ClobberMemory();
+		}
+	});
+
+	aRegistry.Add("Dispatch/TransformPoints" + suffix, Benchmark::BatchSize, [transform, points, out = points](size_t aIterations) mutable
+	{
+		for (size_t i = 0; i < aIterations; i++)
+		{
+			Ohm::Dispatch::TransformPoints(transform, points.data(), out.data(), points.size());
+			Benchmark::ClobberMemory();
+		}
+	});
+
+	aRegistry.Add("Dispatch/TransformPointsProjective" + suffix, Benchmark::BatchSize, [transform, points, out = points](size_t aIterations) mutable
+	{
+		for (size_t i = 0; i < aIterations; i++)
+		{
+			Ohm::Dispatch::TransformPointsProjective(transform, points.data(), out.data(), points.size());
+			Benchmark::ClobberMemory();
+		}
+	});
+
+	aRegistry.Add("Dispatch/Normalize" + suffix, Benchmark::BatchSize, [vectors, out = Vector3SoA<float>(Benchmark::BatchSize)](size_t aIterations) mutable
+	{
+		for (size_t i = 0; i < aIterations; i++)
+		{
+			Ohm::Dispatch::Normalize(vectors, out);
+			Benchmark::ClobberMemory();
+		}
+	});
+}
@@ -0,0 +1,46 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Fixed/Fixed.hpp>
+#include <Ohm/Matrix/Matrix3x3.hpp>
+#include <Ohm/Vector/Vector3.hpp>
+
+namespace Benchmark
+{
+	template<> inline const char* TypeName<Fixed16>() { return "Fixed16"; }
+	template<> inline const char* TypeName<Fixed32>() { return "Fixed32"; }
+}
+
+namespace
+{
+	// The same kernels for float, double and fixed point so the deterministic path can be compared against hardware floats.
+	template<typename T>
+	void RegisterScalar(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Deterministic<") + Benchmark::TypeName<T>() + ">/";
+
+		const std::vector<T> a = Benchmark::RandomValues<T>(Benchmark::SampleCount * 3, static_cast<T>(-10), static_cast<T>(10), 1);
+		const std::vector<T> b = Benchmark::RandomValues<T>(Benchmark::SampleCount * 3, static_cast<T>(1), static_cast<T>(10), 2);
+
+		std::vector<Vector3<T>> vectors(Benchmark::SampleCount);
+		for (size_t i = 0; i < Benchmark::SampleCount; i++)
+		{
+			vectors[i] = Vector3<T>(a[i * 3 + 0], a[i * 3 + 1], a[i * 3 + 2]);
+		}
+
+		aRegistry.AddSingle(prefix + "Multiply", [a, b](size_t i) { return a[i] * b[i]; });
+		aRegistry.AddSingle(prefix + "Divide", [a, b](size_t i) { return a[i] / b[i]; });
+		aRegistry.AddSingle(prefix + "Sqrt", [b](size_t i) { return Ohm::Math::Sqrt(b[i]); });
+		aRegistry.AddSingle(prefix + "Sin", [a](size_t i) { return Ohm::Math::Sin(a[i]); });
+		aRegistry.AddSingle(prefix + "Vector3Length", [vectors](size_t i) { return vectors[i].Length(); });
+		aRegistry.AddSingle(prefix + "Vector3GetNormalized", [vectors](size_t i) { return vectors[i].GetNormalized(); });
+		aRegistry.AddSingle(prefix + "Matrix3x3Rotate", [a, vectors](size_t i) { return vectors[i] * Matrix3x3<T>::CreateRotationAroundZ(a[i]); });
+	}
+}
+
+void RegisterFixedBenchmarks(Benchmark::Registry& aRegistry)
+{
+	RegisterScalar<float>(aRegistry);
+	RegisterScalar<double>(aRegistry);
+	RegisterScalar<Fixed16>(aRegistry);
+	RegisterScalar<Fixed32>(aRegistry);
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Geometry/FrustumBatch.hpp>
+
+namespace
+{
+	// Roughly a third of a 100k object scene is inside the frustum.
+	constexpr size_t ObjectCount = 100000;
+
+	template<typename T>
+	Frustum<T> TestFrustum()
+	{
+		const Matrix4x4<T> view = Matrix4x4<T>::GetFastInverse(Matrix4x4<T>::CreateLookAt(Vector3<T>(0), Vector3<T>(1, 0, 1), Vector3<T>(0, 1, 0)));
+		return Frustum<T>(view * Matrix4x4<T>::CreatePerspective(static_cast<T>(1.2), static_cast<T>(1), static_cast<T>(0.1), static_cast<T>(500)));
+	}
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Frustum<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(ObjectCount);
+		const Frustum<T> frustum = TestFrustum<T>();
+
+		const std::vector<T> positions = Benchmark::RandomValues<T>(ObjectCount * 3, static_cast<T>(-500), static_cast<T>(500), 1);
+		const std::vector<T> sizes = Benchmark::RandomValues<T>(ObjectCount * 3, static_cast<T>(0.5), static_cast<T>(5), 2);
+
+		Vector3SoA<T> centers(ObjectCount);
+		AABBSoA<T> boxes(ObjectCount);
+		std::vector<AABB<T>> boxArray(ObjectCount);
+		for (size_t i = 0; i < ObjectCount; i++)
+		{
+			const Vector3<T> center(positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+			centers.Set(i, center);
+			boxArray[i] = AABB<T>::FromCenterExtents(center, Vector3<T>(sizes[i * 3 + 0], sizes[i * 3 + 1], sizes[i * 3 + 2]));
+			boxes.Set(i, boxArray[i]);
+		}
+
+		aRegistry.AddSingle(prefix + "IntersectsSphere", [frustum, positions, sizes](size_t i)
+		{
+			return frustum.IntersectsSphere(Vector3<T>(positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]), sizes[i]);
+		});
+		aRegistry.AddSingle(prefix + "Intersects", [frustum, boxArray](size_t i) { return frustum.Intersects(boxArray[i]); });
+
+		aRegistry.Add(prefix + "CullSpheres" + suffix, ObjectCount, [frustum, centers, sizes, mask = std::vector<uint64_t>(Ohm::Simd::MaskWordCount(ObjectCount))](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				CullSpheres(frustum, centers, sizes.data(), mask.data());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "CullAABBs" + suffix, ObjectCount, [frustum, boxes, mask = std::vector<uint64_t>(Ohm::Simd::MaskWordCount(ObjectCount))](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				CullAABBs(frustum, boxes, mask.data());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		// Per object reference for the batch paths above.
+		aRegistry.Add(prefix + "CullAABBsScalar" + suffix, ObjectCount, [frustum, boxArray, mask = std::vector<uint64_t>(Ohm::Simd::MaskWordCount(ObjectCount))](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				std::fill(mask.begin(), mask.end(), uint64_t(0));
+				for (size_t j = 0; j < boxArray.size(); j++)
+				{
+					mask[j / 64] |= uint64_t(frustum.Intersects(boxArray[j]) ? 1 : 0) << (j % 64);
+				}
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterFrustumBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
@@ -0,0 +1,181 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Utility/Simd.hpp>
+#include <Ohm/Utility/Utility.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	const char* GetInstructionSet()
+	{
+#if defined(OHM_SIMD_AVX512)
+		return "AVX-512";
+#elif defined(OHM_SIMD_AVX2) && defined(OHM_SIMD_FMA)
+		return "AVX2+FMA";
+#elif defined(OHM_SIMD_AVX2)
+		return "AVX2";
+#elif defined(OHM_SIMD_AVX)
+		return "AVX";
+#elif defined(OHM_SIMD_SSE4_1)
+		return "SSE4.1";
+#elif defined(OHM_SIMD_SSE2)
+		return "SSE2";
+#else
+		return "Scalar";
+#endif
+	}
+
+	bool ParseOption(const char* aArgument, const char* aName, std::string& aOutValue)
+	{
+		const size_t length = std::strlen(aName);
+		if (std::strncmp(aArgument, aName, length) != 0 || aArgument[length] != '=')
+		{
+			return false;
+		}
+
+		aOutValue = aArgument + length + 1;
+		return true;
+	}
+
+	void PrintUsage()
+	{
+		std::printf(
+			"Usage: Benchmarks [options]\n"
+			"  --filter=<text>        Only run benchmarks whose name contains <text>\n"
+			"  --format=json|csv      Output format (default json)\n"
+			"  --min-time=<seconds>   Minimum time per measurement (default 0.1)\n"
+			"  --repetitions=<n>      Measurements per benchmark, the fastest is reported (default 3)\n"
+			"  --instruction-set=<n>  Kernels used by the Dispatch benchmarks: scalar, sse2, sse4.1, avx2 or avx512\n"
+			"  --list                 Print benchmark names and exit\n");
+	}
+
+	void WriteJson(const std::vector<Benchmark::Result>& aResults)
+	{
+		std::printf("{\n");
+		std::printf("\t\"context\": { \"instruction_set\": \"%s\", \"dispatch_instruction_set\": \"%s\", \"pointer_size\": %zu },\n",
+			GetInstructionSet(), Ohm::ToString(Ohm::GetInstructionSet()), sizeof(void*));
+		std::printf("\t\"benchmarks\": [\n");
+
+		for (size_t i = 0; i < aResults.size(); i++)
+		{
+			const Benchmark::Result& result = aResults[i];
+			std::printf("\t\t{ \"name\": \"%s\", \"iterations\": %zu, \"items_per_iteration\": %zu, \"ns_per_op\": %.4f, \"ops_per_sec\": %.1f }%s\n",
+				result.myName.c_str(), result.myIterations, result.myItemsPerIteration, result.myNanosecondsPerOperation, result.myOperationsPerSecond,
+				i + 1 < aResults.size() ? "," : "");
+		}
+
+		std::printf("\t]\n}\n");
+	}
+
+	void WriteCsv(const std::vector<Benchmark::Result>& aResults)
+	{
+		std::printf("name,instruction_set,dispatch_instruction_set,iterations,items_per_iteration,ns_per_op,ops_per_sec\n");
+		for (const Benchmark::Result& result : aResults)
+		{
+			std::printf("%s,%s,%s,%zu,%zu,%.4f,%.1f\n", result.myName.c_str(), GetInstructionSet(), Ohm::ToString(Ohm::GetInstructionSet()),
+				result.myIterations, result.myItemsPerIteration,
+				result.myNanosecondsPerOperation, result.myOperationsPerSecond);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Benchmark::Options options;
+	bool listOnly = false;
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string value;
+		if (ParseOption(argv[i], "--filter", value))
+		{
+			options.myFilter = value;
+		}
+		else if (ParseOption(argv[i], "--format", value) && (value == "json" || value == "csv"))
+		{
+			options.myFormat = value;
+		}
+		else if (ParseOption(argv[i], "--min-time", value))
+		{
+			options.myMinTime = std::atof(value.c_str());
+		}
+		else if (ParseOption(argv[i], "--repetitions", value) && std::atoi(value.c_str()) > 0)
+		{
+			options.myRepetitions = static_cast<size_t>(std::atoi(value.c_str()));
+		}
+		else if (ParseOption(argv[i], "--instruction-set", value))
+		{
+			Ohm::InstructionSet instructionSet;
+			if (!Ohm::ParseInstructionSet(value.c_str(), instructionSet) || !Ohm::SetInstructionSet(instructionSet))
+			{
+				std::fprintf(stderr, "Instruction set '%s' is unknown or not supported by this CPU\n", value.c_str());
+				return 1;
+			}
+		}
+		else if (std::strcmp(argv[i], "--list") == 0)
+		{
+			listOnly = true;
+		}
+		else
+		{
+			PrintUsage();
+			return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+		}
+	}
+
+	Benchmark::Registry registry;
+	RegisterVectorBenchmarks(registry);
+	RegisterMatrixBenchmarks(registry);
+	RegisterQuaternionBenchmarks(registry);
+	RegisterFixedBenchmarks(registry);
+	RegisterCompressionBenchmarks(registry);
+	RegisterDispatchBenchmarks(registry);
+	RegisterAABBBenchmarks(registry);
+	RegisterFrustumBenchmarks(registry);
+	RegisterRayBenchmarks(registry);
+	RegisterBVHBenchmarks(registry);
+	RegisterTransformHierarchyBenchmarks(registry);
+	RegisterSkinningBenchmarks(registry);
+	RegisterAnimationBenchmarks(registry);
+	RegisterMathBenchmarks(registry);
+	RegisterParallelBenchmarks(registry);
+	RegisterMemoryBenchmarks(registry);
+
+	std::vector<Benchmark::Result> results;
+	for (const Benchmark::Entry& entry : registry.GetEntries())
+	{
+		if (!options.myFilter.empty() && entry.myName.find(options.myFilter) == std::string::npos)
+		{
+			continue;
+		}
+
+		if (listOnly)
+		{
+			std::printf("%s\n", entry.myName.c_str());
+			continue;
+		}
+
+		results.push_back(Benchmark::Run(entry, options));
+	}
+
+	if (listOnly)
+	{
+		return 0;
+	}
+
+	if (options.myFormat == "csv")
+	{
+		WriteCsv(results);
+	}
+	else
+	{
+		WriteJson(results);
+	}
+
+	return 0;
+}
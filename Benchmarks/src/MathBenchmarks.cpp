@@ -0,0 +1,75 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Utility/FastMath.hpp>
+#include <Ohm/Matrix/Matrix4x4.hpp>
+#include <Ohm/Quaternion/Quaternion.hpp>
+
+#include <cmath>
+
+namespace
+{
+	constexpr const char* AccuracyName(MathAccuracy aAccuracy)
+	{
+		return aAccuracy == MathAccuracy::Exact ? "Exact" : aAccuracy == MathAccuracy::Fast ? "Fast" : "Approximate";
+	}
+
+	template<typename T, MathAccuracy Accuracy>
+	void RegisterTier(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Math<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = std::string("/") + AccuracyName(Accuracy);
+
+		const std::vector<T> positive = Benchmark::RandomValues<T>(Benchmark::SampleCount, static_cast<T>(1e-3), static_cast<T>(1e3), 1);
+		const std::vector<T> angles = Benchmark::RandomValues<T>(Benchmark::SampleCount, static_cast<T>(-10), static_cast<T>(10), 2);
+		const std::vector<T> cosines = Benchmark::RandomValues<T>(Benchmark::SampleCount, static_cast<T>(-1), static_cast<T>(1), 3);
+
+		aRegistry.AddSingle(prefix + "InvSqrt" + suffix, [positive](size_t i) { return Ohm::Math::InvSqrt<Accuracy>(positive[i]); });
+		aRegistry.AddSingle(prefix + "SinCos" + suffix, [angles](size_t i)
+		{
+			T sin = 0;
+			T cos = 0;
+			Ohm::Math::SinCos<Accuracy>(angles[i], sin, cos);
+			return sin + cos;
+		});
+		aRegistry.AddSingle(prefix + "Acos" + suffix, [cosines](size_t i) { return Ohm::Math::Acos<Accuracy>(cosines[i]); });
+		aRegistry.AddSingle(prefix + "Atan2" + suffix, [cosines, angles](size_t i) { return Ohm::Math::Atan2<Accuracy>(cosines[i], angles[i]); });
+
+		std::vector<Vector3<T>> vectors(Benchmark::SampleCount);
+		std::vector<Quaternion<T>> rotations(Benchmark::SampleCount);
+		for (size_t i = 0; i < Benchmark::SampleCount; i++)
+		{
+			vectors[i] = Vector3<T>(angles[i], cosines[i], positive[i]);
+			rotations[i] = Quaternion<T>(cosines[i], angles[i], cosines[(i + 1) & (Benchmark::SampleCount - 1)], positive[i]).GetNormalized();
+		}
+
+		aRegistry.AddSingle(prefix + "Vector3/GetNormalized" + suffix, [vectors](size_t i) { return vectors[i].template GetNormalizedWith<Accuracy>(); });
+		aRegistry.AddSingle(prefix + "Matrix4x4/CreateRotationAroundX" + suffix, [angles](size_t i) { return Matrix4x4<T>::template CreateRotationAroundXWith<Accuracy>(angles[i]); });
+		aRegistry.AddSingle(prefix + "Quaternion/Slerp" + suffix, [rotations, cosines](size_t i)
+		{
+			return Quaternion<T>::template SlerpWith<Accuracy>(rotations[i], rotations[(i + 7) & (Benchmark::SampleCount - 1)], Ohm::Math::Abs(cosines[i]));
+		});
+	}
+
+	template<typename T>
+	void RegisterTiers(Benchmark::Registry& aRegistry)
+	{
+		RegisterTier<T, MathAccuracy::Exact>(aRegistry);
+		RegisterTier<T, MathAccuracy::Fast>(aRegistry);
+		RegisterTier<T, MathAccuracy::Approximate>(aRegistry);
+	}
+}
+
+void RegisterMathBenchmarks(Benchmark::Registry& aRegistry)
+{
+	RegisterTiers<float>(aRegistry);
+	RegisterTiers<double>(aRegistry);
+
+	aRegistry.AddSingle("Math<float>/Vector4/GetNormalized/Exact", [vectors = Benchmark::RandomValues<float>(Benchmark::SampleCount * 4, -10.f, 10.f, 4)](size_t i)
+	{
+		return Vector4<float>(vectors[i * 4], vectors[i * 4 + 1], vectors[i * 4 + 2], vectors[i * 4 + 3]).GetNormalizedWith<MathAccuracy::Exact>();
+	});
+	aRegistry.AddSingle("Math<float>/Vector4/GetNormalized/Fast", [vectors = Benchmark::RandomValues<float>(Benchmark::SampleCount * 4, -10.f, 10.f, 4)](size_t i)
+	{
+		return Vector4<float>(vectors[i * 4], vectors[i * 4 + 1], vectors[i * 4 + 2], vectors[i * 4 + 3]).GetNormalizedWith<MathAccuracy::Fast>();
+	});
+}
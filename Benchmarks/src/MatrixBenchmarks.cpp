@@ -0,0 +1,173 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Matrix/Matrix3x4.hpp>
+#include <Ohm/Matrix/Matrix4x4.hpp>
+#include <Ohm/Matrix/TransformBatch.hpp>
+
+namespace
+{
+	template<typename T>
+	std::vector<Matrix4x4<T>> RandomTransforms(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 6, static_cast<T>(-3), static_cast<T>(3), aSeed);
+
+		std::vector<Matrix4x4<T>> matrices(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			const T* value = &values[i * 6];
+			matrices[i] = Matrix4x4<T>::CreateRotation(value[0], value[1], value[2]) * Matrix4x4<T>::CreateTranslation(Vector3<T>(value[3], value[4], value[5]));
+		}
+		return matrices;
+	}
+
+	template<typename T>
+	void RegisterSingle(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Matrix4x4<") + Benchmark::TypeName<T>() + ">/";
+
+		const std::vector<Matrix4x4<T>> a = RandomTransforms<T>(Benchmark::SampleCount, 1);
+		const std::vector<Matrix4x4<T>> b = RandomTransforms<T>(Benchmark::SampleCount, 2);
+		const std::vector<T> values = Benchmark::RandomValues<T>(Benchmark::SampleCount * 4, static_cast<T>(-10), static_cast<T>(10), 3);
+
+		std::vector<Vector4<T>> points(Benchmark::SampleCount);
+		std::vector<Vector3<T>> eyes(Benchmark::SampleCount);
+		for (size_t i = 0; i < Benchmark::SampleCount; i++)
+		{
+			points[i] = Vector4<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], static_cast<T>(1));
+			eyes[i] = Vector3<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2]);
+		}
+
+		aRegistry.AddSingle(prefix + "Multiply", [a, b](size_t i) { return a[i] * b[i]; });
+		aRegistry.AddSingle(prefix + "TransformVector4", [a, points](size_t i) { return points[i] * a[i]; });
+		aRegistry.AddSingle(prefix + "Transpose", [a](size_t i) { return Matrix4x4<T>::Transpose(a[i]); });
+		aRegistry.AddSingle(prefix + "GetFastInverse", [a](size_t i) { return Matrix4x4<T>::GetFastInverse(a[i]); });
+		aRegistry.AddSingle(prefix + "Inverse", [a](size_t i)
+		{
+			Matrix4x4<T> inverse;
+			Matrix4x4<T>::Inverse(a[i], inverse);
+			return inverse;
+		});
+		aRegistry.AddSingle(prefix + "InverseAffine", [a](size_t i)
+		{
+			Matrix4x4<T> inverse;
+			Matrix4x4<T>::InverseAffine(a[i], inverse);
+			return inverse;
+		});
+		aRegistry.AddSingle(prefix + "CreateLookAt", [eyes](size_t i)
+		{
+			return Matrix4x4<T>::CreateLookAt(eyes[i], Vector3<T>(0), Vector3<T>(0, 1, 0));
+		});
+		aRegistry.AddSingle(prefix + "CreatePerspective", [values](size_t i)
+		{
+			return Matrix4x4<T>::CreatePerspective(static_cast<T>(1) + values[i] * static_cast<T>(0.01), static_cast<T>(16.0 / 9.0), static_cast<T>(0.1), static_cast<T>(1000));
+		});
+	}
+
+	template<typename T>
+	void RegisterBatch(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Matrix4x4<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+
+		const Matrix4x4<T> transform = RandomTransforms<T>(1, 4)[0];
+		const std::vector<T> values = Benchmark::RandomValues<T>(Benchmark::BatchSize * 4, static_cast<T>(-10), static_cast<T>(10), 5);
+
+		std::vector<Vector3<T>> points3(Benchmark::BatchSize);
+		std::vector<Vector4<T>> points4(Benchmark::BatchSize);
+		for (size_t i = 0; i < Benchmark::BatchSize; i++)
+		{
+			points3[i] = Vector3<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2]);
+			points4[i] = Vector4<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], static_cast<T>(1));
+		}
+
+		aRegistry.Add(prefix + "TransformPoints<Vector3>" + suffix, Benchmark::BatchSize, [transform, points3, out = points3](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				TransformPoints(transform, points3.data(), out.data(), points3.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "TransformDirections<Vector3>" + suffix, Benchmark::BatchSize, [transform, points3, out = points3](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				TransformDirections(transform, points3.data(), out.data(), points3.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "TransformPointsProjective<Vector3>" + suffix, Benchmark::BatchSize, [transform, points3, out = points3](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				TransformPointsProjective(transform, points3.data(), out.data(), points3.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "TransformPoints<Vector4>" + suffix, Benchmark::BatchSize, [transform, points4, out = points4](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				TransformPoints(transform, points4.data(), out.data(), points4.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+
+	// The same transforms in the compact affine layout, to compare against the Matrix4x4 entries above.
+	template<typename T>
+	void RegisterAffine(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Matrix3x4<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+
+		const std::vector<Matrix4x4<T>> a4 = RandomTransforms<T>(Benchmark::SampleCount, 1);
+		const std::vector<Matrix4x4<T>> b4 = RandomTransforms<T>(Benchmark::SampleCount, 2);
+		const std::vector<T> values = Benchmark::RandomValues<T>(Benchmark::BatchSize * 4, static_cast<T>(-10), static_cast<T>(10), 5);
+
+		std::vector<Matrix3x4<T>> a(Benchmark::SampleCount);
+		std::vector<Matrix3x4<T>> b(Benchmark::SampleCount);
+		std::vector<Vector3<T>> points(Benchmark::BatchSize);
+		for (size_t i = 0; i < Benchmark::SampleCount; i++)
+		{
+			a[i] = Matrix3x4<T>(a4[i]);
+			b[i] = Matrix3x4<T>(b4[i]);
+		}
+		for (size_t i = 0; i < Benchmark::BatchSize; i++)
+		{
+			points[i] = Vector3<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2]);
+		}
+
+		aRegistry.AddSingle(prefix + "Multiply", [a, b](size_t i) { return a[i] * b[i]; });
+		aRegistry.AddSingle(prefix + "TransformPoint", [a, points](size_t i) { return a[i].TransformPoint(points[i]); });
+		aRegistry.AddSingle(prefix + "GetFastInverse", [a](size_t i) { return Matrix3x4<T>::GetFastInverse(a[i]); });
+		aRegistry.AddSingle(prefix + "Inverse", [a](size_t i)
+		{
+			Matrix3x4<T> inverse;
+			Matrix3x4<T>::Inverse(a[i], inverse);
+			return inverse;
+		});
+
+		aRegistry.Add(prefix + "TransformPoints<Vector3>" + suffix, Benchmark::BatchSize, [transform = a[0], points, out = points](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				TransformPoints(transform, points.data(), out.data(), points.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterMatrixBenchmarks(Benchmark::Registry& aRegistry)
+{
+	RegisterSingle<float>(aRegistry);
+	RegisterSingle<double>(aRegistry);
+	RegisterBatch<float>(aRegistry);
+	RegisterBatch<double>(aRegistry);
+	RegisterAffine<float>(aRegistry);
+	RegisterAffine<double>(aRegistry);
+}
@@ -0,0 +1,51 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Matrix/TransformBatch.hpp>
+#include <Ohm/Utility/Memory.hpp>
+
+namespace
+{
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Memory<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+
+		const std::vector<T> values = Benchmark::RandomValues<T>(Benchmark::BatchSize * 3, static_cast<T>(-100), static_cast<T>(100), 1);
+		std::vector<Vector3<T>> points(Benchmark::BatchSize);
+		for (size_t i = 0; i < Benchmark::BatchSize; i++)
+		{
+			points[i] = Vector3<T>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+		}
+		const Matrix4x4<T> transform = Matrix4x4<T>::CreateRotation(static_cast<T>(0.3), static_cast<T>(-1.1), static_cast<T>(2));
+
+		// A per-frame scratch buffer for transformed positions, reallocated every frame versus taken from a frame arena.
+		// Throughput in points.
+		aRegistry.Add(prefix + "ScratchVector" + suffix, Benchmark::BatchSize, [points, transform](size_t aIterations)
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				std::vector<Vector3<T>> scratch(Benchmark::BatchSize);
+				TransformPoints(transform, points.data(), scratch.data(), Benchmark::BatchSize);
+				Benchmark::DoNotOptimize(scratch.data());
+			}
+		});
+		aRegistry.Add(prefix + "ScratchFrameArena" + suffix, Benchmark::BatchSize, [points, transform](size_t aIterations)
+		{
+			FrameArena arena;
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3<T>* scratch = arena.Allocate<Vector3<T>>(Benchmark::BatchSize);
+				TransformPoints(transform, points.data(), scratch, Benchmark::BatchSize);
+				Benchmark::DoNotOptimize(scratch);
+				arena.Reset();
+			}
+		});
+	}
+}
+
+void RegisterMemoryBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
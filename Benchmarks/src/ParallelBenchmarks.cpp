@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Geometry/AABBBatch.hpp>
+#include <Ohm/Matrix/TransformBatch.hpp>
+#include <Ohm/Quaternion/QuaternionBatch.hpp>
+#include <Ohm/Vector/Vector3SoA.hpp>
+
+namespace
+{
+	// Large enough that every worker gets many chunks, small enough to run the whole curve quickly.
+	constexpr size_t ElementCount = 1 << 20;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Parallel<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(ElementCount);
+
+		const std::vector<T> values = Benchmark::RandomValues<T>(ElementCount * 4, static_cast<T>(-100), static_cast<T>(100), 1);
+		std::vector<Vector3<T>> points(ElementCount);
+		std::vector<Quaternion<T>> from(ElementCount);
+		std::vector<Quaternion<T>> to(ElementCount);
+		std::vector<AABB<T>> boxes(ElementCount);
+		for (size_t i = 0; i < ElementCount; i++)
+		{
+			const T* value = &values[i * 4];
+			points[i] = Vector3<T>(value[0], value[1], value[2]);
+			from[i] = Quaternion<T>(value[0], value[1], value[2], value[3]).GetNormalized();
+			to[i] = Quaternion<T>(value[3], value[2], value[1], value[0]).GetNormalized();
+			boxes[i] = AABB<T>::FromCenterExtents(points[i], Vector3<T>(static_cast<T>(1)));
+		}
+		const Vector3SoA<T> pointsSoA(points.data(), ElementCount);
+		const AABBSoA<T> boxesSoA(boxes.data(), ElementCount);
+		const Matrix4x4<T> transform = Matrix4x4<T>::CreateRotation(static_cast<T>(0.3), static_cast<T>(-1.1), static_cast<T>(2));
+
+		// Scaling curves, the same kernels with 0 (inline) up to one worker per hardware thread. Throughput in elements.
+		for (const size_t workers : Benchmark::ScalingWorkerCounts())
+		{
+			ThreadPool* pool = &Benchmark::GetThreadPool(workers);
+			const std::string threads = "/Workers" + std::to_string(workers);
+
+			aRegistry.Add(prefix + "TransformPoints" + threads + suffix, ElementCount, [points, transform, pool, out = std::vector<Vector3<T>>(ElementCount)](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					TransformPoints(transform, points.data(), out.data(), ElementCount, pool);
+					Benchmark::DoNotOptimize(out.data());
+				}
+			});
+			aRegistry.Add(prefix + "Vector3SoANormalize" + threads + suffix, ElementCount, [pointsSoA, pool, out = Vector3SoA<T>(ElementCount)](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					Vector3SoA<T>::Normalize(pointsSoA, out, pool);
+					Benchmark::DoNotOptimize(out.X());
+				}
+			});
+			aRegistry.Add(prefix + "NlerpQuaternions" + threads + suffix, ElementCount, [from, to, pool, out = std::vector<Quaternion<T>>(ElementCount)](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					NlerpQuaternions(from.data(), to.data(), static_cast<T>(0.3), out.data(), ElementCount, pool);
+					Benchmark::DoNotOptimize(out.data());
+				}
+			});
+			aRegistry.Add(prefix + "AABBSoATransform" + threads + suffix, ElementCount, [boxesSoA, transform, pool, out = AABBSoA<T>()](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					AABBSoA<T>::Transform(boxesSoA, transform, out, pool);
+					Benchmark::DoNotOptimize(out.Min().X());
+				}
+			});
+		}
+	}
+}
+
+void RegisterParallelBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
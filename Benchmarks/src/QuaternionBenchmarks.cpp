@@ -0,0 +1,135 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Quaternion/Quaternion.hpp>
+#include <Ohm/Quaternion/QuaternionBatch.hpp>
+
+namespace
+{
+	template<typename T>
+	std::vector<Quaternion<T>> RandomRotations(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 4, static_cast<T>(-1), static_cast<T>(1), aSeed);
+
+		std::vector<Quaternion<T>> rotations(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			rotations[i] = Quaternion<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3] + static_cast<T>(2)).GetNormalized();
+		}
+		return rotations;
+	}
+
+	template<typename T>
+	std::vector<Vector3<T>> RandomVectors(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 3, static_cast<T>(-10), static_cast<T>(10), aSeed);
+
+		std::vector<Vector3<T>> vectors(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			vectors[i] = Vector3<T>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+		}
+		return vectors;
+	}
+
+	template<typename T>
+	void RegisterSingle(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Quaternion<") + Benchmark::TypeName<T>() + ">/";
+
+		const std::vector<Quaternion<T>> a = RandomRotations<T>(Benchmark::SampleCount, 1);
+		const std::vector<Quaternion<T>> b = RandomRotations<T>(Benchmark::SampleCount, 2);
+		const std::vector<Vector3<T>> vectors = RandomVectors<T>(Benchmark::SampleCount, 3);
+		const std::vector<T> t = Benchmark::RandomValues<T>(Benchmark::SampleCount, static_cast<T>(0), static_cast<T>(1), 4);
+
+		aRegistry.AddSingle(prefix + "Multiply", [a, b](size_t i) { return a[i] * b[i]; });
+		aRegistry.AddSingle(prefix + "GetNormalized", [a](size_t i) { return a[i].GetNormalized(); });
+		aRegistry.AddSingle(prefix + "Inverse", [a](size_t i) { return a[i].Inverse(); });
+		aRegistry.AddSingle(prefix + "Slerp", [a, b, t](size_t i) { return Quaternion<T>::Slerp(a[i], b[i], t[i]); });
+		aRegistry.AddSingle(prefix + "Nlerp", [a, b, t](size_t i) { return Quaternion<T>::Nlerp(a[i], b[i], t[i]); });
+		aRegistry.AddSingle(prefix + "Rotate", [a, vectors](size_t i) { return a[i].Rotate(vectors[i]); });
+		aRegistry.AddSingle(prefix + "ToMatrix4x4", [a](size_t i) { return a[i].ToMatrix4x4(); });
+	}
+
+	template<typename T>
+	void RegisterBatch(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Quaternion<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+
+		const std::vector<Quaternion<T>> a = RandomRotations<T>(Benchmark::BatchSize, 5);
+		const std::vector<Quaternion<T>> b = RandomRotations<T>(Benchmark::BatchSize, 6);
+		const std::vector<Vector3<T>> vectors = RandomVectors<T>(Benchmark::BatchSize, 7);
+		const T t = static_cast<T>(0.37);
+
+		aRegistry.Add(prefix + "MultiplyQuaternions" + suffix, Benchmark::BatchSize, [a, b, out = a](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				MultiplyQuaternions(a.data(), b.data(), out.data(), a.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "NormalizeQuaternions" + suffix, Benchmark::BatchSize, [a, out = a](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				NormalizeQuaternions(a.data(), out.data(), a.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "NlerpQuaternions" + suffix, Benchmark::BatchSize, [a, b, t, out = a](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				NlerpQuaternions(a.data(), b.data(), t, out.data(), a.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "SlerpQuaternions/Exact" + suffix, Benchmark::BatchSize, [a, b, t, out = a](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				SlerpQuaternions(a.data(), b.data(), t, out.data(), a.size(), QuaternionInterpolation::Exact);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "SlerpQuaternions/Approximate" + suffix, Benchmark::BatchSize, [a, b, t, out = a](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				SlerpQuaternions(a.data(), b.data(), t, out.data(), a.size(), QuaternionInterpolation::Approximate);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "RotateVectors" + suffix, Benchmark::BatchSize, [a, vectors, out = vectors](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				RotateVectors(a.data(), vectors.data(), out.data(), a.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "QuaternionsToMatrices" + suffix, Benchmark::BatchSize, [a, out = std::vector<Matrix4x4<T>>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				QuaternionsToMatrices(a.data(), out.data(), a.size());
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterQuaternionBenchmarks(Benchmark::Registry& aRegistry)
+{
+	RegisterSingle<float>(aRegistry);
+	RegisterSingle<double>(aRegistry);
+	RegisterBatch<float>(aRegistry);
+	RegisterBatch<double>(aRegistry);
+}
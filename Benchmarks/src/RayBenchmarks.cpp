@@ -0,0 +1,82 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Geometry/RayBatch.hpp>
+
+namespace
+{
+	constexpr size_t RayCount = 10000;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Ray<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(RayCount);
+
+		// Rays from a cube around the objects towards points near the origin, about half of them hit.
+		const std::vector<T> origins = Benchmark::RandomValues<T>(RayCount * 3, static_cast<T>(-10), static_cast<T>(10), 1);
+		const std::vector<T> targets = Benchmark::RandomValues<T>(RayCount * 3, static_cast<T>(-2), static_cast<T>(2), 2);
+		std::vector<Ray<T>> rayArray(RayCount);
+		for (size_t i = 0; i < RayCount; i++)
+		{
+			const Vector3<T> origin(origins[i * 3 + 0], origins[i * 3 + 1], origins[i * 3 + 2]);
+			const Vector3<T> target(targets[i * 3 + 0], targets[i * 3 + 1], targets[i * 3 + 2]);
+			rayArray[i] = Ray<T>(origin, (target - origin).GetNormalized());
+		}
+		const RaySoA<T> rays(rayArray.data(), RayCount);
+
+		const AABB<T> box(Vector3<T>(-1), Vector3<T>(1));
+		const Sphere<T> sphere(Vector3<T>(0), static_cast<T>(1.5));
+		const Vector3<T> a(-2, -2, 0);
+		const Vector3<T> b(2, -1, 0);
+		const Vector3<T> c(0, 2, 0);
+
+		aRegistry.AddSingle(prefix + "IntersectsAABB", [rayArray, box](size_t i)
+		{
+			T distance = 0;
+			return rayArray[i].Intersects(box, distance) ? distance : static_cast<T>(-1);
+		});
+		aRegistry.AddSingle(prefix + "IntersectsTriangle", [rayArray, a, b, c](size_t i)
+		{
+			T distance = 0;
+			return rayArray[i].IntersectsTriangle(a, b, c, distance) ? distance : static_cast<T>(-1);
+		});
+
+		const auto addPacket = [&](const std::string& aName, auto aQuery)
+		{
+			aRegistry.Add(prefix + aName + suffix, RayCount, [rays, aQuery, distances = std::vector<T>(RayCount), hits = std::vector<uint64_t>(Ohm::Simd::MaskWordCount(RayCount))](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					std::fill(distances.begin(), distances.end(), std::numeric_limits<T>::max());
+					aQuery(rays, distances.data(), hits.data());
+					Benchmark::ClobberMemory();
+				}
+			});
+		};
+
+		addPacket("IntersectRaysAABB", [box](const RaySoA<T>& aRays, T* aDistances, uint64_t* aHits) { IntersectRays(aRays, box, aDistances, aHits); });
+		addPacket("IntersectRaysSphere", [sphere](const RaySoA<T>& aRays, T* aDistances, uint64_t* aHits) { IntersectRays(aRays, sphere, aDistances, aHits); });
+		addPacket("IntersectRaysTriangle", [a, b, c](const RaySoA<T>& aRays, T* aDistances, uint64_t* aHits) { IntersectRaysTriangle(aRays, a, b, c, aDistances, aHits); });
+
+		// Per ray reference for the packet paths above.
+		aRegistry.Add(prefix + "IntersectRaysTriangleScalar" + suffix, RayCount, [rayArray, a, b, c, distances = std::vector<T>(RayCount), hits = std::vector<uint64_t>(Ohm::Simd::MaskWordCount(RayCount))](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				std::fill(distances.begin(), distances.end(), std::numeric_limits<T>::max());
+				std::fill(hits.begin(), hits.end(), uint64_t(0));
+				for (size_t j = 0; j < rayArray.size(); j++)
+				{
+					hits[j / 64] |= uint64_t(rayArray[j].IntersectsTriangle(a, b, c, distances[j]) ? 1 : 0) << (j % 64);
+				}
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterRayBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
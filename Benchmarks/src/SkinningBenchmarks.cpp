@@ -0,0 +1,110 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Animation/Skinning.hpp>
+
+
+namespace
+{
+	constexpr size_t VertexCount = 20000;
+	constexpr size_t BoneCount = 64;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Skinning<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(VertexCount);
+
+		const std::vector<T> values = Benchmark::RandomValues<T>(BoneCount * 7 + VertexCount * 14, static_cast<T>(-1), static_cast<T>(1), 1);
+		std::vector<Matrix3x4<T>> palette(BoneCount);
+		std::vector<Matrix4x4<T>> palette4(BoneCount);
+		std::vector<DualQuaternion<T>> dualPalette(BoneCount);
+		for (size_t bone = 0; bone < BoneCount; bone++)
+		{
+			const T* value = &values[bone * 7];
+			const Quaternion<T> rotation = Quaternion<T>(value[0], value[1], value[2], value[3]).GetNormalized();
+			const Vector3<T> translation(value[4] * 10, value[5] * 10, value[6] * 10);
+			palette[bone] = Matrix3x4<T>::CreateTransform(translation, rotation);
+			palette4[bone] = palette[bone].ToMatrix4x4();
+			dualPalette[bone] = DualQuaternion<T>(rotation, translation);
+		}
+
+		// Four influences per vertex with weights summing to one.
+		std::vector<SkinInfluences<T>> influences(VertexCount);
+		Vector3SoA<T> positions(VertexCount);
+		Vector3SoA<T> normals(VertexCount);
+		for (size_t i = 0; i < VertexCount; i++)
+		{
+			const T* value = &values[BoneCount * 7 + i * 14];
+			T sum = 0;
+			for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+			{
+				influences[i].bones[influence] = static_cast<uint16_t>((value[influence] + 1) * static_cast<T>(0.5) * (BoneCount - 1));
+				influences[i].weights[influence] = value[4 + influence] + static_cast<T>(1.1);
+				sum += influences[i].weights[influence];
+			}
+			for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+			{
+				influences[i].weights[influence] /= sum;
+			}
+			positions.Set(i, Vector3<T>(value[8], value[9], value[10]) * static_cast<T>(2));
+			normals.Set(i, Vector3<T>(value[11], value[12], value[13]).GetNormalized());
+		}
+
+		// Throughput in vertices.
+		const auto addLinearBlend = [&](const std::string& aName, bool aNormals, ThreadPool* aPool)
+		{
+			aRegistry.Add(prefix + aName + suffix, VertexCount, [palette, influences, positions, normals, aNormals, aPool,
+				outPositions = Vector3SoA<T>(VertexCount), outNormals = Vector3SoA<T>(VertexCount)](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					SkinLinearBlend(palette.data(), influences.data(), positions, aNormals ? &normals : nullptr, outPositions, aNormals ? &outNormals : nullptr, aPool);
+					Benchmark::DoNotOptimize(outPositions.X());
+				}
+			});
+		};
+		const auto addDualQuaternion = [&](const std::string& aName, bool aNormals, ThreadPool* aPool)
+		{
+			aRegistry.Add(prefix + aName + suffix, VertexCount, [dualPalette, influences, positions, normals, aNormals, aPool,
+				outPositions = Vector3SoA<T>(VertexCount), outNormals = Vector3SoA<T>(VertexCount)](size_t aIterations) mutable
+			{
+				for (size_t i = 0; i < aIterations; i++)
+				{
+					SkinDualQuaternion(dualPalette.data(), influences.data(), positions, aNormals ? &normals : nullptr, outPositions, aNormals ? &outNormals : nullptr, aPool);
+					Benchmark::DoNotOptimize(outPositions.X());
+				}
+			});
+		};
+		addLinearBlend("LinearBlend", false, nullptr);
+		addLinearBlend("LinearBlendNormals", true, nullptr);
+		addLinearBlend("LinearBlendNormalsThreads", true, &Benchmark::GetThreadPool());
+		addDualQuaternion("DualQuaternion", false, nullptr);
+		addDualQuaternion("DualQuaternionNormals", true, nullptr);
+		addDualQuaternion("DualQuaternionNormalsThreads", true, &Benchmark::GetThreadPool());
+
+		// Reference: per vertex weighted sum of four Vector4 * Matrix4x4 transforms, positions only.
+		aRegistry.Add(prefix + "NaiveMatrix4x4" + suffix, VertexCount, [palette4, influences, positions, outPositions = Vector3SoA<T>(VertexCount)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (size_t vertex = 0; vertex < VertexCount; vertex++)
+				{
+					const Vector4<T> position(positions[vertex], 1);
+					Vector4<T> result(static_cast<T>(0));
+					for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+					{
+						result = result + position * palette4[influences[vertex].bones[influence]] * influences[vertex].weights[influence];
+					}
+					outPositions.Set(vertex, Vector3<T>(result.x, result.y, result.z));
+				}
+				Benchmark::DoNotOptimize(outPositions.X());
+			}
+		});
+	}
+}
+
+void RegisterSkinningBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
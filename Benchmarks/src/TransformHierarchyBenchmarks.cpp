@@ -0,0 +1,99 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Matrix/TransformHierarchy.hpp>
+
+
+namespace
+{
+	constexpr size_t NodeCount = 10000;
+
+	template<typename T>
+	void Register(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("TransformHierarchy<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(NodeCount);
+
+		// Forest of root subtrees, each node hanging below one of the few nodes just before it.
+		const std::vector<T> values = Benchmark::RandomValues<T>(NodeCount * 10, static_cast<T>(-1), static_cast<T>(1), 1);
+		TransformHierarchy<T> hierarchy;
+		std::vector<Vector3<T>> translations(NodeCount);
+		std::vector<Quaternion<T>> rotations(NodeCount);
+		std::vector<Vector3<T>> scales(NodeCount);
+		std::vector<uint32_t> parents(NodeCount);
+		for (uint32_t i = 0; i < NodeCount; i++)
+		{
+			const T* value = &values[i * 10];
+			const uint32_t back = 1 + static_cast<uint32_t>((value[9] + 1) * 3);
+			const uint32_t parent = i % 100 == 0 ? TransformHierarchy<T>::InvalidIndex : i - Ohm::Math::Min(back, i % 100);
+			translations[i] = Vector3<T>(value[0] * 10, value[1] * 10, value[2] * 10);
+			rotations[i] = Quaternion<T>(value[3], value[4], value[5], value[6]).GetNormalized();
+			scales[i] = Vector3<T>(1 + value[7] * static_cast<T>(0.25), 1 + value[8] * static_cast<T>(0.25), 1);
+			parents[i] = parent;
+			hierarchy.Add(parent, translations[i], rotations[i], scales[i]);
+		}
+		hierarchy.Update();
+
+		// Everything dirty, one percent dirty and everything dirty on all hardware threads. Throughput in nodes.
+		aRegistry.Add(prefix + "UpdateAll" + suffix, NodeCount, [hierarchy](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (uint32_t node = 0; node < NodeCount; node += 100)
+				{
+					hierarchy.SetScale(node, hierarchy.GetScale(node));
+				}
+				hierarchy.Update();
+				Benchmark::DoNotOptimize(hierarchy.GetWorldMatrices());
+			}
+		});
+		aRegistry.Add(prefix + "UpdateOnePercent" + suffix, NodeCount, [hierarchy](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (size_t k = 0; k < NodeCount / 100; k++)
+				{
+					const uint32_t node = static_cast<uint32_t>((i * NodeCount / 100 + k) * 7919 % NodeCount);
+					hierarchy.SetTranslation(node, hierarchy.GetTranslation(node));
+				}
+				hierarchy.Update();
+				Benchmark::DoNotOptimize(hierarchy.GetWorldMatrices());
+			}
+		});
+		aRegistry.Add(prefix + "UpdateAllThreads" + suffix, NodeCount, [hierarchy, pool = &Benchmark::GetThreadPool()](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (uint32_t node = 0; node < NodeCount; node += 100)
+				{
+					hierarchy.SetScale(node, hierarchy.GetScale(node));
+				}
+				hierarchy.Update(pool);
+				Benchmark::DoNotOptimize(hierarchy.GetWorldMatrices());
+			}
+		});
+
+		// Reference: every local matrix from its TRS, world matrices by chained operator* parent by parent.
+		aRegistry.Add(prefix + "ChainedMultiply" + suffix, NodeCount, [translations, rotations, scales, parents, world = std::vector<Matrix4x4<T>>(NodeCount)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				for (uint32_t node = 0; node < NodeCount; node++)
+				{
+					Matrix4x4<T> local = rotations[node].ToMatrix4x4();
+					local(1) = local(1) * scales[node].x;
+					local(2) = local(2) * scales[node].y;
+					local(3) = local(3) * scales[node].z;
+					local(4) = Vector4<T>(translations[node], 1);
+					world[node] = parents[node] == TransformHierarchy<T>::InvalidIndex ? local : local * world[parents[node]];
+				}
+				Benchmark::DoNotOptimize(world.data());
+			}
+		});
+	}
+}
+
+void RegisterTransformHierarchyBenchmarks(Benchmark::Registry& aRegistry)
+{
+	Register<float>(aRegistry);
+	Register<double>(aRegistry);
+}
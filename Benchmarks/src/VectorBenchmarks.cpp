@@ -0,0 +1,133 @@
+#include "Benchmark.hpp"
+
+#include <Ohm/Vector/Vector3.hpp>
+#include <Ohm/Vector/Vector4.hpp>
+#include <Ohm/Vector/Vector3SoA.hpp>
+#include <Ohm/Vector/VectorExpression.hpp>
+
+namespace
+{
+	template<typename T>
+	std::vector<Vector3<T>> RandomVector3s(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 3, static_cast<T>(-10), static_cast<T>(10), aSeed);
+
+		std::vector<Vector3<T>> vectors(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			vectors[i] = Vector3<T>(values[i * 3 + 0], values[i * 3 + 1], values[i * 3 + 2]);
+		}
+		return vectors;
+	}
+
+	template<typename T>
+	std::vector<Vector4<T>> RandomVector4s(size_t aCount, unsigned aSeed)
+	{
+		const std::vector<T> values = Benchmark::RandomValues<T>(aCount * 4, static_cast<T>(-10), static_cast<T>(10), aSeed);
+
+		std::vector<Vector4<T>> vectors(aCount);
+		for (size_t i = 0; i < aCount; i++)
+		{
+			vectors[i] = Vector4<T>(values[i * 4 + 0], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]);
+		}
+		return vectors;
+	}
+
+	template<typename T>
+	void RegisterSingle(Benchmark::Registry& aRegistry)
+	{
+		const std::string vector3 = std::string("Vector3<") + Benchmark::TypeName<T>() + ">/";
+		const std::string vector4 = std::string("Vector4<") + Benchmark::TypeName<T>() + ">/";
+
+		const std::vector<Vector3<T>> a3 = RandomVector3s<T>(Benchmark::SampleCount, 1);
+		const std::vector<Vector3<T>> b3 = RandomVector3s<T>(Benchmark::SampleCount, 2);
+		const std::vector<Vector4<T>> a4 = RandomVector4s<T>(Benchmark::SampleCount, 3);
+		const std::vector<Vector4<T>> b4 = RandomVector4s<T>(Benchmark::SampleCount, 4);
+
+		aRegistry.AddSingle(vector3 + "Add", [a3, b3](size_t i) { return a3[i] + b3[i]; });
+		aRegistry.AddSingle(vector3 + "MultiplyScalar", [a3](size_t i) { return a3[i] * static_cast<T>(1.5); });
+		aRegistry.AddSingle(vector3 + "Dot", [a3, b3](size_t i) { return a3[i].Dot(b3[i]); });
+		aRegistry.AddSingle(vector3 + "Cross", [a3, b3](size_t i) { return a3[i].Cross(b3[i]); });
+		aRegistry.AddSingle(vector3 + "Length", [a3](size_t i) { return a3[i].Length(); });
+		aRegistry.AddSingle(vector3 + "GetNormalized", [a3](size_t i) { return a3[i].GetNormalized(); });
+
+		// a * s + b * t - c through the eager operators and through Ohm::Lazy.
+		const T s = static_cast<T>(0.75);
+		const T t = static_cast<T>(-1.25);
+		aRegistry.AddSingle(vector3 + "ScaleAddSubtract", [a3, b3, s, t](size_t i) { return a3[i] * s + b3[i] * t - a3[Benchmark::SampleCount - 1 - i]; });
+		aRegistry.AddSingle(vector3 + "ScaleAddSubtractLazy", [a3, b3, s, t](size_t i) { return (Ohm::Lazy(a3[i]) * s + Ohm::Lazy(b3[i]) * t - a3[Benchmark::SampleCount - 1 - i]).Evaluate(); });
+
+		aRegistry.AddSingle(vector4 + "Add", [a4, b4](size_t i) { return a4[i] + b4[i]; });
+		aRegistry.AddSingle(vector4 + "MultiplyScalar", [a4](size_t i) { return a4[i] * static_cast<T>(1.5); });
+		aRegistry.AddSingle(vector4 + "Dot", [a4, b4](size_t i) { return a4[i].Dot(b4[i]); });
+		aRegistry.AddSingle(vector4 + "Length", [a4](size_t i) { return a4[i].Length(); });
+		aRegistry.AddSingle(vector4 + "GetNormalized", [a4](size_t i) { return a4[i].GetNormalized(); });
+		aRegistry.AddSingle(vector4 + "ScaleAddSubtract", [a4, b4, s, t](size_t i) { return a4[i] * s + b4[i] * t - a4[Benchmark::SampleCount - 1 - i]; });
+		aRegistry.AddSingle(vector4 + "ScaleAddSubtractLazy", [a4, b4, s, t](size_t i) { return (Ohm::Lazy(a4[i]) * s + Ohm::Lazy(b4[i]) * t - a4[Benchmark::SampleCount - 1 - i]).Evaluate(); });
+	}
+
+	template<typename T>
+	void RegisterBatch(Benchmark::Registry& aRegistry)
+	{
+		const std::string prefix = std::string("Vector3SoA<") + Benchmark::TypeName<T>() + ">/";
+		const std::string suffix = "/" + std::to_string(Benchmark::BatchSize);
+
+		const std::vector<Vector3<T>> a = RandomVector3s<T>(Benchmark::BatchSize, 5);
+		const std::vector<Vector3<T>> b = RandomVector3s<T>(Benchmark::BatchSize, 6);
+		const Vector3SoA<T> soaA(a.data(), a.size());
+		const Vector3SoA<T> soaB(b.data(), b.size());
+
+		aRegistry.Add(prefix + "Add" + suffix, Benchmark::BatchSize, [soaA, soaB, out = Vector3SoA<T>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3SoA<T>::Add(soaA, soaB, out);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "MultiplyAdd" + suffix, Benchmark::BatchSize, [soaA, soaB, out = Vector3SoA<T>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3SoA<T>::MultiplyAdd(soaA, soaB, soaA, out);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "Cross" + suffix, Benchmark::BatchSize, [soaA, soaB, out = Vector3SoA<T>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3SoA<T>::Cross(soaA, soaB, out);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "Normalize" + suffix, Benchmark::BatchSize, [soaA, out = Vector3SoA<T>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3SoA<T>::Normalize(soaA, out);
+				Benchmark::ClobberMemory();
+			}
+		});
+
+		aRegistry.Add(prefix + "Dot" + suffix, Benchmark::BatchSize, [soaA, soaB, out = std::vector<T>(Benchmark::BatchSize)](size_t aIterations) mutable
+		{
+			for (size_t i = 0; i < aIterations; i++)
+			{
+				Vector3SoA<T>::Dot(soaA, soaB, out.data());
+				Benchmark::ClobberMemory();
+			}
+		});
+	}
+}
+
+void RegisterVectorBenchmarks(Benchmark::Registry& aRegistry)
+{
+	RegisterSingle<float>(aRegistry);
+	RegisterSingle<double>(aRegistry);
+	RegisterBatch<float>(aRegistry);
+	RegisterBatch<double>(aRegistry);
+}
@@ -0,0 +1,365 @@
+#pragma once
+
+#include "Ohm/Quaternion/PackedQuaternion.hpp"
+#include "Ohm/Quaternion/Quaternion.hpp"
+#include "Ohm/Quaternion/QuaternionBatch.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Source keys of one bone. Every channel is sorted by time, times are >= 0.
+// An empty channel holds the rest pose: no translation, no rotation and unit scale.
+template<typename T>
+struct AnimationTrack
+{
+	std::vector<T> translationTimes;
+	std::vector<Vector3<T>> translations;
+	std::vector<T> rotationTimes;
+	std::vector<Quaternion<T>> rotations;
+	std::vector<T> scaleTimes;
+	std::vector<Vector3<T>> scales;
+};
+
+// Playback position in a clip: the current key of every channel. Sampling moves each key forward from where the
+// previous sample left it, so sequential playback costs O(1) per bone. Jumps further ahead fall back to a binary
+// search, jumps back (looping) restart the channel from its first key. Use one cursor per playing clip, a cursor
+// from another clip is detected and only costs a slower first sample.
+class AnimationCursor
+{
+public:
+	void Reset() { myKeys.clear(); }
+
+private:
+	template<typename T>
+	friend class AnimationClip;
+
+	// Translation, rotation and scale keys of every bone, channel by channel.
+	std::vector<uint32_t> myKeys;
+};
+
+namespace Ohm::Detail
+{
+	// Forward steps taken before a channel gives up on the cursor and binary searches.
+	constexpr int AnimationScanLimit = 4;
+
+	// Key k in [aBegin, aEnd) with aTimes[k] <= aTime < aTimes[k + 1], starting from aHint.
+	// Returns aBegin for times before the first key and the last key after the last one.
+	inline uint32_t FindAnimationKey(const uint16_t* aTimes, uint32_t aBegin, uint32_t aEnd, float aTime, uint32_t aHint)
+	{
+		uint32_t key = aHint;
+		if (key < aBegin || key >= aEnd || aTime < aTimes[key])
+		{
+			key = aBegin;
+		}
+
+		for (int step = 0; step < AnimationScanLimit; step++)
+		{
+			if (key + 1 >= aEnd || aTime < aTimes[key + 1])
+			{
+				return key;
+			}
+			key++;
+		}
+
+		return static_cast<uint32_t>(std::upper_bound(aTimes + key, aTimes + aEnd, aTime) - aTimes) - 1;
+	}
+
+	// Interpolation factor between aKey and the key after it, 0 past either end of the channel.
+	inline float AnimationKeyFactor(const uint16_t* aTimes, uint32_t aKey, uint32_t aEnd, float aTime)
+	{
+		if (aKey + 1 >= aEnd)
+		{
+			return 0.f;
+		}
+
+		const float from = aTimes[aKey];
+		return Ohm::Math::Max((aTime - from) / (static_cast<float>(aTimes[aKey + 1]) - from), 0.f);
+	}
+
+	inline uint16_t QuantizeAnimationValue(double aValue)
+	{
+		return static_cast<uint16_t>(Ohm::Math::Min(Ohm::Math::Max(std::lround(aValue), 0l), 65535l));
+	}
+}
+
+// Compressed translation, rotation and scale keys of a skeleton. Every channel is one stream of keys, bone after bone
+// and sorted by time within a bone, with the key times and values in separate arrays:
+// - Times are 16 bit fractions of the clip duration.
+// - Translations and scales are 16 bits per component within the range of their bone, 6 bytes per key.
+// - Rotations use the 48 bit PackedQuaternion encoding, which is float precision for every T.
+// Sample() walks each channel's streams in order for all bones at once and writes plain Vector3<T>/Quaternion<T> arrays.
+template<typename T>
+class AnimationClip
+{
+public:
+	AnimationClip<T>() = default;
+	// The duration is the time of the latest key.
+	AnimationClip<T>(const AnimationTrack<T>* aTracks, size_t aBoneCount);
+
+	size_t GetBoneCount() const { return myBoneCount; }
+	T GetDuration() const { return myDuration; }
+	// Bytes of key data, without the object itself.
+	size_t GetMemorySize() const;
+
+	// Samples every bone at aTime, clamped to [0, GetDuration()]. Translations and scales are interpolated linearly,
+	// rotations with a shortest arc Nlerp. Outputs hold GetBoneCount() elements, null outputs skip their channel.
+	void Sample(T aTime, AnimationCursor& aCursor, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const;
+	// Without a cursor every channel searches for its keys, for random access.
+	void Sample(T aTime, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const;
+
+private:
+	// Key times of one channel, bone b owns [myBegins[b], myBegins[b + 1]).
+	struct Channel
+	{
+		std::vector<uint32_t> myBegins;
+		std::vector<uint16_t> myTimes;
+	};
+
+	// Component i of a key decodes to myMinimum[i] + value * myStep[i].
+	struct VectorRange
+	{
+		Vector3<T> myMinimum;
+		Vector3<T> myStep;
+	};
+
+	void AddTimes(Channel& aChannel, const std::vector<T>& aTimes);
+	void AddVectors(Channel& aChannel, std::vector<uint16_t>& aValues, std::vector<VectorRange>& aRanges, const std::vector<T>& aTimes, const std::vector<Vector3<T>>& aVectors, const Vector3<T>& aDefault);
+	void SampleVectors(const Channel& aChannel, const std::vector<uint16_t>& aValues, const std::vector<VectorRange>& aRanges, float aTime, uint32_t* aKeys, Vector3<T>* aOut) const;
+	void SampleRotations(float aTime, uint32_t* aKeys, Quaternion<T>* aOut) const;
+	void SampleAll(T aTime, uint32_t* aKeys, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const;
+
+	size_t myBoneCount = 0;
+	T myDuration = 0;
+	// Seconds to 16 bit key time.
+	float myTimeScale = 0.f;
+
+	Channel myTranslationKeys;
+	std::vector<uint16_t> myTranslations;
+	std::vector<VectorRange> myTranslationRanges;
+
+	Channel myRotationKeys;
+	std::vector<PackedQuaternion> myRotations;
+
+	Channel myScaleKeys;
+	std::vector<uint16_t> myScales;
+	std::vector<VectorRange> myScaleRanges;
+};
+
+template<typename T>
+inline AnimationClip<T>::AnimationClip(const AnimationTrack<T>* aTracks, size_t aBoneCount)
+	: myBoneCount(aBoneCount)
+{
+	for (size_t bone = 0; bone < aBoneCount; bone++)
+	{
+		const AnimationTrack<T>& track = aTracks[bone];
+		for (const std::vector<T>* times : { &track.translationTimes, &track.rotationTimes, &track.scaleTimes })
+		{
+			assert(std::is_sorted(times->begin(), times->end()) && "Keys have to be sorted by time!");
+			if (!times->empty())
+			{
+				assert(times->front() >= static_cast<T>(0) && "Key times can't be negative!");
+				myDuration = Ohm::Math::Max(myDuration, times->back());
+			}
+		}
+	}
+	myTimeScale = myDuration > static_cast<T>(0) ? static_cast<float>(65535.0 / static_cast<double>(myDuration)) : 0.f;
+
+	for (Channel* channel : { &myTranslationKeys, &myRotationKeys, &myScaleKeys })
+	{
+		channel->myBegins.reserve(aBoneCount + 1);
+		channel->myBegins.push_back(0);
+	}
+	myTranslationRanges.reserve(aBoneCount);
+	myScaleRanges.reserve(aBoneCount);
+
+	for (size_t bone = 0; bone < aBoneCount; bone++)
+	{
+		const AnimationTrack<T>& track = aTracks[bone];
+		AddVectors(myTranslationKeys, myTranslations, myTranslationRanges, track.translationTimes, track.translations, Vector3<T>(static_cast<T>(0)));
+		AddVectors(myScaleKeys, myScales, myScaleRanges, track.scaleTimes, track.scales, Vector3<T>(static_cast<T>(1)));
+
+		assert(track.rotationTimes.size() == track.rotations.size() && "Every rotation key needs a time!");
+		AddTimes(myRotationKeys, track.rotationTimes);
+		for (const Quaternion<T>& rotation : track.rotations)
+		{
+			myRotations.push_back(PackedQuaternion(Quaternion<float>(static_cast<float>(rotation.x), static_cast<float>(rotation.y), static_cast<float>(rotation.z), static_cast<float>(rotation.w))));
+		}
+		if (track.rotations.empty())
+		{
+			myRotations.push_back(PackedQuaternion(Quaternion<float>()));
+		}
+	}
+}
+
+template<typename T>
+inline size_t AnimationClip<T>::GetMemorySize() const
+{
+	size_t size = 0;
+	for (const Channel* channel : { &myTranslationKeys, &myRotationKeys, &myScaleKeys })
+	{
+		size += channel->myBegins.size() * sizeof(uint32_t) + channel->myTimes.size() * sizeof(uint16_t);
+	}
+	size += (myTranslations.size() + myScales.size()) * sizeof(uint16_t) + myRotations.size() * sizeof(PackedQuaternion);
+	size += (myTranslationRanges.size() + myScaleRanges.size()) * sizeof(VectorRange);
+
+	return size;
+}
+
+template<typename T>
+inline void AnimationClip<T>::AddTimes(Channel& aChannel, const std::vector<T>& aTimes)
+{
+	for (const T& time : aTimes)
+	{
+		aChannel.myTimes.push_back(Ohm::Detail::QuantizeAnimationValue(static_cast<double>(time) * myTimeScale));
+	}
+	if (aTimes.empty())
+	{
+		aChannel.myTimes.push_back(0);
+	}
+	aChannel.myBegins.push_back(static_cast<uint32_t>(aChannel.myTimes.size()));
+}
+
+template<typename T>
+inline void AnimationClip<T>::AddVectors(Channel& aChannel, std::vector<uint16_t>& aValues, std::vector<VectorRange>& aRanges, const std::vector<T>& aTimes, const std::vector<Vector3<T>>& aVectors, const Vector3<T>& aDefault)
+{
+	assert(aTimes.size() == aVectors.size() && "Every key needs a time!");
+	AddTimes(aChannel, aTimes);
+
+	const std::vector<Vector3<T>> defaultKeys(aVectors.empty() ? 1 : 0, aDefault);
+	const std::vector<Vector3<T>>& keys = aVectors.empty() ? defaultKeys : aVectors;
+
+	Vector3<T> minimum = keys.front();
+	Vector3<T> maximum = keys.front();
+	for (const Vector3<T>& key : keys)
+	{
+		minimum = Vector3<T>(Ohm::Math::Min(minimum.x, key.x), Ohm::Math::Min(minimum.y, key.y), Ohm::Math::Min(minimum.z, key.z));
+		maximum = Vector3<T>(Ohm::Math::Max(maximum.x, key.x), Ohm::Math::Max(maximum.y, key.y), Ohm::Math::Max(maximum.z, key.z));
+	}
+
+	// Constant components get a zero step and always decode to their minimum.
+	const Vector3<T> step = (maximum - minimum) / static_cast<T>(65535);
+	aRanges.push_back({ minimum, step });
+
+	const T* minimumValues = &minimum.x;
+	const T* stepValues = &step.x;
+	for (const Vector3<T>& key : keys)
+	{
+		const T* values = &key.x;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			aValues.push_back(stepValues[axis] > static_cast<T>(0) ? Ohm::Detail::QuantizeAnimationValue(static_cast<double>((values[axis] - minimumValues[axis]) / stepValues[axis])) : 0);
+		}
+	}
+}
+
+template<typename T>
+inline void AnimationClip<T>::SampleVectors(const Channel& aChannel, const std::vector<uint16_t>& aValues, const std::vector<VectorRange>& aRanges, float aTime, uint32_t* aKeys, Vector3<T>* aOut) const
+{
+	const uint32_t* begins = aChannel.myBegins.data();
+	const uint16_t* times = aChannel.myTimes.data();
+	const uint16_t* values = aValues.data();
+
+	for (size_t bone = 0; bone < myBoneCount; bone++)
+	{
+		const uint32_t begin = begins[bone];
+		const uint32_t end = begins[bone + 1];
+		const uint32_t key = Ohm::Detail::FindAnimationKey(times, begin, end, aTime, aKeys ? aKeys[bone] : begin);
+		if (aKeys)
+		{
+			aKeys[bone] = key;
+		}
+
+		// Interpolates the 16 bit values and decodes once.
+		const float factor = Ohm::Detail::AnimationKeyFactor(times, key, end, aTime);
+		const uint16_t* from = values + key * 3;
+		const uint16_t* to = key + 1 < end ? from + 3 : from;
+		const VectorRange& range = aRanges[bone];
+		aOut[bone] = Vector3<T>(
+			range.myMinimum.x + static_cast<T>(from[0] + (static_cast<float>(to[0]) - from[0]) * factor) * range.myStep.x,
+			range.myMinimum.y + static_cast<T>(from[1] + (static_cast<float>(to[1]) - from[1]) * factor) * range.myStep.y,
+			range.myMinimum.z + static_cast<T>(from[2] + (static_cast<float>(to[2]) - from[2]) * factor) * range.myStep.z);
+	}
+}
+
+template<typename T>
+inline void AnimationClip<T>::SampleRotations(float aTime, uint32_t* aKeys, Quaternion<T>* aOut) const
+{
+	const uint32_t* begins = myRotationKeys.myBegins.data();
+	const uint16_t* times = myRotationKeys.myTimes.data();
+
+	// Keys are found bone by bone, decoding and blending run over blocks of bones with the batch kernels.
+	constexpr size_t BlockSize = 64;
+	PackedQuaternion from[BlockSize];
+	PackedQuaternion to[BlockSize];
+	float factors[BlockSize];
+	Quaternion<float> fromRotations[BlockSize];
+	Quaternion<float> toRotations[BlockSize];
+
+	for (size_t block = 0; block < myBoneCount; block += BlockSize)
+	{
+		const size_t count = Ohm::Math::Min(BlockSize, myBoneCount - block);
+		for (size_t i = 0; i < count; i++)
+		{
+			const size_t bone = block + i;
+			const uint32_t begin = begins[bone];
+			const uint32_t end = begins[bone + 1];
+			const uint32_t key = Ohm::Detail::FindAnimationKey(times, begin, end, aTime, aKeys ? aKeys[bone] : begin);
+			if (aKeys)
+			{
+				aKeys[bone] = key;
+			}
+
+			factors[i] = Ohm::Detail::AnimationKeyFactor(times, key, end, aTime);
+			from[i] = myRotations[key];
+			to[i] = myRotations[key + 1 < end ? key + 1 : key];
+		}
+
+		UnpackQuaternions(from, fromRotations, count);
+		UnpackQuaternions(to, toRotations, count);
+		NlerpQuaternions(fromRotations, toRotations, factors, fromRotations, count);
+		for (size_t i = 0; i < count; i++)
+		{
+			const Quaternion<float>& rotation = fromRotations[i];
+			aOut[block + i] = Quaternion<T>(static_cast<T>(rotation.x), static_cast<T>(rotation.y), static_cast<T>(rotation.z), static_cast<T>(rotation.w));
+		}
+	}
+}
+
+template<typename T>
+inline void AnimationClip<T>::SampleAll(T aTime, uint32_t* aKeys, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const
+{
+	const float time = static_cast<float>(Ohm::Math::Min(Ohm::Math::Max(aTime, static_cast<T>(0)), myDuration)) * myTimeScale;
+
+	if (aOutTranslations)
+	{
+		SampleVectors(myTranslationKeys, myTranslations, myTranslationRanges, time, aKeys, aOutTranslations);
+	}
+	if (aOutRotations)
+	{
+		SampleRotations(time, aKeys ? aKeys + myBoneCount : nullptr, aOutRotations);
+	}
+	if (aOutScales)
+	{
+		SampleVectors(myScaleKeys, myScales, myScaleRanges, time, aKeys ? aKeys + myBoneCount * 2 : nullptr, aOutScales);
+	}
+}
+
+template<typename T>
+inline void AnimationClip<T>::Sample(T aTime, AnimationCursor& aCursor, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const
+{
+	// Keys out of a channel's range are caught by FindAnimationKey, only the size has to match.
+	aCursor.myKeys.resize(myBoneCount * 3);
+	SampleAll(aTime, aCursor.myKeys.data(), aOutTranslations, aOutRotations, aOutScales);
+}
+
+template<typename T>
+inline void AnimationClip<T>::Sample(T aTime, Vector3<T>* aOutTranslations, Quaternion<T>* aOutRotations, Vector3<T>* aOutScales) const
+{
+	SampleAll(aTime, nullptr, aOutTranslations, aOutRotations, aOutScales);
+}
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Ohm/Matrix/Matrix3x4.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Quaternion/DualQuaternion.hpp"
+#include "Ohm/Utility/Memory.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Bones of one vertex. Unused slots keep a valid bone index (0 is fine) with weight 0, the weights should sum to 1.
+template<typename T>
+struct SkinInfluences
+{
+	static constexpr int Count = 4;
+
+	uint16_t bones[Count] = {};
+	T weights[Count] = {};
+};
+
+// CPU skinning of SoA position and normal streams. Every vertex blends the palette entries of its influences and
+// transforms its position and normal with the result, 4 (SSE) or 8 (AVX) vertices per step for float.
+// The palette holds the full skinning transform per bone, usually the inverse bind pose followed by the bone's world transform.
+// aPool splits the vertices into chunks on cache line boundaries, the result does not depend on it.
+// Outputs must be sized like aPositions and may not alias the inputs.
+namespace Ohm::Detail
+{
+	// Adds the weighted palette entries of aInfluences, Size values each, into aOut. A Float4Lane step per four values for float.
+	template<size_t Size, typename T>
+	inline void BlendPalette(const T* aPalette, const SkinInfluences<T>& aInfluences, const T (&aWeights)[SkinInfluences<T>::Count], T* aOut)
+	{
+		using Row = typename Ohm::Simd::FourWideLane<T>::Type;
+
+		const T* entry0 = aPalette + aInfluences.bones[0] * Size;
+		const T* entry1 = aPalette + aInfluences.bones[1] * Size;
+		const T* entry2 = aPalette + aInfluences.bones[2] * Size;
+		const T* entry3 = aPalette + aInfluences.bones[3] * Size;
+		const auto weight0 = Row::Set(aWeights[0]);
+		const auto weight1 = Row::Set(aWeights[1]);
+		const auto weight2 = Row::Set(aWeights[2]);
+		const auto weight3 = Row::Set(aWeights[3]);
+		for (size_t i = 0; i < Size; i += Row::Width)
+		{
+			auto value = Row::Multiply(weight0, Row::Load(entry0 + i));
+			value = Row::MultiplyAdd(weight1, Row::Load(entry1 + i), value);
+			value = Row::MultiplyAdd(weight2, Row::Load(entry2 + i), value);
+			value = Row::MultiplyAdd(weight3, Row::Load(entry3 + i), value);
+			Row::Store(aOut + i, value);
+		}
+	}
+
+	// Blends the palette for every vertex of a pack into a scratch block, Size values per vertex, and hands the block
+	// to aTransform(lane, block, index), which loads it transposed so each register holds one value for all vertices.
+	template<size_t Size, typename T, typename Blend, typename Transform>
+	inline void SkinRange(size_t aBegin, size_t aEnd, Blend&& aBlend, Transform&& aTransform)
+	{
+		Ohm::Simd::ForEachLane<T>(aEnd - aBegin, [&](auto aLane, size_t aOffset)
+		{
+			using Lane = decltype(aLane);
+
+			const size_t i = aBegin + aOffset;
+			alignas(Ohm::Simd::Alignment) T blended[Lane::Width * Size];
+			for (size_t vertex = 0; vertex < Lane::Width; vertex++)
+			{
+				aBlend(i + vertex, blended + vertex * Size);
+			}
+			aTransform(aLane, static_cast<const T*>(blended), i);
+		});
+	}
+
+	template<typename Lane, typename T>
+	inline void LoadVector3Lanes(const Vector3SoA<T>& aVectors, size_t aIndex, typename Lane::Type aOut[3])
+	{
+		aOut[0] = Lane::Load(aVectors.X() + aIndex);
+		aOut[1] = Lane::Load(aVectors.Y() + aIndex);
+		aOut[2] = Lane::Load(aVectors.Z() + aIndex);
+	}
+
+	template<typename Lane, typename T>
+	inline void StoreVector3Lanes(Vector3SoA<T>& aVectors, size_t aIndex, const typename Lane::Type aValue[3])
+	{
+		Lane::Store(aVectors.X() + aIndex, aValue[0]);
+		Lane::Store(aVectors.Y() + aIndex, aValue[1]);
+		Lane::Store(aVectors.Z() + aIndex, aValue[2]);
+	}
+
+	template<typename Lane, typename T, typename Pack>
+	inline void NormalizeLanes(Pack aVector[3])
+	{
+		const Pack invLength = Lane::Divide(Lane::Set(static_cast<T>(1)), Lane::Sqrt(Lane::Max(Ohm::Simd::LaneDot<Lane>(aVector, aVector), Lane::Set(std::numeric_limits<T>::min()))));
+		aVector[0] = Lane::Multiply(aVector[0], invLength);
+		aVector[1] = Lane::Multiply(aVector[1], invLength);
+		aVector[2] = Lane::Multiply(aVector[2], invLength);
+	}
+
+	template<typename T>
+	inline void SkinLinearBlendRange(const Matrix3x4<T>* aPalette, const SkinInfluences<T>* aInfluences, const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals,
+		Vector3SoA<T>& aOutPositions, Vector3SoA<T>* aOutNormals, size_t aBegin, size_t aEnd)
+	{
+		constexpr size_t Size = 12;
+		const T* palette = &aPalette[0](1).x;
+		static_assert(sizeof(Matrix3x4<T>) == Size * sizeof(T), "Matrix3x4 rows have to be tightly packed.");
+
+		auto blend = [&](size_t aVertex, T* aOut)
+		{
+			BlendPalette<Size>(palette, aInfluences[aVertex], aInfluences[aVertex].weights, aOut);
+		};
+
+		SkinRange<Size, T>(aBegin, aEnd, blend, [&](auto aLane, const T* aBlended, size_t i)
+		{
+			using Lane = decltype(aLane);
+			using Pack = typename Lane::Type;
+
+			// m[row * 4 + column] of the blended Matrix3x4 across the vertices of the pack.
+			Pack m[Size];
+			Lane::LoadTransposed4(aBlended + 0, m[0], m[1], m[2], m[3], Size);
+			Lane::LoadTransposed4(aBlended + 4, m[4], m[5], m[6], m[7], Size);
+			Lane::LoadTransposed4(aBlended + 8, m[8], m[9], m[10], m[11], Size);
+
+			Pack position[3];
+			LoadVector3Lanes<Lane>(aPositions, i, position);
+			Pack result[3];
+			for (int row = 0; row < 3; row++)
+			{
+				result[row] = Lane::MultiplyAdd(m[row * 4 + 2], position[2], Lane::MultiplyAdd(m[row * 4 + 1], position[1], Lane::MultiplyAdd(m[row * 4 + 0], position[0], m[row * 4 + 3])));
+			}
+			StoreVector3Lanes<Lane>(aOutPositions, i, result);
+
+			if (aNormals)
+			{
+				Pack normal[3];
+				LoadVector3Lanes<Lane>(*aNormals, i, normal);
+				for (int row = 0; row < 3; row++)
+				{
+					result[row] = Lane::MultiplyAdd(m[row * 4 + 2], normal[2], Lane::MultiplyAdd(m[row * 4 + 1], normal[1], Lane::Multiply(m[row * 4 + 0], normal[0])));
+				}
+				NormalizeLanes<Lane, T>(result);
+				StoreVector3Lanes<Lane>(*aOutNormals, i, result);
+			}
+		});
+	}
+
+	// Quaternion<T>::Rotate: v + w * t + q x t with t = 2 * (q x v).
+	template<typename Lane, typename Pack>
+	inline void LaneRotate(const Pack aAxis[3], Pack aW, const Pack aVector[3], Pack aOut[3])
+	{
+		Pack t[3];
+		Ohm::Simd::LaneCross<Lane>(aAxis, aVector, t);
+		t[0] = Lane::Add(t[0], t[0]);
+		t[1] = Lane::Add(t[1], t[1]);
+		t[2] = Lane::Add(t[2], t[2]);
+
+		Pack axisCrossT[3];
+		Ohm::Simd::LaneCross<Lane>(aAxis, t, axisCrossT);
+		for (int axis = 0; axis < 3; axis++)
+		{
+			aOut[axis] = Lane::Add(Lane::MultiplyAdd(aW, t[axis], aVector[axis]), axisCrossT[axis]);
+		}
+	}
+
+	template<typename T>
+	inline void SkinDualQuaternionRange(const DualQuaternion<T>* aPalette, const SkinInfluences<T>* aInfluences, const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals,
+		Vector3SoA<T>& aOutPositions, Vector3SoA<T>* aOutNormals, size_t aBegin, size_t aEnd)
+	{
+		constexpr size_t Size = 8;
+		const T* palette = &aPalette[0].real.x;
+		static_assert(sizeof(DualQuaternion<T>) == Size * sizeof(T), "DualQuaternion parts have to be tightly packed.");
+
+		auto blend = [&](size_t aVertex, T* aOut)
+		{
+			// Rotations on the other side of the first one are flipped, so the blend takes the shortest path.
+			// Branchless, the signs are as good as random across a mesh.
+			const SkinInfluences<T>& influences = aInfluences[aVertex];
+			const Quaternion<T>& pivot = aPalette[influences.bones[0]].real;
+			T weights[SkinInfluences<T>::Count];
+			for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+			{
+				const T dot = pivot.Dot(aPalette[influences.bones[influence]].real);
+				weights[influence] = influences.weights[influence] * std::copysign(static_cast<T>(1), dot);
+			}
+			BlendPalette<Size>(palette, influences, weights, aOut);
+		};
+
+		SkinRange<Size, T>(aBegin, aEnd, blend, [&](auto aLane, const T* aBlended, size_t i)
+		{
+			using Lane = decltype(aLane);
+			using Pack = typename Lane::Type;
+
+			Pack real[3];
+			Pack realW;
+			Pack dual[3];
+			Pack dualW;
+			Lane::LoadTransposed4(aBlended + 0, real[0], real[1], real[2], realW, Size);
+			Lane::LoadTransposed4(aBlended + 4, dual[0], dual[1], dual[2], dualW, Size);
+
+			// Normalizes the blend, both parts scale with the length of the real part.
+			const Pack lengthSqr = Lane::MultiplyAdd(realW, realW, Ohm::Simd::LaneDot<Lane>(real, real));
+			const Pack invLength = Lane::Divide(Lane::Set(static_cast<T>(1)), Lane::Sqrt(lengthSqr));
+			for (int axis = 0; axis < 3; axis++)
+			{
+				real[axis] = Lane::Multiply(real[axis], invLength);
+				dual[axis] = Lane::Multiply(dual[axis], invLength);
+			}
+			realW = Lane::Multiply(realW, invLength);
+			dualW = Lane::Multiply(dualW, invLength);
+
+			// DualQuaternion<T>::GetTranslation.
+			Pack translation[3];
+			Ohm::Simd::LaneCross<Lane>(real, dual, translation);
+			for (int axis = 0; axis < 3; axis++)
+			{
+				const Pack value = Lane::Add(translation[axis], Lane::Subtract(Lane::Multiply(dual[axis], realW), Lane::Multiply(real[axis], dualW)));
+				translation[axis] = Lane::Add(value, value);
+			}
+
+			Pack position[3];
+			Pack result[3];
+			LoadVector3Lanes<Lane>(aPositions, i, position);
+			LaneRotate<Lane>(real, realW, position, result);
+			result[0] = Lane::Add(result[0], translation[0]);
+			result[1] = Lane::Add(result[1], translation[1]);
+			result[2] = Lane::Add(result[2], translation[2]);
+			StoreVector3Lanes<Lane>(aOutPositions, i, result);
+
+			if (aNormals)
+			{
+				Pack normal[3];
+				LoadVector3Lanes<Lane>(*aNormals, i, normal);
+				LaneRotate<Lane>(real, realW, normal, result);
+				StoreVector3Lanes<Lane>(*aOutNormals, i, result);
+			}
+		});
+	}
+
+	template<typename T, typename F>
+	inline void RunSkinning(const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals, const Vector3SoA<T>& aOutPositions, const Vector3SoA<T>* aOutNormals, ThreadPool* aPool, F&& aRange)
+	{
+		assert(aOutPositions.Size() == aPositions.Size() && "Output positions have to match the input!");
+		assert((!aNormals || (aOutNormals && aNormals->Size() == aPositions.Size() && aOutNormals->Size() == aPositions.Size())) && "Output normals have to match the input!");
+		(void)aOutPositions;
+		(void)aNormals;
+		(void)aOutNormals;
+
+		Ohm::Detail::ParallelFor(aPool, aPositions.Size(), Ohm::Detail::ParallelGrain(sizeof(T) * 12 + sizeof(SkinInfluences<T>)), aRange);
+	}
+}
+
+// Linear blend skinning, the blended matrix also transforms the normals, which are renormalized afterwards.
+// That is exact for rotations and uniform scale.
+template<typename T>
+inline void SkinLinearBlend(const Matrix3x4<T>* aPalette, const SkinInfluences<T>* aInfluences, const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals,
+	Vector3SoA<T>& aOutPositions, Vector3SoA<T>* aOutNormals, ThreadPool* aPool = nullptr)
+{
+	Ohm::Detail::RunSkinning(aPositions, aNormals, aOutPositions, aOutNormals, aPool, [&](size_t aBegin, size_t aEnd)
+	{
+		Ohm::Detail::SkinLinearBlendRange(aPalette, aInfluences, aPositions, aNormals, aOutPositions, aOutNormals, aBegin, aEnd);
+	});
+}
+
+// Matrix4x4 palettes are converted to Matrix3x4 first, their last columns are expected to be (0, 0, 0, 1).
+// The converted palette is taken from aScratch when given, so per-frame calls do not allocate.
+template<typename T>
+inline void SkinLinearBlend(const Matrix4x4<T>* aPalette, size_t aBoneCount, const SkinInfluences<T>* aInfluences, const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals,
+	Vector3SoA<T>& aOutPositions, Vector3SoA<T>* aOutNormals, ThreadPool* aPool = nullptr, FrameArena* aScratch = nullptr)
+{
+	AlignedArray<Matrix3x4<T>> palette = aScratch ? AlignedArray<Matrix3x4<T>>(aBoneCount, *aScratch) : AlignedArray<Matrix3x4<T>>(aBoneCount);
+	for (size_t bone = 0; bone < aBoneCount; bone++)
+	{
+		palette[bone] = Matrix3x4<T>(aPalette[bone]);
+	}
+	SkinLinearBlend(palette.Data(), aInfluences, aPositions, aNormals, aOutPositions, aOutNormals, aPool);
+}
+
+// Dual quaternion skinning, rigid bones only. Normals are rotated and keep their length.
+template<typename T>
+inline void SkinDualQuaternion(const DualQuaternion<T>* aPalette, const SkinInfluences<T>* aInfluences, const Vector3SoA<T>& aPositions, const Vector3SoA<T>* aNormals,
+	Vector3SoA<T>& aOutPositions, Vector3SoA<T>* aOutNormals, ThreadPool* aPool = nullptr)
+{
+	Ohm::Detail::RunSkinning(aPositions, aNormals, aOutPositions, aOutNormals, aPool, [&](size_t aBegin, size_t aEnd)
+	{
+		Ohm::Detail::SkinDualQuaternionRange(aPalette, aInfluences, aPositions, aNormals, aOutPositions, aOutNormals, aBegin, aEnd);
+	});
+}
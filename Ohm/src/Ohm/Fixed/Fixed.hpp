@@ -0,0 +1,570 @@
+#pragma once
+
+#include "Ohm/Utility/Math.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// 128 bit intermediates for the 64 bit storage, native where the compiler has them.
+// Define OHM_NO_INT128 to force the portable path, both produce the same bits.
+#if defined(__SIZEOF_INT128__) && !defined(OHM_NO_INT128)
+	#define OHM_INT128
+#endif
+
+namespace Ohm::Detail
+{
+	// Portable unsigned 128 bit integer with just the operations the fixed point kernels need.
+	struct UInt128
+	{
+		uint64_t myHigh;
+		uint64_t myLow;
+
+		constexpr UInt128(uint64_t aLow = 0, uint64_t aHigh = 0)
+			: myHigh(aHigh), myLow(aLow)
+		{
+		}
+
+		friend constexpr UInt128 operator+(UInt128 aA, UInt128 aB)
+		{
+			const uint64_t low = aA.myLow + aB.myLow;
+			return UInt128(low, aA.myHigh + aB.myHigh + (low < aA.myLow ? 1 : 0));
+		}
+
+		friend constexpr UInt128 operator-(UInt128 aA, UInt128 aB)
+		{
+			return UInt128(aA.myLow - aB.myLow, aA.myHigh - aB.myHigh - (aA.myLow < aB.myLow ? 1 : 0));
+		}
+
+		friend constexpr UInt128 operator<<(UInt128 aValue, int aShift)
+		{
+			if (aShift == 0)
+			{
+				return aValue;
+			}
+			if (aShift >= 64)
+			{
+				return UInt128(0, aValue.myLow << (aShift - 64));
+			}
+			return UInt128(aValue.myLow << aShift, (aValue.myHigh << aShift) | (aValue.myLow >> (64 - aShift)));
+		}
+
+		friend constexpr UInt128 operator>>(UInt128 aValue, int aShift)
+		{
+			if (aShift == 0)
+			{
+				return aValue;
+			}
+			if (aShift >= 64)
+			{
+				return UInt128(aValue.myHigh >> (aShift - 64), 0);
+			}
+			return UInt128((aValue.myLow >> aShift) | (aValue.myHigh << (64 - aShift)), aValue.myHigh >> aShift);
+		}
+
+		friend constexpr bool operator==(UInt128 aA, UInt128 aB) { return aA.myHigh == aB.myHigh && aA.myLow == aB.myLow; }
+		friend constexpr bool operator!=(UInt128 aA, UInt128 aB) { return !(aA == aB); }
+		friend constexpr bool operator<(UInt128 aA, UInt128 aB) { return aA.myHigh < aB.myHigh || (aA.myHigh == aB.myHigh && aA.myLow < aB.myLow); }
+		friend constexpr bool operator>(UInt128 aA, UInt128 aB) { return aB < aA; }
+		friend constexpr bool operator>=(UInt128 aA, UInt128 aB) { return !(aA < aB); }
+	};
+
+	constexpr UInt128 Multiply64x64(uint64_t aA, uint64_t aB)
+	{
+		const uint64_t aLow = aA & 0xFFFFFFFFu;
+		const uint64_t aHigh = aA >> 32;
+		const uint64_t bLow = aB & 0xFFFFFFFFu;
+		const uint64_t bHigh = aB >> 32;
+
+		const uint64_t lowLow = aLow * bLow;
+		const uint64_t lowHigh = aLow * bHigh;
+		const uint64_t highLow = aHigh * bLow;
+		const uint64_t highHigh = aHigh * bHigh;
+
+		const uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFu) + (highLow & 0xFFFFFFFFu);
+		return UInt128((middle << 32) | (lowLow & 0xFFFFFFFFu), highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32));
+	}
+
+	constexpr int CountLeadingZeros(uint64_t aValue)
+	{
+		if (aValue == 0)
+		{
+			return 64;
+		}
+
+		int count = 0;
+		for (int shift = 32; shift > 0; shift >>= 1)
+		{
+			if ((aValue >> (64 - shift)) == 0)
+			{
+				count += shift;
+				aValue <<= shift;
+			}
+		}
+		return count;
+	}
+
+	// Low 64 bits of a 128 bit numerator divided by a 64 bit divisor, schoolbook division with two 32 bit digits
+	// (Hacker's Delight, divlu) instead of one step per bit.
+	constexpr uint64_t Divide128x64(UInt128 aNumerator, uint64_t aDivisor)
+	{
+		constexpr uint64_t base = uint64_t(1) << 32;
+		constexpr uint64_t digitMask = base - 1;
+
+		// Only the low 64 bits of the quotient are kept, so the high part can be dropped up front.
+		const uint64_t high = aNumerator.myHigh % aDivisor;
+		const uint64_t low = aNumerator.myLow;
+
+		const int shift = CountLeadingZeros(aDivisor);
+		const uint64_t divisor = aDivisor << shift;
+		const uint64_t divisorHigh = divisor >> 32;
+		const uint64_t divisorLow = divisor & digitMask;
+
+		const uint64_t numerator32 = (high << shift) | (shift == 0 ? 0 : low >> (64 - shift));
+		const uint64_t numerator10 = low << shift;
+		const uint64_t numerator1 = numerator10 >> 32;
+		const uint64_t numerator0 = numerator10 & digitMask;
+
+		uint64_t quotient1 = numerator32 / divisorHigh;
+		uint64_t remainder = numerator32 - quotient1 * divisorHigh;
+		while (quotient1 >= base || quotient1 * divisorLow > base * remainder + numerator1)
+		{
+			quotient1--;
+			remainder += divisorHigh;
+			if (remainder >= base)
+			{
+				break;
+			}
+		}
+
+		const uint64_t numerator21 = numerator32 * base + numerator1 - quotient1 * divisor;
+		uint64_t quotient0 = numerator21 / divisorHigh;
+		remainder = numerator21 - quotient0 * divisorHigh;
+		while (quotient0 >= base || quotient0 * divisorLow > base * remainder + numerator0)
+		{
+			quotient0--;
+			remainder += divisorHigh;
+			if (remainder >= base)
+			{
+				break;
+			}
+		}
+		return quotient1 * base + quotient0;
+	}
+
+	// The raw kernels below work on two's complement bit patterns. Overflow wraps instead of being undefined.
+	template<typename Storage>
+	constexpr Storage WrapAdd(Storage aA, Storage aB)
+	{
+		using Unsigned = std::make_unsigned_t<Storage>;
+		return static_cast<Storage>(static_cast<Unsigned>(static_cast<Unsigned>(aA) + static_cast<Unsigned>(aB)));
+	}
+
+	template<typename Storage>
+	constexpr Storage WrapSubtract(Storage aA, Storage aB)
+	{
+		using Unsigned = std::make_unsigned_t<Storage>;
+		return static_cast<Storage>(static_cast<Unsigned>(static_cast<Unsigned>(aA) - static_cast<Unsigned>(aB)));
+	}
+
+	// (aA * aB) >> aFractionBits, rounded toward negative infinity.
+	template<int aFractionBits, typename Storage>
+	constexpr Storage FixedMultiply(Storage aA, Storage aB)
+	{
+		if constexpr (sizeof(Storage) <= 4)
+		{
+			return static_cast<Storage>((static_cast<int64_t>(aA) * static_cast<int64_t>(aB)) >> aFractionBits);
+		}
+		else
+		{
+#if defined(OHM_INT128)
+			return static_cast<Storage>((static_cast<__int128>(aA) * static_cast<__int128>(aB)) >> aFractionBits);
+#else
+			const bool negative = (aA < 0) != (aB < 0);
+			const uint64_t magnitudeA = aA < 0 ? 0 - static_cast<uint64_t>(aA) : static_cast<uint64_t>(aA);
+			const uint64_t magnitudeB = aB < 0 ? 0 - static_cast<uint64_t>(aB) : static_cast<uint64_t>(aB);
+
+			const UInt128 product = Multiply64x64(magnitudeA, magnitudeB);
+			uint64_t magnitude = (product >> aFractionBits).myLow;
+
+			// Flooring a negative result rounds its magnitude up.
+			if (negative && (product.myLow & ((uint64_t(1) << aFractionBits) - 1)) != 0)
+			{
+				magnitude++;
+			}
+			return static_cast<Storage>(negative ? 0 - magnitude : magnitude);
+#endif
+		}
+	}
+
+	// (aA << aFractionBits) / aB, truncated toward zero.
+	template<int aFractionBits, typename Storage>
+	constexpr Storage FixedDivide(Storage aA, Storage aB)
+	{
+		if constexpr (sizeof(Storage) <= 4)
+		{
+			return static_cast<Storage>(static_cast<int64_t>(aA) * (int64_t(1) << aFractionBits) / aB);
+		}
+		else
+		{
+#if defined(OHM_INT128)
+			return static_cast<Storage>(static_cast<__int128>(aA) * (static_cast<__int128>(1) << aFractionBits) / aB);
+#else
+			const bool negative = (aA < 0) != (aB < 0);
+			const uint64_t magnitudeA = aA < 0 ? 0 - static_cast<uint64_t>(aA) : static_cast<uint64_t>(aA);
+			const uint64_t magnitudeB = aB < 0 ? 0 - static_cast<uint64_t>(aB) : static_cast<uint64_t>(aB);
+
+			const uint64_t magnitude = Divide128x64(UInt128(magnitudeA) << aFractionBits, magnitudeB);
+			return static_cast<Storage>(negative ? 0 - magnitude : magnitude);
+#endif
+		}
+	}
+
+	// Floor of sqrt(aValue << aFractionBits), aValue must be non-negative.
+	// At run time the hardware square root only provides an estimate that is within one of the root, the integer
+	// correction afterwards makes the result the exact floor, so it is the same bits as the digit by digit version.
+	template<int aFractionBits, typename Storage>
+	constexpr Storage FixedSqrt(Storage aValue)
+	{
+		if constexpr (sizeof(Storage) <= 4)
+		{
+			const uint64_t value = static_cast<uint64_t>(aValue) << aFractionBits;
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<Storage>(Ohm::Math::Detail::IntegerSqrt(value));
+			}
+
+			uint64_t root = static_cast<uint64_t>(std::sqrt(static_cast<double>(value)));
+			if (root * root > value)
+			{
+				root--;
+			}
+			else if ((root + 1) * (root + 1) <= value)
+			{
+				root++;
+			}
+			return static_cast<Storage>(root);
+		}
+		else
+		{
+#if defined(OHM_INT128)
+			using Wide = unsigned __int128;
+			const Wide value = static_cast<Wide>(aValue) << aFractionBits;
+			const auto square = [](uint64_t aRoot) { return static_cast<Wide>(aRoot) * aRoot; };
+			const auto lowBits = [](Wide aWide) { return static_cast<uint64_t>(aWide); };
+			const double estimate = static_cast<double>(value);
+#else
+			using Wide = UInt128;
+			const Wide value = UInt128(static_cast<uint64_t>(aValue)) << aFractionBits;
+			const auto square = [](uint64_t aRoot) { return Multiply64x64(aRoot, aRoot); };
+			const auto lowBits = [](Wide aWide) { return aWide.myLow; };
+			const double estimate = static_cast<double>(value.myHigh) * 18446744073709551616.0 + static_cast<double>(value.myLow);
+#endif
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<Storage>(lowBits(Ohm::Math::Detail::IntegerSqrt(value)));
+			}
+
+			uint64_t root = static_cast<uint64_t>(std::sqrt(estimate));
+			if (square(root) > value)
+			{
+				root--;
+			}
+			else if (!(value < square(root + 1)))
+			{
+				root++;
+			}
+			return static_cast<Storage>(root);
+		}
+	}
+
+	// sin(i / SineTableSize * pi / 2) in Q2.30 for one quarter wave, generated once at compile time.
+	constexpr int SineTableBits = 12;
+	constexpr int SineTableSize = 1 << SineTableBits;
+
+	struct SineTable
+	{
+		int32_t myValues[SineTableSize + 1];
+	};
+
+	constexpr SineTable CreateSineTable()
+	{
+		SineTable table{};
+		for (int i = 0; i <= SineTableSize; i++)
+		{
+			const double angle = static_cast<double>(i) * (Ohm::Math::Pi / 2.0) / static_cast<double>(SineTableSize);
+			table.myValues[i] = static_cast<int32_t>(Ohm::Math::Detail::SinSeries(angle) * static_cast<double>(1 << 30) + 0.5);
+		}
+		return table;
+	}
+
+	inline constexpr SineTable QuarterSineTable = CreateSineTable();
+
+	// aPosition is in [0, 2^30] along the quarter wave, the result is Q2.30.
+	constexpr int32_t QuarterSine(uint32_t aPosition)
+	{
+		constexpr int fractionBits = 30 - SineTableBits;
+
+		const uint32_t index = aPosition >> fractionBits;
+		if (index >= static_cast<uint32_t>(SineTableSize))
+		{
+			return QuarterSineTable.myValues[SineTableSize];
+		}
+
+		const int64_t fraction = aPosition & ((uint32_t(1) << fractionBits) - 1);
+		const int32_t low = QuarterSineTable.myValues[index];
+		const int32_t high = QuarterSineTable.myValues[index + 1];
+		return low + static_cast<int32_t>(((high - low) * fraction) >> fractionBits);
+	}
+
+	// aPhase is a fraction of a full turn scaled by 2^32, the result is Q2.30.
+	constexpr int32_t PhaseSine(uint32_t aPhase)
+	{
+		constexpr uint32_t quarter = uint32_t(1) << 30;
+
+		const uint32_t within = aPhase & (quarter - 1);
+		switch (aPhase >> 30)
+		{
+			case 0: return QuarterSine(within);
+			case 1: return QuarterSine(quarter - within);
+			case 2: return -QuarterSine(within);
+			default: return -QuarterSine(quarter - within);
+		}
+	}
+}
+
+// Deterministic fixed point scalar for lockstep simulation, the value is stored as Storage scaled by 2^FractionBits.
+// Everything is integer arithmetic with defined rounding, so results are bit-identical across compilers and platforms:
+// multiplication floors, division truncates toward zero, Sqrt floors and Sin/Cos interpolate a compile time table.
+// Overflow wraps and is not checked, Fixed16 covers +-32768 and Fixed32 covers +-2^31.
+//
+// Fixed plugs into Vector2/3/4, Matrix3x3/4x4 and Quaternion. Integers convert implicitly, floating point only
+// explicitly (static_cast<Fixed16>(0.5)) so an accidental float never enters the simulation.
+template<typename Storage, int FractionBits>
+class Fixed
+{
+public:
+	static_assert(std::is_integral_v<Storage> && std::is_signed_v<Storage>, "Fixed needs a signed integer storage!");
+	static_assert(FractionBits > 0 && FractionBits < static_cast<int>(sizeof(Storage) * 8) - 1, "Fixed needs at least one integer bit!");
+
+	using StorageType = Storage;
+	static constexpr int FractionBitCount = FractionBits;
+
+	constexpr Fixed();
+
+	template<typename U, std::enable_if_t<std::is_integral_v<U>, int> = 0>
+	constexpr Fixed(U aValue);
+
+	template<typename U, std::enable_if_t<std::is_floating_point_v<U>, int> = 0>
+	explicit constexpr Fixed(U aValue);
+
+	static constexpr Fixed<Storage, FractionBits> FromRaw(Storage aRaw);
+	constexpr Storage GetRaw() const;
+
+	explicit constexpr operator float() const;
+	explicit constexpr operator double() const;
+
+	static constexpr Fixed<Storage, FractionBits> Sqrt(Fixed<Storage, FractionBits> aValue);
+	static constexpr Fixed<Storage, FractionBits> Reciprocal(Fixed<Storage, FractionBits> aValue);
+	static constexpr Fixed<Storage, FractionBits> Sin(Fixed<Storage, FractionBits> aAngleInRadians);
+	static constexpr Fixed<Storage, FractionBits> Cos(Fixed<Storage, FractionBits> aAngleInRadians);
+	static constexpr Fixed<Storage, FractionBits> Tan(Fixed<Storage, FractionBits> aAngleInRadians);
+
+	friend constexpr Fixed<Storage, FractionBits> operator+(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB)
+	{
+		return FromRaw(Ohm::Detail::WrapAdd(aA.myValue, aB.myValue));
+	}
+
+	friend constexpr Fixed<Storage, FractionBits> operator-(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB)
+	{
+		return FromRaw(Ohm::Detail::WrapSubtract(aA.myValue, aB.myValue));
+	}
+
+	friend constexpr Fixed<Storage, FractionBits> operator-(Fixed<Storage, FractionBits> aValue)
+	{
+		return FromRaw(Ohm::Detail::WrapSubtract(Storage(0), aValue.myValue));
+	}
+
+	friend constexpr Fixed<Storage, FractionBits> operator*(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB)
+	{
+		return FromRaw(Ohm::Detail::FixedMultiply<FractionBits>(aA.myValue, aB.myValue));
+	}
+
+	friend constexpr Fixed<Storage, FractionBits> operator/(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB)
+	{
+		assert(aB.myValue != 0 && "Division by zero!");
+
+		return FromRaw(Ohm::Detail::FixedDivide<FractionBits>(aA.myValue, aB.myValue));
+	}
+
+	friend constexpr Fixed<Storage, FractionBits>& operator+=(Fixed<Storage, FractionBits>& aA, Fixed<Storage, FractionBits> aB) { return aA = aA + aB; }
+	friend constexpr Fixed<Storage, FractionBits>& operator-=(Fixed<Storage, FractionBits>& aA, Fixed<Storage, FractionBits> aB) { return aA = aA - aB; }
+	friend constexpr Fixed<Storage, FractionBits>& operator*=(Fixed<Storage, FractionBits>& aA, Fixed<Storage, FractionBits> aB) { return aA = aA * aB; }
+	friend constexpr Fixed<Storage, FractionBits>& operator/=(Fixed<Storage, FractionBits>& aA, Fixed<Storage, FractionBits> aB) { return aA = aA / aB; }
+
+	friend constexpr bool operator==(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue == aB.myValue; }
+	friend constexpr bool operator!=(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue != aB.myValue; }
+	friend constexpr bool operator<(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue < aB.myValue; }
+	friend constexpr bool operator<=(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue <= aB.myValue; }
+	friend constexpr bool operator>(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue > aB.myValue; }
+	friend constexpr bool operator>=(Fixed<Storage, FractionBits> aA, Fixed<Storage, FractionBits> aB) { return aA.myValue >= aB.myValue; }
+
+private:
+	static constexpr Storage One = Storage(1) << FractionBits;
+
+	// 2 * pi in this format and 2^(63 - FractionBits) / (2 * pi), which maps [0, 2 * pi) onto a 2^32 phase.
+	static constexpr Storage TwoPi = static_cast<Storage>(2.0 * Ohm::Math::Pi * static_cast<double>(One) + 0.5);
+	static constexpr uint64_t PhaseScale = static_cast<uint64_t>(static_cast<double>(uint64_t(1) << (63 - FractionBits)) / (2.0 * Ohm::Math::Pi) + 0.5);
+
+	static constexpr uint32_t ToPhase(Fixed<Storage, FractionBits> aAngleInRadians);
+	static constexpr Fixed<Storage, FractionBits> FromSine(int32_t aSine);
+
+	Storage myValue;
+};
+
+using Fixed16 = Fixed<int32_t, 16>;
+using Fixed32 = Fixed<int64_t, 32>;
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits>::Fixed()
+	: myValue(0)
+{
+}
+
+template<typename Storage, int FractionBits>
+template<typename U, std::enable_if_t<std::is_integral_v<U>, int>>
+constexpr Fixed<Storage, FractionBits>::Fixed(U aValue)
+	: myValue(0)
+{
+	// Shifted as unsigned bits so out of range integers wrap like the other kernels.
+	using Unsigned = std::make_unsigned_t<Storage>;
+	myValue = static_cast<Storage>(static_cast<Unsigned>(static_cast<Unsigned>(static_cast<Storage>(aValue)) << FractionBits));
+}
+
+template<typename Storage, int FractionBits>
+template<typename U, std::enable_if_t<std::is_floating_point_v<U>, int>>
+constexpr Fixed<Storage, FractionBits>::Fixed(U aValue)
+	: myValue(0)
+{
+	// Round to nearest, scaling by a power of two is exact so this is deterministic as well.
+	const double scaled = static_cast<double>(aValue) * static_cast<double>(One);
+	myValue = static_cast<Storage>(scaled);
+	if (scaled - static_cast<double>(myValue) >= 0.5)
+	{
+		myValue++;
+	}
+	else if (static_cast<double>(myValue) - scaled > 0.5)
+	{
+		myValue--;
+	}
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::FromRaw(Storage aRaw)
+{
+	Fixed<Storage, FractionBits> value;
+	value.myValue = aRaw;
+	return value;
+}
+
+template<typename Storage, int FractionBits>
+constexpr Storage Fixed<Storage, FractionBits>::GetRaw() const
+{
+	return myValue;
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits>::operator float() const
+{
+	return static_cast<float>(static_cast<double>(*this));
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits>::operator double() const
+{
+	return static_cast<double>(myValue) / static_cast<double>(One);
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Sqrt(Fixed<Storage, FractionBits> aValue)
+{
+	assert(aValue.myValue >= 0 && "Square root of a negative value!");
+
+	if (aValue.myValue <= 0)
+	{
+		return Fixed<Storage, FractionBits>();
+	}
+	return FromRaw(Ohm::Detail::FixedSqrt<FractionBits>(aValue.myValue));
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Reciprocal(Fixed<Storage, FractionBits> aValue)
+{
+	assert(aValue.myValue != 0 && "Reciprocal of zero!");
+
+	return FromRaw(Ohm::Detail::FixedDivide<FractionBits>(One, aValue.myValue));
+}
+
+template<typename Storage, int FractionBits>
+constexpr uint32_t Fixed<Storage, FractionBits>::ToPhase(Fixed<Storage, FractionBits> aAngleInRadians)
+{
+	// Reducing to [0, 2 * pi) first keeps the product below 2^64.
+	Storage reduced = aAngleInRadians.myValue % TwoPi;
+	if (reduced < 0)
+	{
+		reduced += TwoPi;
+	}
+	return static_cast<uint32_t>((static_cast<uint64_t>(reduced) * PhaseScale) >> 31);
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::FromSine(int32_t aSine)
+{
+	if constexpr (FractionBits < 30)
+	{
+		return FromRaw(static_cast<Storage>((aSine + (int32_t(1) << (29 - FractionBits))) >> (30 - FractionBits)));
+	}
+	else
+	{
+		return FromRaw(static_cast<Storage>(static_cast<Storage>(aSine) * (Storage(1) << (FractionBits - 30))));
+	}
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Sin(Fixed<Storage, FractionBits> aAngleInRadians)
+{
+	return FromSine(Ohm::Detail::PhaseSine(ToPhase(aAngleInRadians)));
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Cos(Fixed<Storage, FractionBits> aAngleInRadians)
+{
+	// A quarter turn ahead of the sine, the phase wraps exactly.
+	return FromSine(Ohm::Detail::PhaseSine(ToPhase(aAngleInRadians) + (uint32_t(1) << 30)));
+}
+
+template<typename Storage, int FractionBits>
+constexpr Fixed<Storage, FractionBits> Fixed<Storage, FractionBits>::Tan(Fixed<Storage, FractionBits> aAngleInRadians)
+{
+	return Sin(aAngleInRadians) / Cos(aAngleInRadians);
+}
+
+namespace std
+{
+	template<typename Storage, int FractionBits>
+	struct numeric_limits<Fixed<Storage, FractionBits>>
+	{
+		static constexpr bool is_specialized = true;
+		static constexpr bool is_signed = true;
+		static constexpr bool is_integer = false;
+		static constexpr bool is_exact = true;
+		static constexpr int digits = std::numeric_limits<Storage>::digits;
+
+		static constexpr Fixed<Storage, FractionBits> min() { return Fixed<Storage, FractionBits>::FromRaw(1); }
+		static constexpr Fixed<Storage, FractionBits> max() { return Fixed<Storage, FractionBits>::FromRaw(std::numeric_limits<Storage>::max()); }
+		static constexpr Fixed<Storage, FractionBits> lowest() { return Fixed<Storage, FractionBits>::FromRaw(std::numeric_limits<Storage>::min()); }
+		static constexpr Fixed<Storage, FractionBits> epsilon() { return Fixed<Storage, FractionBits>::FromRaw(1); }
+	};
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+#include <limits>
+#include <type_traits>
+
+// Axis-aligned bounding box, min and max are inclusive.
+// A default constructed box is empty (min > max), merging anything into it yields that thing's bounds.
+template<class T>
+class AABB
+{
+public:
+	constexpr AABB<T>();
+	constexpr AABB<T>(const Vector3<T>& aMin, const Vector3<T>& aMax);
+	AABB<T>(const AABB<T>& aBox) = default;
+	AABB<T>& operator=(const AABB<T>& aBox) = default;
+	~AABB<T>() = default;
+
+	static constexpr AABB<T> FromCenterExtents(const Vector3<T>& aCenter, const Vector3<T>& aExtents);
+	static constexpr AABB<T> Merge(const AABB<T>& aA, const AABB<T>& aB);
+
+	constexpr bool IsEmpty() const;
+	constexpr Vector3<T> GetCenter() const;
+	// Half the size along each axis.
+	constexpr Vector3<T> GetExtents() const;
+	constexpr Vector3<T> GetSize() const;
+	constexpr T GetSurfaceArea() const;
+
+	constexpr bool Contains(const Vector3<T>& aPoint) const;
+	constexpr bool Contains(const AABB<T>& aBox) const;
+	constexpr bool Intersects(const AABB<T>& aBox) const;
+
+	constexpr void Merge(const Vector3<T>& aPoint);
+	constexpr void Merge(const AABB<T>& aBox);
+
+	// Bounds of the box transformed as row vector points (Arvo, Graphics Gems 1990).
+	// Each matrix element scales one input axis, the smaller product goes to the new min and the larger to the new max,
+	// which gives the tight box around all eight transformed corners without transforming them.
+	// An empty box stays empty.
+	constexpr AABB<T> Transform(const Matrix4x4<T>& aMatrix) const;
+
+	Vector3<T> min;
+	Vector3<T> max;
+};
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	// Arvo's transform with one register per output row. Adds in the same order as the scalar path,
+	// so both give the same bits.
+	inline AABB<float> TransformAABBSSE(const AABB<float>& aBox, const Matrix4x4<float>& aMatrix)
+	{
+		const float* matrix = &aMatrix(1).x;
+		const float* boxMin = &aBox.min.x;
+		const float* boxMax = &aBox.max.x;
+
+		__m128 resultMin = _mm_load_ps(matrix + 12);
+		__m128 resultMax = resultMin;
+		for (int row = 0; row < 3; row++)
+		{
+			const __m128 matrixRow = _mm_load_ps(matrix + row * 4);
+			const __m128 a = _mm_mul_ps(matrixRow, _mm_set1_ps(boxMin[row]));
+			const __m128 b = _mm_mul_ps(matrixRow, _mm_set1_ps(boxMax[row]));
+			resultMin = _mm_add_ps(resultMin, _mm_min_ps(a, b));
+			resultMax = _mm_add_ps(resultMax, _mm_max_ps(a, b));
+		}
+
+		alignas(16) float outMin[4];
+		alignas(16) float outMax[4];
+		_mm_store_ps(outMin, resultMin);
+		_mm_store_ps(outMax, resultMax);
+		return AABB<float>(Vector3<float>(outMin[0], outMin[1], outMin[2]), Vector3<float>(outMax[0], outMax[1], outMax[2]));
+	}
+}
+#endif
+
+template<class T>
+constexpr AABB<T>::AABB()
+	: min(std::numeric_limits<T>::max()), max(std::numeric_limits<T>::lowest())
+{
+}
+
+template<class T>
+constexpr AABB<T>::AABB(const Vector3<T>& aMin, const Vector3<T>& aMax)
+	: min(aMin), max(aMax)
+{
+}
+
+template<class T>
+constexpr AABB<T> AABB<T>::FromCenterExtents(const Vector3<T>& aCenter, const Vector3<T>& aExtents)
+{
+	return AABB<T>(aCenter - aExtents, aCenter + aExtents);
+}
+
+template<class T>
+constexpr AABB<T> AABB<T>::Merge(const AABB<T>& aA, const AABB<T>& aB)
+{
+	AABB<T> result = aA;
+	result.Merge(aB);
+	return result;
+}
+
+template<class T>
+constexpr bool AABB<T>::IsEmpty() const
+{
+	return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+template<class T>
+constexpr Vector3<T> AABB<T>::GetCenter() const
+{
+	return (min + max) / static_cast<T>(2);
+}
+
+template<class T>
+constexpr Vector3<T> AABB<T>::GetExtents() const
+{
+	return (max - min) / static_cast<T>(2);
+}
+
+template<class T>
+constexpr Vector3<T> AABB<T>::GetSize() const
+{
+	return max - min;
+}
+
+template<class T>
+constexpr T AABB<T>::GetSurfaceArea() const
+{
+	const Vector3<T> size = GetSize();
+	return static_cast<T>(2) * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+template<class T>
+constexpr bool AABB<T>::Contains(const Vector3<T>& aPoint) const
+{
+	return aPoint.x >= min.x && aPoint.x <= max.x &&
+		aPoint.y >= min.y && aPoint.y <= max.y &&
+		aPoint.z >= min.z && aPoint.z <= max.z;
+}
+
+template<class T>
+constexpr bool AABB<T>::Contains(const AABB<T>& aBox) const
+{
+	return aBox.min.x >= min.x && aBox.max.x <= max.x &&
+		aBox.min.y >= min.y && aBox.max.y <= max.y &&
+		aBox.min.z >= min.z && aBox.max.z <= max.z;
+}
+
+template<class T>
+constexpr bool AABB<T>::Intersects(const AABB<T>& aBox) const
+{
+	return aBox.min.x <= max.x && aBox.max.x >= min.x &&
+		aBox.min.y <= max.y && aBox.max.y >= min.y &&
+		aBox.min.z <= max.z && aBox.max.z >= min.z;
+}
+
+template<class T>
+constexpr void AABB<T>::Merge(const Vector3<T>& aPoint)
+{
+	min = Vector3<T>(Ohm::Math::Min(min.x, aPoint.x), Ohm::Math::Min(min.y, aPoint.y), Ohm::Math::Min(min.z, aPoint.z));
+	max = Vector3<T>(Ohm::Math::Max(max.x, aPoint.x), Ohm::Math::Max(max.y, aPoint.y), Ohm::Math::Max(max.z, aPoint.z));
+}
+
+template<class T>
+constexpr void AABB<T>::Merge(const AABB<T>& aBox)
+{
+	min = Vector3<T>(Ohm::Math::Min(min.x, aBox.min.x), Ohm::Math::Min(min.y, aBox.min.y), Ohm::Math::Min(min.z, aBox.min.z));
+	max = Vector3<T>(Ohm::Math::Max(max.x, aBox.max.x), Ohm::Math::Max(max.y, aBox.max.y), Ohm::Math::Max(max.z, aBox.max.z));
+}
+
+template<class T>
+constexpr AABB<T> AABB<T>::Transform(const Matrix4x4<T>& aMatrix) const
+{
+	if (IsEmpty())
+	{
+		return *this;
+	}
+
+#if defined(OHM_SIMD_SSE2)
+	if constexpr (std::is_same_v<T, float>)
+	{
+		if (!OHM_IS_CONSTANT_EVALUATED())
+		{
+			return Ohm::Simd::TransformAABBSSE(*this, aMatrix);
+		}
+	}
+#endif
+
+	const Vector4<T>& translation = aMatrix(4);
+	Vector3<T> resultMin(translation.x, translation.y, translation.z);
+	Vector3<T> resultMax = resultMin;
+
+	const auto accumulate = [&](const Vector4<T>& aRow, T aMin, T aMax)
+	{
+		const T ax = aRow.x * aMin, bx = aRow.x * aMax;
+		const T ay = aRow.y * aMin, by = aRow.y * aMax;
+		const T az = aRow.z * aMin, bz = aRow.z * aMax;
+		resultMin += Vector3<T>(Ohm::Math::Min(ax, bx), Ohm::Math::Min(ay, by), Ohm::Math::Min(az, bz));
+		resultMax += Vector3<T>(Ohm::Math::Max(ax, bx), Ohm::Math::Max(ay, by), Ohm::Math::Max(az, bz));
+	};
+
+	accumulate(aMatrix(1), min.x, max.x);
+	accumulate(aMatrix(2), min.y, max.y);
+	accumulate(aMatrix(3), min.z, max.z);
+
+	return AABB<T>(resultMin, resultMax);
+}
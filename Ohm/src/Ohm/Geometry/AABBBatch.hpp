@@ -0,0 +1,252 @@
+#pragma once
+
+#include "Ohm/Geometry/AABB.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+// Structure-of-arrays storage for AABB<T>, the min and max corners are two Vector3SoA<T>.
+// Like Vector3SoA every stream is padded to a whole cache line, padding boxes are zero sized at the origin.
+template<typename T>
+class AABBSoA
+{
+public:
+	AABBSoA<T>() = default;
+	AABBSoA<T>(size_t aSize);
+	AABBSoA<T>(const AABB<T>* aBoxes, size_t aCount);
+
+	AABB<T> operator[](size_t aIndex) const;
+	void Set(size_t aIndex, const AABB<T>& aBox);
+
+	void Resize(size_t aSize);
+	size_t Size() const { return myMin.Size(); }
+	size_t PaddedSize() const { return myMin.PaddedSize(); }
+
+	Vector3SoA<T>& Min() { return myMin; }
+	Vector3SoA<T>& Max() { return myMax; }
+	const Vector3SoA<T>& Min() const { return myMin; }
+	const Vector3SoA<T>& Max() const { return myMax; }
+
+	// Element-wise kernels, aOut is resized to match and may be one of the inputs.
+	// Transform matches AABB<T>::Transform except that boxes must not be empty.
+	// aPool splits the boxes into chunks on cache line boundaries, the result is the same without it.
+	static void Transform(const AABBSoA<T>& aA, const Matrix4x4<T>& aMatrix, AABBSoA<T>& aOut, ThreadPool* aPool = nullptr);
+	static void Merge(const AABBSoA<T>& aA, const AABBSoA<T>& aB, AABBSoA<T>& aOut);
+
+private:
+	Vector3SoA<T> myMin;
+	Vector3SoA<T> myMax;
+};
+
+template<typename T>
+inline AABBSoA<T>::AABBSoA(size_t aSize)
+	: myMin(aSize), myMax(aSize)
+{
+}
+
+template<typename T>
+inline AABBSoA<T>::AABBSoA(const AABB<T>* aBoxes, size_t aCount)
+	: myMin(aCount), myMax(aCount)
+{
+	for (size_t i = 0; i < aCount; i++)
+	{
+		Set(i, aBoxes[i]);
+	}
+}
+
+template<typename T>
+inline AABB<T> AABBSoA<T>::operator[](size_t aIndex) const
+{
+	return AABB<T>(myMin[aIndex], myMax[aIndex]);
+}
+
+template<typename T>
+inline void AABBSoA<T>::Set(size_t aIndex, const AABB<T>& aBox)
+{
+	myMin.Set(aIndex, aBox.min);
+	myMax.Set(aIndex, aBox.max);
+}
+
+template<typename T>
+inline void AABBSoA<T>::Resize(size_t aSize)
+{
+	myMin.Resize(aSize);
+	myMax.Resize(aSize);
+}
+
+template<typename T>
+inline void AABBSoA<T>::Transform(const AABBSoA<T>& aA, const Matrix4x4<T>& aMatrix, AABBSoA<T>& aOut, ThreadPool* aPool)
+{
+	aOut.Resize(aA.Size());
+
+	T matrix[4][3];
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 3; column++)
+		{
+			matrix[row][column] = aMatrix(row + 1, column + 1);
+		}
+	}
+
+	const T* inMin[3] = { aA.myMin.X(), aA.myMin.Y(), aA.myMin.Z() };
+	const T* inMax[3] = { aA.myMax.X(), aA.myMax.Y(), aA.myMax.Z() };
+	T* outMin[3] = { aOut.myMin.X(), aOut.myMin.Y(), aOut.myMin.Z() };
+	T* outMax[3] = { aOut.myMax.X(), aOut.myMax.Y(), aOut.myMax.Z() };
+
+	// Same products and order of additions as AABB<T>::Transform.
+	Ohm::Detail::ParallelFor(aPool, aA.PaddedSize(), Ohm::Detail::ParallelGrain(sizeof(T) * 12), [&](size_t aBegin, size_t aEnd)
+	{
+		Ohm::Simd::ForEachLane<T>(aEnd - aBegin, [&](auto aLane, size_t aOffset)
+		{
+			using Lane = decltype(aLane);
+			using Pack = decltype(Lane::Load(inMin[0]));
+			const size_t i = aBegin + aOffset;
+
+			// Everything is loaded before the first store, so aOut may alias aA.
+			Pack boxMin[3];
+			Pack boxMax[3];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				boxMin[axis] = Lane::Load(inMin[axis] + i);
+				boxMax[axis] = Lane::Load(inMax[axis] + i);
+			}
+
+			for (int column = 0; column < 3; column++)
+			{
+				Pack resultMin = Lane::Set(matrix[3][column]);
+				Pack resultMax = resultMin;
+				for (int row = 0; row < 3; row++)
+				{
+					const Pack element = Lane::Set(matrix[row][column]);
+					const Pack a = Lane::Multiply(element, boxMin[row]);
+					const Pack b = Lane::Multiply(element, boxMax[row]);
+					resultMin = Lane::Add(resultMin, Lane::Min(a, b));
+					resultMax = Lane::Add(resultMax, Lane::Max(a, b));
+				}
+
+				Lane::Store(outMin[column] + i, resultMin);
+				Lane::Store(outMax[column] + i, resultMax);
+			}
+		});
+	});
+}
+
+template<typename T>
+inline void AABBSoA<T>::Merge(const AABBSoA<T>& aA, const AABBSoA<T>& aB, AABBSoA<T>& aOut)
+{
+	assert(aA.Size() == aB.Size() && "Sizes must match!");
+	aOut.Resize(aA.Size());
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		Lane::Store(aOut.myMin.X() + i, Lane::Min(Lane::Load(aA.myMin.X() + i), Lane::Load(aB.myMin.X() + i)));
+		Lane::Store(aOut.myMin.Y() + i, Lane::Min(Lane::Load(aA.myMin.Y() + i), Lane::Load(aB.myMin.Y() + i)));
+		Lane::Store(aOut.myMin.Z() + i, Lane::Min(Lane::Load(aA.myMin.Z() + i), Lane::Load(aB.myMin.Z() + i)));
+		Lane::Store(aOut.myMax.X() + i, Lane::Max(Lane::Load(aA.myMax.X() + i), Lane::Load(aB.myMax.X() + i)));
+		Lane::Store(aOut.myMax.Y() + i, Lane::Max(Lane::Load(aA.myMax.Y() + i), Lane::Load(aB.myMax.Y() + i)));
+		Lane::Store(aOut.myMax.Z() + i, Lane::Max(Lane::Load(aA.myMax.Z() + i), Lane::Load(aB.myMax.Z() + i)));
+	});
+}
+
+// Bounds of aCount points, empty for aCount == 0.
+template<typename T>
+inline AABB<T> ComputeBounds(const Vector3<T>* aPoints, size_t aCount)
+{
+	AABB<T> bounds;
+	for (size_t i = 0; i < aCount; i++)
+	{
+		bounds.Merge(aPoints[i]);
+	}
+	return bounds;
+}
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	inline float HorizontalMin(__m128 aValue)
+	{
+		aValue = _mm_min_ps(aValue, _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(_mm_min_ss(aValue, _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(2, 3, 0, 1))));
+	}
+
+	inline float HorizontalMax(__m128 aValue)
+	{
+		aValue = _mm_max_ps(aValue, _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(_mm_max_ss(aValue, _mm_shuffle_ps(aValue, aValue, _MM_SHUFFLE(2, 3, 0, 1))));
+	}
+
+	// Merges floor(aCount / 4) * 4 points into aBounds and returns how many were processed.
+	// Eight points per step with AVX, the per-lane minima and maxima are only reduced once at the end.
+	inline size_t ComputeBounds(const float* aPoints, size_t aCount, AABB<float>& aBounds)
+	{
+		__m128 minX = _mm_set1_ps(aBounds.min.x);
+		__m128 minY = _mm_set1_ps(aBounds.min.y);
+		__m128 minZ = _mm_set1_ps(aBounds.min.z);
+		__m128 maxX = _mm_set1_ps(aBounds.max.x);
+		__m128 maxY = _mm_set1_ps(aBounds.max.y);
+		__m128 maxZ = _mm_set1_ps(aBounds.max.z);
+
+		size_t i = 0;
+#if defined(OHM_SIMD_AVX)
+		if (aCount >= 8)
+		{
+			__m256 minX8 = _mm256_set_m128(minX, minX);
+			__m256 minY8 = _mm256_set_m128(minY, minY);
+			__m256 minZ8 = _mm256_set_m128(minZ, minZ);
+			__m256 maxX8 = _mm256_set_m128(maxX, maxX);
+			__m256 maxY8 = _mm256_set_m128(maxY, maxY);
+			__m256 maxZ8 = _mm256_set_m128(maxZ, maxZ);
+
+			for (; i + 8 <= aCount; i += 8)
+			{
+				__m256 x, y, z;
+				LoadVector3x8(aPoints + i * 3, x, y, z);
+				minX8 = _mm256_min_ps(minX8, x);
+				minY8 = _mm256_min_ps(minY8, y);
+				minZ8 = _mm256_min_ps(minZ8, z);
+				maxX8 = _mm256_max_ps(maxX8, x);
+				maxY8 = _mm256_max_ps(maxY8, y);
+				maxZ8 = _mm256_max_ps(maxZ8, z);
+			}
+
+			minX = _mm_min_ps(_mm256_castps256_ps128(minX8), _mm256_extractf128_ps(minX8, 1));
+			minY = _mm_min_ps(_mm256_castps256_ps128(minY8), _mm256_extractf128_ps(minY8, 1));
+			minZ = _mm_min_ps(_mm256_castps256_ps128(minZ8), _mm256_extractf128_ps(minZ8, 1));
+			maxX = _mm_max_ps(_mm256_castps256_ps128(maxX8), _mm256_extractf128_ps(maxX8, 1));
+			maxY = _mm_max_ps(_mm256_castps256_ps128(maxY8), _mm256_extractf128_ps(maxY8, 1));
+			maxZ = _mm_max_ps(_mm256_castps256_ps128(maxZ8), _mm256_extractf128_ps(maxZ8, 1));
+		}
+#endif
+		for (; i + 4 <= aCount; i += 4)
+		{
+			__m128 x, y, z;
+			LoadVector3x4(aPoints + i * 3, x, y, z);
+			minX = _mm_min_ps(minX, x);
+			minY = _mm_min_ps(minY, y);
+			minZ = _mm_min_ps(minZ, z);
+			maxX = _mm_max_ps(maxX, x);
+			maxY = _mm_max_ps(maxY, y);
+			maxZ = _mm_max_ps(maxZ, z);
+		}
+
+		aBounds.min = Vector3<float>(HorizontalMin(minX), HorizontalMin(minY), HorizontalMin(minZ));
+		aBounds.max = Vector3<float>(HorizontalMax(maxX), HorizontalMax(maxY), HorizontalMax(maxZ));
+		return i;
+	}
+}
+
+inline AABB<float> ComputeBounds(const Vector3<float>* aPoints, size_t aCount)
+{
+	AABB<float> bounds;
+	const size_t processed = Ohm::Simd::ComputeBounds(reinterpret_cast<const float*>(aPoints), aCount, bounds);
+	for (size_t i = processed; i < aCount; i++)
+	{
+		bounds.Merge(aPoints[i]);
+	}
+	return bounds;
+}
+#endif
@@ -0,0 +1,901 @@
+#pragma once
+
+#include "Ohm/Geometry/AABB.hpp"
+#include "Ohm/Geometry/Frustum.hpp"
+#include "Ohm/Geometry/Ray.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+struct BVHBuildOptions
+{
+	// Ranges up to this size become leaves when the SAH finds no cheaper split, larger ones are always split.
+	uint32_t maxLeafSize = 4;
+	// Centroid bins per axis for the SAH split search, 2 to 64.
+	uint32_t binCount = 16;
+	// Builds large subtrees as tasks on this pool. The resulting tree is the same either way.
+	ThreadPool* pool = nullptr;
+};
+
+// Four wide node with the child boxes stored per component, so one SSE step tests a ray or box against all of them.
+// Slots [0, childCount) are used. A leaf slot covers primitives [child, child + count) of BVH<T>::GetPrimitiveOrder(),
+// an inner slot (count == 0) points to the child node.
+template<class T>
+struct alignas(Ohm::Simd::Alignment) BVHNode
+{
+	static constexpr size_t Width = 4;
+
+	constexpr bool IsLeaf(size_t aSlot) const { return count[aSlot] > 0; }
+
+	constexpr AABB<T> GetBounds(size_t aSlot) const;
+	// Bounds of all used slots.
+	constexpr AABB<T> GetBounds() const;
+	constexpr void SetBounds(size_t aSlot, const AABB<T>& aBox);
+
+	T minX[Width] = {};
+	T minY[Width] = {};
+	T minZ[Width] = {};
+	T maxX[Width] = {};
+	T maxY[Width] = {};
+	T maxZ[Width] = {};
+	uint32_t child[Width] = {};
+	uint32_t count[Width] = {};
+	uint32_t childCount = 0;
+};
+
+// Bounding volume hierarchy over an array of boxes. Built top-down with a binned SAH into a binary tree that is then
+// collapsed into 4 wide nodes, stored depth first so a parent always comes before its children.
+// Queries report primitives by their index in the array given to Build().
+template<class T>
+class BVH
+{
+public:
+	static constexpr uint32_t InvalidIndex = ~uint32_t(0);
+
+	BVH<T>() = default;
+	BVH<T>(const AABB<T>* aBoxes, size_t aCount, const BVHBuildOptions& aOptions = BVHBuildOptions());
+
+	void Build(const AABB<T>* aBoxes, size_t aCount, const BVHBuildOptions& aOptions = BVHBuildOptions());
+	// Updates all bounds for moved primitives, aBoxes in the order given to Build(). The topology is kept,
+	// so query speed degrades when primitives move far from where they were built.
+	void Refit(const AABB<T>* aBoxes);
+
+	size_t GetPrimitiveCount() const { return myPrimitiveOrder.size(); }
+	const std::vector<BVHNode<T>>& GetNodes() const { return myNodes; }
+	// Primitive indices in leaf order.
+	const std::vector<uint32_t>& GetPrimitiveOrder() const { return myPrimitiveOrder; }
+	AABB<T> GetBounds() const;
+
+	// Closest hit within [0, aInOutDistance]. aIntersect(index, inOutDistance) tests primitive index and, when it hits
+	// closer than inOutDistance, lowers it and returns true. Returns the index of the closest hit or InvalidIndex.
+	template<typename Intersect>
+	uint32_t Raycast(const Ray<T>& aRay, T& aInOutDistance, Intersect&& aIntersect) const;
+	// Closest hit against the primitive boxes themselves.
+	uint32_t Raycast(const Ray<T>& aRay, T& aInOutDistance) const;
+
+	// Calls aVisit(index) for every primitive whose box intersects aBox.
+	template<typename Visit>
+	void QueryOverlap(const AABB<T>& aBox, Visit&& aVisit) const;
+	// Calls aVisit(index) for every primitive whose box passes Frustum<T>::Intersects. Subtrees fully inside
+	// the frustum are reported without testing their primitives.
+	template<typename Visit>
+	void QueryFrustum(const Frustum<T>& aFrustum, Visit&& aVisit) const;
+
+private:
+	// Closest hit as a position in leaf order, aIntersect takes that position too.
+	template<typename Intersect>
+	uint32_t Traverse(const Ray<T>& aRay, T& aInOutDistance, Intersect&& aIntersect) const;
+
+	std::vector<BVHNode<T>> myNodes;
+	std::vector<uint32_t> myPrimitiveOrder;
+	// Primitive boxes in leaf order.
+	std::vector<AABB<T>> myPrimitiveBoxes;
+};
+
+namespace Ohm::Detail
+{
+	// Traversal stack that only allocates for unusually deep trees.
+	template<typename Entry>
+	class BVHStack
+	{
+	public:
+		bool IsEmpty() const { return mySize == 0; }
+
+		void Push(const Entry& aEntry)
+		{
+			if (mySize < InlineSize)
+			{
+				myInline[mySize] = aEntry;
+			}
+			else
+			{
+				mySpill.push_back(aEntry);
+			}
+			mySize++;
+		}
+
+		Entry Pop()
+		{
+			mySize--;
+			if (mySize < InlineSize)
+			{
+				return myInline[mySize];
+			}
+
+			const Entry entry = mySpill.back();
+			mySpill.pop_back();
+			return entry;
+		}
+
+	private:
+		static constexpr size_t InlineSize = 64;
+
+		Entry myInline[InlineSize];
+		size_t mySize = 0;
+		std::vector<Entry> mySpill;
+	};
+
+	template<typename T>
+	class BVHBuilder
+	{
+	public:
+		// Above this many primitives a subtree may go to its own thread.
+		static constexpr uint32_t ParallelThreshold = 4096;
+		static constexpr uint32_t MaxBinCount = 64;
+
+		BVHBuilder(const AABB<T>* aBoxes, size_t aCount, const BVHBuildOptions& aOptions)
+			: myOptions(aOptions), myPrimitives(aCount), myBinaryNodes(aCount > 0 ? aCount * 2 - 1 : 0)
+		{
+			assert(aOptions.binCount >= 2 && aOptions.binCount <= MaxBinCount && "Bin count out of range!");
+			assert(aOptions.maxLeafSize >= 1 && "Leaves need room for a primitive!");
+			assert(aCount < InvalidIndex / 2 && "Too many primitives!");
+
+			for (size_t i = 0; i < aCount; i++)
+			{
+				myPrimitives[i].box = aBoxes[i];
+				myPrimitives[i].centroid = aBoxes[i].GetCenter();
+				myPrimitives[i].index = static_cast<uint32_t>(i);
+			}
+		}
+
+		void Build(std::vector<BVHNode<T>>& aOutNodes, std::vector<uint32_t>& aOutOrder)
+		{
+			aOutNodes.clear();
+			if (!myPrimitives.empty())
+			{
+				// Every level of parallel subtrees doubles the task count, stop at a few tasks per thread so
+				// stealing can even out unbalanced splits.
+				int parallelDepth = 0;
+				if (myOptions.pool && myOptions.pool->GetWorkerCount() > 0)
+				{
+					for (size_t tasks = 1; tasks < myOptions.pool->GetThreadCount() * 4; tasks *= 2)
+					{
+						parallelDepth++;
+					}
+				}
+
+				BuildRange(0, static_cast<uint32_t>(myPrimitives.size()), 0, parallelDepth);
+				Collapse(0, aOutNodes);
+			}
+			aOutOrder.resize(myPrimitives.size());
+			for (size_t i = 0; i < myPrimitives.size(); i++)
+			{
+				aOutOrder[i] = myPrimitives[i].index;
+			}
+		}
+
+	private:
+		static constexpr uint32_t InvalidIndex = ~uint32_t(0);
+
+		struct BinaryNode
+		{
+			AABB<T> bounds;
+			uint32_t first = 0;
+			uint32_t count = 0;
+			// Binary node slots of the children, InvalidIndex for leaves.
+			uint32_t left = InvalidIndex;
+			uint32_t right = InvalidIndex;
+		};
+
+		// Everything the build reads about a primitive, partitioned in place so every level streams through memory.
+		struct Primitive
+		{
+			AABB<T> box;
+			Vector3<T> centroid;
+			uint32_t index;
+		};
+
+		struct Split
+		{
+			int axis = -1;
+			uint32_t bin = 0;
+			uint32_t binCount = 0;
+			T cost = std::numeric_limits<T>::max();
+		};
+
+		static T GetAxis(const Vector3<T>& aVector, int aAxis)
+		{
+			return aAxis == 0 ? aVector.x : aAxis == 1 ? aVector.y : aVector.z;
+		}
+
+		static uint32_t GetBin(const Vector3<T>& aCentroid, int aAxis, T aMin, T aScale, uint32_t aBinCount)
+		{
+			const T bin = (GetAxis(aCentroid, aAxis) - aMin) * aScale;
+			return static_cast<uint32_t>(Ohm::Math::Min(bin, static_cast<T>(aBinCount - 1)));
+		}
+
+		// Bin bounds as plain arrays, merging them is the hot loop of the build.
+		struct Bin
+		{
+			void Reset()
+			{
+				for (int axis = 0; axis < 3; axis++)
+				{
+					min[axis] = std::numeric_limits<T>::max();
+					max[axis] = std::numeric_limits<T>::lowest();
+				}
+				count = 0;
+			}
+
+			void Merge(const Bin& aBin)
+			{
+				for (int axis = 0; axis < 3; axis++)
+				{
+					min[axis] = Ohm::Math::Min(min[axis], aBin.min[axis]);
+					max[axis] = Ohm::Math::Max(max[axis], aBin.max[axis]);
+				}
+				count += aBin.count;
+			}
+
+			T GetSurfaceArea() const
+			{
+				const T x = max[0] - min[0];
+				const T y = max[1] - min[1];
+				const T z = max[2] - min[2];
+				return static_cast<T>(2) * (x * y + y * z + z * x);
+			}
+
+			T min[3];
+			T max[3];
+			uint32_t count;
+		};
+
+		// Binned SAH over all three axes, binned in one pass over the range. The cost is left area * left count +
+		// right area * right count, the constant traversal cost and the division by the parent area are left to the caller.
+		Split FindSplit(uint32_t aBegin, uint32_t aEnd, const AABB<T>& aCentroidBounds) const
+		{
+			// More bins than primitives only adds empty candidates, and small ranges are by far the most common.
+			const uint32_t binCount = Ohm::Math::Max(Ohm::Math::Min(myOptions.binCount, aEnd - aBegin), 2u);
+
+			T axisMin[3];
+			T scale[3];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				const T extent = GetAxis(aCentroidBounds.max, axis) - GetAxis(aCentroidBounds.min, axis);
+				axisMin[axis] = GetAxis(aCentroidBounds.min, axis);
+				scale[axis] = extent > static_cast<T>(0) ? static_cast<T>(binCount) / extent : static_cast<T>(0);
+			}
+
+			Bin bins[3][MaxBinCount];
+			for (int axis = 0; axis < 3; axis++)
+			{
+				for (uint32_t bin = 0; bin < binCount; bin++)
+				{
+					bins[axis][bin].Reset();
+				}
+			}
+
+			for (uint32_t i = aBegin; i < aEnd; i++)
+			{
+				const Primitive& primitive = myPrimitives[i];
+				const AABB<T>& box = primitive.box;
+				const T boxMin[3] = { box.min.x, box.min.y, box.min.z };
+				const T boxMax[3] = { box.max.x, box.max.y, box.max.z };
+				for (int axis = 0; axis < 3; axis++)
+				{
+					Bin& bin = bins[axis][GetBin(primitive.centroid, axis, axisMin[axis], scale[axis], binCount)];
+					for (int component = 0; component < 3; component++)
+					{
+						bin.min[component] = Ohm::Math::Min(bin.min[component], boxMin[component]);
+						bin.max[component] = Ohm::Math::Max(bin.max[component], boxMax[component]);
+					}
+					bin.count++;
+				}
+			}
+
+			Split best;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				if (scale[axis] == static_cast<T>(0))
+				{
+					continue;
+				}
+
+				// Right side costs swept from the top, then the left side is accumulated against them.
+				T rightCost[MaxBinCount];
+				Bin right;
+				right.Reset();
+				for (uint32_t bin = binCount - 1; bin > 0; bin--)
+				{
+					right.Merge(bins[axis][bin]);
+					rightCost[bin] = right.count > 0 ? right.GetSurfaceArea() * static_cast<T>(right.count) : static_cast<T>(0);
+				}
+
+				Bin left;
+				left.Reset();
+				for (uint32_t bin = 1; bin < binCount; bin++)
+				{
+					left.Merge(bins[axis][bin - 1]);
+					if (left.count == 0 || left.count == aEnd - aBegin)
+					{
+						continue;
+					}
+
+					const T cost = left.GetSurfaceArea() * static_cast<T>(left.count) + rightCost[bin];
+					if (cost < best.cost)
+					{
+						best.axis = axis;
+						best.bin = bin;
+						best.binCount = binCount;
+						best.cost = cost;
+					}
+				}
+			}
+			return best;
+		}
+
+		void BuildRange(uint32_t aBegin, uint32_t aEnd, uint32_t aSlot, int aParallelDepth)
+		{
+			BinaryNode& node = myBinaryNodes[aSlot];
+			AABB<T> centroidBounds;
+			for (uint32_t i = aBegin; i < aEnd; i++)
+			{
+				node.bounds.Merge(myPrimitives[i].box);
+				centroidBounds.Merge(myPrimitives[i].centroid);
+			}
+			node.first = aBegin;
+			node.count = aEnd - aBegin;
+			if (node.count == 1)
+			{
+				return;
+			}
+
+			// Splitting costs one traversal step, a leaf tests every primitive.
+			const Split split = FindSplit(aBegin, aEnd, centroidBounds);
+			const T leafCost = node.bounds.GetSurfaceArea() * static_cast<T>(node.count - 1);
+			if (node.count <= myOptions.maxLeafSize && (split.axis < 0 || split.cost >= leafCost))
+			{
+				return;
+			}
+
+			// Coinciding centroids can't be binned, any split of them is as good as another.
+			uint32_t middle = aBegin + node.count / 2;
+			if (split.axis >= 0)
+			{
+				const T axisMin = GetAxis(centroidBounds.min, split.axis);
+				const T scale = static_cast<T>(split.binCount) / (GetAxis(centroidBounds.max, split.axis) - axisMin);
+				const Primitive* partition = std::partition(myPrimitives.data() + aBegin, myPrimitives.data() + aEnd, [&](const Primitive& aPrimitive)
+				{
+					return GetBin(aPrimitive.centroid, split.axis, axisMin, scale, split.binCount) < split.bin;
+				});
+				middle = static_cast<uint32_t>(partition - myPrimitives.data());
+			}
+
+			// A range of n primitives needs at most 2n - 1 binary nodes, which fixes where each subtree is stored
+			// no matter which thread builds it.
+			node.left = aSlot + 1;
+			node.right = aSlot + 2 * (middle - aBegin);
+			const uint32_t left = node.left;
+			const uint32_t right = node.right;
+
+			if (aParallelDepth > 0 && node.count >= ParallelThreshold)
+			{
+				myOptions.pool->ParallelFor(2, 1, [&](size_t aSide, size_t)
+				{
+					if (aSide == 0)
+					{
+						BuildRange(aBegin, middle, left, aParallelDepth - 1);
+					}
+					else
+					{
+						BuildRange(middle, aEnd, right, aParallelDepth - 1);
+					}
+				});
+			}
+			else
+			{
+				BuildRange(aBegin, middle, left, 0);
+				BuildRange(middle, aEnd, right, 0);
+			}
+		}
+
+		// Turns the binary subtree at aSlot into 4 wide nodes by repeatedly opening the largest inner child,
+		// returns the index of the created node.
+		uint32_t Collapse(uint32_t aSlot, std::vector<BVHNode<T>>& aNodes) const
+		{
+			const uint32_t index = static_cast<uint32_t>(aNodes.size());
+			aNodes.emplace_back();
+
+			const BinaryNode& root = myBinaryNodes[aSlot];
+			uint32_t slots[BVHNode<T>::Width] = { aSlot };
+			uint32_t slotCount = 1;
+			if (root.left != InvalidIndex)
+			{
+				slots[0] = root.left;
+				slots[1] = root.right;
+				slotCount = 2;
+			}
+
+			while (slotCount < BVHNode<T>::Width)
+			{
+				int largest = -1;
+				T largestArea = static_cast<T>(-1);
+				for (uint32_t slot = 0; slot < slotCount; slot++)
+				{
+					const BinaryNode& child = myBinaryNodes[slots[slot]];
+					if (child.left != InvalidIndex && child.bounds.GetSurfaceArea() > largestArea)
+					{
+						largest = static_cast<int>(slot);
+						largestArea = child.bounds.GetSurfaceArea();
+					}
+				}
+				if (largest < 0)
+				{
+					break;
+				}
+
+				const BinaryNode& opened = myBinaryNodes[slots[largest]];
+				slots[largest] = opened.left;
+				slots[slotCount++] = opened.right;
+			}
+
+			aNodes[index].childCount = slotCount;
+			for (uint32_t slot = 0; slot < slotCount; slot++)
+			{
+				const BinaryNode& child = myBinaryNodes[slots[slot]];
+				aNodes[index].SetBounds(slot, child.bounds);
+				if (child.left == InvalidIndex)
+				{
+					aNodes[index].child[slot] = child.first;
+					aNodes[index].count[slot] = child.count;
+				}
+				else
+				{
+					// Not through a reference, the recursion grows the vector.
+					const uint32_t childIndex = Collapse(slots[slot], aNodes);
+					aNodes[index].child[slot] = childIndex;
+				}
+			}
+			return index;
+		}
+
+		BVHBuildOptions myOptions;
+		std::vector<Primitive> myPrimitives;
+		std::vector<BinaryNode> myBinaryNodes;
+	};
+
+	// Slab test of one ray against the child boxes of a node, returns a bit per slot hit within [0, aMaxDistance]
+	// and writes the entry distances to aOutNear.
+	template<typename T, typename Lane>
+	inline unsigned IntersectNodeRay(const BVHNode<T>& aNode, const typename Lane::Type aOrigin[3], const typename Lane::Type aInverseDirection[3], T aMaxDistance, T aOutNear[BVHNode<T>::Width])
+	{
+		using Pack = typename Lane::Type;
+
+		unsigned hits = 0;
+		for (size_t slot = 0; slot < BVHNode<T>::Width; slot += Lane::Width)
+		{
+			const Pack t1x = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.minX + slot), aOrigin[0]), aInverseDirection[0]);
+			const Pack t2x = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.maxX + slot), aOrigin[0]), aInverseDirection[0]);
+			const Pack t1y = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.minY + slot), aOrigin[1]), aInverseDirection[1]);
+			const Pack t2y = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.maxY + slot), aOrigin[1]), aInverseDirection[1]);
+			const Pack t1z = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.minZ + slot), aOrigin[2]), aInverseDirection[2]);
+			const Pack t2z = Lane::Multiply(Lane::Subtract(Lane::Load(aNode.maxZ + slot), aOrigin[2]), aInverseDirection[2]);
+
+			Pack nearDistance = Lane::Max(Lane::Set(static_cast<T>(0)), Lane::Min(t1x, t2x));
+			nearDistance = Lane::Max(nearDistance, Lane::Min(t1y, t2y));
+			nearDistance = Lane::Max(nearDistance, Lane::Min(t1z, t2z));
+			Pack farDistance = Lane::Min(Lane::Set(aMaxDistance), Lane::Max(t1x, t2x));
+			farDistance = Lane::Min(farDistance, Lane::Max(t1y, t2y));
+			farDistance = Lane::Min(farDistance, Lane::Max(t1z, t2z));
+
+			Lane::Store(aOutNear + slot, nearDistance);
+			hits |= Lane::NonNegativeMask(Lane::Subtract(farDistance, nearDistance)) << slot;
+		}
+		return hits;
+	}
+
+	template<typename T, typename Lane>
+	inline unsigned IntersectNodeAABB(const BVHNode<T>& aNode, const AABB<T>& aBox)
+	{
+		using Pack = typename Lane::Type;
+
+		unsigned hits = 0;
+		for (size_t slot = 0; slot < BVHNode<T>::Width; slot += Lane::Width)
+		{
+			// Overlap on every axis when none of the six separations is negative.
+			Pack separation = Lane::Subtract(Lane::Load(aNode.maxX + slot), Lane::Set(aBox.min.x));
+			separation = Lane::Min(separation, Lane::Subtract(Lane::Set(aBox.max.x), Lane::Load(aNode.minX + slot)));
+			separation = Lane::Min(separation, Lane::Subtract(Lane::Load(aNode.maxY + slot), Lane::Set(aBox.min.y)));
+			separation = Lane::Min(separation, Lane::Subtract(Lane::Set(aBox.max.y), Lane::Load(aNode.minY + slot)));
+			separation = Lane::Min(separation, Lane::Subtract(Lane::Load(aNode.maxZ + slot), Lane::Set(aBox.min.z)));
+			separation = Lane::Min(separation, Lane::Subtract(Lane::Set(aBox.max.z), Lane::Load(aNode.minZ + slot)));
+			hits |= Lane::NonNegativeMask(separation) << slot;
+		}
+		return hits;
+	}
+
+	// Frustum planes broadcast once per query: x, y, z, w, |x|, |y|, |z|.
+	template<typename T, typename Lane>
+	struct BVHFrustumPlanes
+	{
+		static constexpr int PlaneCount = static_cast<int>(FrustumPlane::Count);
+
+		explicit BVHFrustumPlanes(const Frustum<T>& aFrustum)
+		{
+			for (int plane = 0; plane < PlaneCount; plane++)
+			{
+				const Vector4<T>& value = aFrustum.GetPlane(static_cast<FrustumPlane>(plane));
+				components[plane][0] = Lane::Set(value.x);
+				components[plane][1] = Lane::Set(value.y);
+				components[plane][2] = Lane::Set(value.z);
+				components[plane][3] = Lane::Set(value.w);
+				components[plane][4] = Lane::Set(Ohm::Math::Abs(value.x));
+				components[plane][5] = Lane::Set(Ohm::Math::Abs(value.y));
+				components[plane][6] = Lane::Set(Ohm::Math::Abs(value.z));
+			}
+		}
+
+		typename Lane::Type components[PlaneCount][7];
+	};
+
+	// Bits of slots that pass the conservative frustum test, aOutInside gets the slots fully inside every plane.
+	template<typename T, typename Lane>
+	inline unsigned IntersectNodeFrustum(const BVHNode<T>& aNode, const BVHFrustumPlanes<T, Lane>& aPlanes, unsigned& aOutInside)
+	{
+		using Pack = typename Lane::Type;
+
+		unsigned hits = 0;
+		aOutInside = 0;
+		for (size_t slot = 0; slot < BVHNode<T>::Width; slot += Lane::Width)
+		{
+			const Pack half = Lane::Set(static_cast<T>(0.5));
+			const Pack minX = Lane::Load(aNode.minX + slot);
+			const Pack minY = Lane::Load(aNode.minY + slot);
+			const Pack minZ = Lane::Load(aNode.minZ + slot);
+			const Pack maxX = Lane::Load(aNode.maxX + slot);
+			const Pack maxY = Lane::Load(aNode.maxY + slot);
+			const Pack maxZ = Lane::Load(aNode.maxZ + slot);
+			const Pack centerX = Lane::Multiply(Lane::Add(minX, maxX), half);
+			const Pack centerY = Lane::Multiply(Lane::Add(minY, maxY), half);
+			const Pack centerZ = Lane::Multiply(Lane::Add(minZ, maxZ), half);
+			const Pack extentX = Lane::Multiply(Lane::Subtract(maxX, minX), half);
+			const Pack extentY = Lane::Multiply(Lane::Subtract(maxY, minY), half);
+			const Pack extentZ = Lane::Multiply(Lane::Subtract(maxZ, minZ), half);
+
+			Pack outside = Lane::Set(std::numeric_limits<T>::max());
+			Pack inside = outside;
+			for (int plane = 0; plane < BVHFrustumPlanes<T, Lane>::PlaneCount; plane++)
+			{
+				const Pack* components = aPlanes.components[plane];
+				Pack distance = Lane::MultiplyAdd(centerX, components[0], components[3]);
+				distance = Lane::MultiplyAdd(centerY, components[1], distance);
+				distance = Lane::MultiplyAdd(centerZ, components[2], distance);
+				Pack radius = Lane::Multiply(extentX, components[4]);
+				radius = Lane::MultiplyAdd(extentY, components[5], radius);
+				radius = Lane::MultiplyAdd(extentZ, components[6], radius);
+				outside = Lane::Min(outside, Lane::Add(distance, radius));
+				inside = Lane::Min(inside, Lane::Subtract(distance, radius));
+			}
+			hits |= Lane::NonNegativeMask(outside) << slot;
+			aOutInside |= Lane::NonNegativeMask(inside) << slot;
+		}
+		return hits;
+	}
+
+	constexpr unsigned BVHSlotMask(uint32_t aChildCount)
+	{
+		return (1u << aChildCount) - 1u;
+	}
+}
+
+template<class T>
+constexpr AABB<T> BVHNode<T>::GetBounds(size_t aSlot) const
+{
+	return AABB<T>(Vector3<T>(minX[aSlot], minY[aSlot], minZ[aSlot]), Vector3<T>(maxX[aSlot], maxY[aSlot], maxZ[aSlot]));
+}
+
+template<class T>
+constexpr AABB<T> BVHNode<T>::GetBounds() const
+{
+	AABB<T> bounds;
+	for (size_t slot = 0; slot < childCount; slot++)
+	{
+		bounds.Merge(GetBounds(slot));
+	}
+	return bounds;
+}
+
+template<class T>
+constexpr void BVHNode<T>::SetBounds(size_t aSlot, const AABB<T>& aBox)
+{
+	minX[aSlot] = aBox.min.x;
+	minY[aSlot] = aBox.min.y;
+	minZ[aSlot] = aBox.min.z;
+	maxX[aSlot] = aBox.max.x;
+	maxY[aSlot] = aBox.max.y;
+	maxZ[aSlot] = aBox.max.z;
+}
+
+template<class T>
+inline BVH<T>::BVH(const AABB<T>* aBoxes, size_t aCount, const BVHBuildOptions& aOptions)
+{
+	Build(aBoxes, aCount, aOptions);
+}
+
+template<class T>
+inline void BVH<T>::Build(const AABB<T>* aBoxes, size_t aCount, const BVHBuildOptions& aOptions)
+{
+	Ohm::Detail::BVHBuilder<T>(aBoxes, aCount, aOptions).Build(myNodes, myPrimitiveOrder);
+
+	myPrimitiveBoxes.resize(aCount);
+	for (size_t i = 0; i < aCount; i++)
+	{
+		myPrimitiveBoxes[i] = aBoxes[myPrimitiveOrder[i]];
+	}
+}
+
+template<class T>
+inline void BVH<T>::Refit(const AABB<T>* aBoxes)
+{
+	for (size_t i = 0; i < myPrimitiveOrder.size(); i++)
+	{
+		myPrimitiveBoxes[i] = aBoxes[myPrimitiveOrder[i]];
+	}
+
+	// Children are stored after their parents, so walking backwards sees every child before its parent.
+	for (size_t i = myNodes.size(); i-- > 0;)
+	{
+		BVHNode<T>& node = myNodes[i];
+		for (size_t slot = 0; slot < node.childCount; slot++)
+		{
+			AABB<T> bounds;
+			if (node.IsLeaf(slot))
+			{
+				for (uint32_t primitive = node.child[slot]; primitive < node.child[slot] + node.count[slot]; primitive++)
+				{
+					bounds.Merge(myPrimitiveBoxes[primitive]);
+				}
+			}
+			else
+			{
+				bounds = myNodes[node.child[slot]].GetBounds();
+			}
+			node.SetBounds(slot, bounds);
+		}
+	}
+}
+
+template<class T>
+inline AABB<T> BVH<T>::GetBounds() const
+{
+	return myNodes.empty() ? AABB<T>() : myNodes[0].GetBounds();
+}
+
+template<class T>
+template<typename Intersect>
+inline uint32_t BVH<T>::Traverse(const Ray<T>& aRay, T& aInOutDistance, Intersect&& aIntersect) const
+{
+	using Lane = typename Ohm::Simd::FourWideLane<T>::Type;
+	using Pack = typename Lane::Type;
+
+	if (myNodes.empty())
+	{
+		return InvalidIndex;
+	}
+
+	const Pack origin[3] = { Lane::Set(aRay.origin.x), Lane::Set(aRay.origin.y), Lane::Set(aRay.origin.z) };
+	const Pack inverseDirection[3] =
+	{
+		Lane::Set(static_cast<T>(1) / aRay.direction.x),
+		Lane::Set(static_cast<T>(1) / aRay.direction.y),
+		Lane::Set(static_cast<T>(1) / aRay.direction.z)
+	};
+
+	// Inner nodes have count 0, leaves are a range of the primitive order.
+	struct Entry
+	{
+		uint32_t index;
+		uint32_t count;
+		T distance;
+	};
+
+	Ohm::Detail::BVHStack<Entry> stack;
+	stack.Push({ 0, 0, static_cast<T>(0) });
+	uint32_t closest = InvalidIndex;
+	while (!stack.IsEmpty())
+	{
+		const Entry entry = stack.Pop();
+		if (entry.distance > aInOutDistance)
+		{
+			continue;
+		}
+
+		if (entry.count > 0)
+		{
+			for (uint32_t primitive = entry.index; primitive < entry.index + entry.count; primitive++)
+			{
+				if (aIntersect(primitive, aInOutDistance))
+				{
+					closest = primitive;
+				}
+			}
+			continue;
+		}
+
+		const BVHNode<T>& node = myNodes[entry.index];
+		alignas(Ohm::Simd::Alignment) T nearDistance[BVHNode<T>::Width];
+		unsigned hits = Ohm::Detail::IntersectNodeRay<T, Lane>(node, origin, inverseDirection, aInOutDistance, nearDistance);
+		hits &= Ohm::Detail::BVHSlotMask(node.childCount);
+
+		// Hit slots sorted far to near, so the nearest is popped first.
+		Entry children[BVHNode<T>::Width];
+		size_t childCount = 0;
+		for (uint32_t slot = 0; slot < BVHNode<T>::Width; slot++)
+		{
+			if ((hits & (1u << slot)) == 0)
+			{
+				continue;
+			}
+
+			const Entry child = { node.child[slot], node.count[slot], nearDistance[slot] };
+			size_t position = childCount++;
+			for (; position > 0 && children[position - 1].distance < child.distance; position--)
+			{
+				children[position] = children[position - 1];
+			}
+			children[position] = child;
+		}
+
+		for (size_t i = 0; i < childCount; i++)
+		{
+			stack.Push(children[i]);
+		}
+	}
+	return closest;
+}
+
+template<class T>
+template<typename Intersect>
+inline uint32_t BVH<T>::Raycast(const Ray<T>& aRay, T& aInOutDistance, Intersect&& aIntersect) const
+{
+	const uint32_t closest = Traverse(aRay, aInOutDistance, [&](uint32_t aPrimitive, T& aDistance)
+	{
+		return aIntersect(myPrimitiveOrder[aPrimitive], aDistance);
+	});
+	return closest == InvalidIndex ? InvalidIndex : myPrimitiveOrder[closest];
+}
+
+template<class T>
+inline uint32_t BVH<T>::Raycast(const Ray<T>& aRay, T& aInOutDistance) const
+{
+	const uint32_t closest = Traverse(aRay, aInOutDistance, [&](uint32_t aPrimitive, T& aDistance)
+	{
+		T distance = static_cast<T>(0);
+		if (aRay.Intersects(myPrimitiveBoxes[aPrimitive], distance) && distance <= aDistance)
+		{
+			aDistance = distance;
+			return true;
+		}
+		return false;
+	});
+	return closest == InvalidIndex ? InvalidIndex : myPrimitiveOrder[closest];
+}
+
+template<class T>
+template<typename Visit>
+inline void BVH<T>::QueryOverlap(const AABB<T>& aBox, Visit&& aVisit) const
+{
+	using Lane = typename Ohm::Simd::FourWideLane<T>::Type;
+
+	if (myNodes.empty())
+	{
+		return;
+	}
+
+	Ohm::Detail::BVHStack<uint32_t> stack;
+	stack.Push(0);
+	while (!stack.IsEmpty())
+	{
+		const BVHNode<T>& node = myNodes[stack.Pop()];
+		unsigned hits = Ohm::Detail::IntersectNodeAABB<T, Lane>(node, aBox);
+		hits &= Ohm::Detail::BVHSlotMask(node.childCount);
+
+		for (uint32_t slot = 0; slot < BVHNode<T>::Width; slot++)
+		{
+			if ((hits & (1u << slot)) == 0)
+			{
+				continue;
+			}
+
+			if (!node.IsLeaf(slot))
+			{
+				stack.Push(node.child[slot]);
+				continue;
+			}
+
+			for (uint32_t primitive = node.child[slot]; primitive < node.child[slot] + node.count[slot]; primitive++)
+			{
+				if (myPrimitiveBoxes[primitive].Intersects(aBox))
+				{
+					aVisit(myPrimitiveOrder[primitive]);
+				}
+			}
+		}
+	}
+}
+
+template<class T>
+template<typename Visit>
+inline void BVH<T>::QueryFrustum(const Frustum<T>& aFrustum, Visit&& aVisit) const
+{
+	using Lane = typename Ohm::Simd::FourWideLane<T>::Type;
+
+	if (myNodes.empty())
+	{
+		return;
+	}
+
+	// Nodes known to be inside the frustum skip the plane tests for their whole subtree.
+	struct Entry
+	{
+		uint32_t index;
+		bool inside;
+	};
+
+	const Ohm::Detail::BVHFrustumPlanes<T, Lane> planes(aFrustum);
+	Ohm::Detail::BVHStack<Entry> stack;
+	stack.Push({ 0, false });
+	while (!stack.IsEmpty())
+	{
+		const Entry entry = stack.Pop();
+		const BVHNode<T>& node = myNodes[entry.index];
+
+		unsigned inside = Ohm::Detail::BVHSlotMask(node.childCount);
+		unsigned hits = inside;
+		if (!entry.inside)
+		{
+			hits &= Ohm::Detail::IntersectNodeFrustum<T, Lane>(node, planes, inside);
+		}
+
+		for (uint32_t slot = 0; slot < BVHNode<T>::Width; slot++)
+		{
+			if ((hits & (1u << slot)) == 0)
+			{
+				continue;
+			}
+
+			const bool slotInside = (inside & (1u << slot)) != 0;
+			if (!node.IsLeaf(slot))
+			{
+				stack.Push({ node.child[slot], slotInside });
+				continue;
+			}
+
+			for (uint32_t primitive = node.child[slot]; primitive < node.child[slot] + node.count[slot]; primitive++)
+			{
+				if (slotInside || aFrustum.Intersects(myPrimitiveBoxes[primitive]))
+				{
+					aVisit(myPrimitiveOrder[primitive]);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Ohm/Geometry/AABB.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Vector/Vector4.hpp"
+
+#include <cassert>
+
+// Clip space depth range of the projection the frustum is extracted from.
+// Matrix4x4<T>::CreatePerspective maps depth to [0, 1].
+enum class ClipDepth
+{
+	ZeroToOne,
+	MinusOneToOne
+};
+
+enum class FrustumPlane
+{
+	Left,
+	Right,
+	Bottom,
+	Top,
+	Near,
+	Far,
+	Count
+};
+
+// View frustum as six inward facing planes, extracted from a (view-)projection matrix with the
+// Gribb-Hartmann method: with row vectors clip = v * M, so every clip plane is a sum of matrix columns.
+// Planes are stored as (normal, distance) with unit length normals, a point p is inside when p.Dot(normal) + distance >= 0.
+// Sphere and box tests are conservative: objects near a frustum corner may be reported as intersecting while outside.
+template<class T>
+class Frustum
+{
+public:
+	constexpr Frustum<T>() = default;
+	constexpr Frustum<T>(const Matrix4x4<T>& aViewProjection, ClipDepth aDepth = ClipDepth::ZeroToOne);
+
+	constexpr const Vector4<T>& GetPlane(FrustumPlane aPlane) const;
+
+	constexpr bool Contains(const Vector3<T>& aPoint) const;
+	constexpr bool IntersectsSphere(const Vector3<T>& aCenter, T aRadius) const;
+	constexpr bool Intersects(const AABB<T>& aBox) const;
+
+private:
+	Vector4<T> myPlanes[static_cast<int>(FrustumPlane::Count)];
+};
+
+template<class T>
+constexpr Frustum<T>::Frustum(const Matrix4x4<T>& aViewProjection, ClipDepth aDepth)
+{
+	const auto column = [&](int aColumn)
+	{
+		return Vector4<T>(aViewProjection(1, aColumn), aViewProjection(2, aColumn), aViewProjection(3, aColumn), aViewProjection(4, aColumn));
+	};
+
+	const Vector4<T> x = column(1);
+	const Vector4<T> y = column(2);
+	const Vector4<T> z = column(3);
+	const Vector4<T> w = column(4);
+
+	myPlanes[static_cast<int>(FrustumPlane::Left)] = w + x;
+	myPlanes[static_cast<int>(FrustumPlane::Right)] = w - x;
+	myPlanes[static_cast<int>(FrustumPlane::Bottom)] = w + y;
+	myPlanes[static_cast<int>(FrustumPlane::Top)] = w - y;
+	myPlanes[static_cast<int>(FrustumPlane::Near)] = aDepth == ClipDepth::ZeroToOne ? z : w + z;
+	myPlanes[static_cast<int>(FrustumPlane::Far)] = w - z;
+
+	for (Vector4<T>& plane : myPlanes)
+	{
+		const T length = Ohm::Math::Sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		assert(length > static_cast<T>(0) && "Degenerate projection matrix!");
+		plane = plane / length;
+	}
+}
+
+template<class T>
+constexpr const Vector4<T>& Frustum<T>::GetPlane(FrustumPlane aPlane) const
+{
+	assert(aPlane != FrustumPlane::Count && "Index out of bounds!");
+	return myPlanes[static_cast<int>(aPlane)];
+}
+
+template<class T>
+constexpr bool Frustum<T>::Contains(const Vector3<T>& aPoint) const
+{
+	return IntersectsSphere(aPoint, static_cast<T>(0));
+}
+
+template<class T>
+constexpr bool Frustum<T>::IntersectsSphere(const Vector3<T>& aCenter, T aRadius) const
+{
+	for (const Vector4<T>& plane : myPlanes)
+	{
+		if (aCenter.x * plane.x + aCenter.y * plane.y + aCenter.z * plane.z + plane.w < -aRadius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<class T>
+constexpr bool Frustum<T>::Intersects(const AABB<T>& aBox) const
+{
+	const Vector3<T> center = aBox.GetCenter();
+	const Vector3<T> extents = aBox.GetExtents();
+
+	// The box is outside a plane when its center is further behind it than the box's projected radius.
+	for (const Vector4<T>& plane : myPlanes)
+	{
+		const T distance = center.x * plane.x + center.y * plane.y + center.z * plane.z + plane.w;
+		const T radius = extents.x * Ohm::Math::Abs(plane.x) + extents.y * Ohm::Math::Abs(plane.y) + extents.z * Ohm::Math::Abs(plane.z);
+		if (distance < -radius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Ohm/Geometry/AABBBatch.hpp"
+#include "Ohm/Geometry/Frustum.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Batch frustum culling over SoA streams, 4 (SSE) or 8 (AVX) objects per step against all six planes.
+// The result is a visibility bitmask: bit i % 64 of aOutVisible[i / 64] is set when object i passes the same
+// conservative test as the single object Frustum<T> functions, up to rounding for objects exactly touching a plane.
+// aOutVisible must hold Ohm::Simd::MaskWordCount(count) words.
+
+namespace Ohm::Detail
+{
+	// Plane components repeated across a whole pack (8 wide covers AVX), so the kernels load them
+	// with a plain vector load instead of broadcasting every step.
+	template<typename T>
+	struct FrustumPlanes
+	{
+		static constexpr int PlaneCount = static_cast<int>(FrustumPlane::Count);
+		static constexpr size_t Width = 8;
+
+		explicit FrustumPlanes(const Frustum<T>& aFrustum)
+		{
+			for (int plane = 0; plane < PlaneCount; plane++)
+			{
+				const Vector4<T>& value = aFrustum.GetPlane(static_cast<FrustumPlane>(plane));
+				std::fill(x[plane], x[plane] + Width, value.x);
+				std::fill(y[plane], y[plane] + Width, value.y);
+				std::fill(z[plane], z[plane] + Width, value.z);
+				std::fill(w[plane], w[plane] + Width, value.w);
+				std::fill(absX[plane], absX[plane] + Width, Ohm::Math::Abs(value.x));
+				std::fill(absY[plane], absY[plane] + Width, Ohm::Math::Abs(value.y));
+				std::fill(absZ[plane], absZ[plane] + Width, Ohm::Math::Abs(value.z));
+			}
+		}
+
+		alignas(Ohm::Simd::Alignment) T x[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T y[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T z[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T w[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T absX[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T absY[PlaneCount][Width];
+		alignas(Ohm::Simd::Alignment) T absZ[PlaneCount][Width];
+	};
+}
+
+// Spheres given as center streams plus aRadii[i].
+template<typename T>
+inline void CullSpheres(const Frustum<T>& aFrustum, const Vector3SoA<T>& aCenters, const T* aRadii, uint64_t* aOutVisible)
+{
+	const Ohm::Detail::FrustumPlanes<T> planes(aFrustum);
+	const T* centerX = aCenters.X();
+	const T* centerY = aCenters.Y();
+	const T* centerZ = aCenters.Z();
+
+	Ohm::Simd::ForEachLaneMask<T>(aCenters.Size(), aOutVisible, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using Pack = typename Lane::Type;
+
+		const Pack x = Lane::Load(centerX + i);
+		const Pack y = Lane::Load(centerY + i);
+		const Pack z = Lane::Load(centerZ + i);
+		const Pack radius = Lane::Load(aRadii + i);
+
+		// Visible when distance + radius is non-negative for every plane, so only the smallest one is tested.
+		Pack closest = Lane::Set(std::numeric_limits<T>::max());
+		for (int plane = 0; plane < Ohm::Detail::FrustumPlanes<T>::PlaneCount; plane++)
+		{
+			Pack distance = Lane::MultiplyAdd(x, Lane::Load(planes.x[plane]), Lane::Load(planes.w[plane]));
+			distance = Lane::MultiplyAdd(y, Lane::Load(planes.y[plane]), distance);
+			distance = Lane::MultiplyAdd(z, Lane::Load(planes.z[plane]), distance);
+			closest = Lane::Min(closest, distance);
+		}
+		return Lane::NonNegativeMask(Lane::Add(closest, radius));
+	});
+}
+
+template<typename T>
+inline void CullAABBs(const Frustum<T>& aFrustum, const AABBSoA<T>& aBoxes, uint64_t* aOutVisible)
+{
+	const Ohm::Detail::FrustumPlanes<T> planes(aFrustum);
+	const Vector3SoA<T>& boxMin = aBoxes.Min();
+	const Vector3SoA<T>& boxMax = aBoxes.Max();
+
+	Ohm::Simd::ForEachLaneMask<T>(aBoxes.Size(), aOutVisible, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using Pack = typename Lane::Type;
+
+		const Pack half = Lane::Set(static_cast<T>(0.5));
+		const Pack minX = Lane::Load(boxMin.X() + i);
+		const Pack minY = Lane::Load(boxMin.Y() + i);
+		const Pack minZ = Lane::Load(boxMin.Z() + i);
+		const Pack maxX = Lane::Load(boxMax.X() + i);
+		const Pack maxY = Lane::Load(boxMax.Y() + i);
+		const Pack maxZ = Lane::Load(boxMax.Z() + i);
+		const Pack centerX = Lane::Multiply(Lane::Add(minX, maxX), half);
+		const Pack centerY = Lane::Multiply(Lane::Add(minY, maxY), half);
+		const Pack centerZ = Lane::Multiply(Lane::Add(minZ, maxZ), half);
+		const Pack extentX = Lane::Multiply(Lane::Subtract(maxX, minX), half);
+		const Pack extentY = Lane::Multiply(Lane::Subtract(maxY, minY), half);
+		const Pack extentZ = Lane::Multiply(Lane::Subtract(maxZ, minZ), half);
+
+		// distance + projected radius per plane, the box is visible when none of them is negative.
+		Pack closest = Lane::Set(std::numeric_limits<T>::max());
+		for (int plane = 0; plane < Ohm::Detail::FrustumPlanes<T>::PlaneCount; plane++)
+		{
+			Pack distance = Lane::MultiplyAdd(centerX, Lane::Load(planes.x[plane]), Lane::Load(planes.w[plane]));
+			distance = Lane::MultiplyAdd(centerY, Lane::Load(planes.y[plane]), distance);
+			distance = Lane::MultiplyAdd(centerZ, Lane::Load(planes.z[plane]), distance);
+			distance = Lane::MultiplyAdd(extentX, Lane::Load(planes.absX[plane]), distance);
+			distance = Lane::MultiplyAdd(extentY, Lane::Load(planes.absY[plane]), distance);
+			distance = Lane::MultiplyAdd(extentZ, Lane::Load(planes.absZ[plane]), distance);
+			closest = Lane::Min(closest, distance);
+		}
+		return Lane::NonNegativeMask(closest);
+	});
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Vector/Vector4.hpp"
+
+// Plane through all points p with normal.Dot(p) + distance == 0, the same form as the Frustum<T> planes.
+// The normal points to the positive side. Distances are only metric when the normal is unit length.
+template<class T>
+class Plane
+{
+public:
+	constexpr Plane<T>();
+	constexpr Plane<T>(const Vector3<T>& aNormal, T aDistance);
+	explicit constexpr Plane<T>(const Vector4<T>& aPlane);
+
+	static constexpr Plane<T> FromPointNormal(const Vector3<T>& aPoint, const Vector3<T>& aNormal);
+	// Counter-clockwise aA, aB, aC (seen from the positive side), the normal is normalized.
+	static constexpr Plane<T> FromPoints(const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC);
+
+	constexpr T SignedDistance(const Vector3<T>& aPoint) const;
+	constexpr Vector3<T> ClosestPoint(const Vector3<T>& aPoint) const;
+	constexpr Plane<T> GetNormalized() const;
+
+	Vector3<T> normal;
+	T distance;
+};
+
+template<class T>
+constexpr Plane<T>::Plane()
+	: normal(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0)), distance(static_cast<T>(0))
+{
+}
+
+template<class T>
+constexpr Plane<T>::Plane(const Vector3<T>& aNormal, T aDistance)
+	: normal(aNormal), distance(aDistance)
+{
+}
+
+template<class T>
+constexpr Plane<T>::Plane(const Vector4<T>& aPlane)
+	: normal(aPlane.x, aPlane.y, aPlane.z), distance(aPlane.w)
+{
+}
+
+template<class T>
+constexpr Plane<T> Plane<T>::FromPointNormal(const Vector3<T>& aPoint, const Vector3<T>& aNormal)
+{
+	return Plane<T>(aNormal, -aNormal.Dot(aPoint));
+}
+
+template<class T>
+constexpr Plane<T> Plane<T>::FromPoints(const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC)
+{
+	return FromPointNormal(aA, (aB - aA).Cross(aC - aA).GetNormalized());
+}
+
+template<class T>
+constexpr T Plane<T>::SignedDistance(const Vector3<T>& aPoint) const
+{
+	return normal.Dot(aPoint) + distance;
+}
+
+template<class T>
+constexpr Vector3<T> Plane<T>::ClosestPoint(const Vector3<T>& aPoint) const
+{
+	return aPoint - normal * (SignedDistance(aPoint) / normal.LengthSqr());
+}
+
+template<class T>
+constexpr Plane<T> Plane<T>::GetNormalized() const
+{
+	const T length = normal.Length();
+	return Plane<T>(normal / length, distance / length);
+}
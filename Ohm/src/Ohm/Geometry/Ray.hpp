@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Ohm/Geometry/AABB.hpp"
+#include "Ohm/Geometry/Plane.hpp"
+#include "Ohm/Geometry/Sphere.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+#include <limits>
+
+// Half line origin + direction * distance for distance >= 0. The direction does not have to be unit length,
+// hit distances are measured in multiples of it.
+template<class T>
+class Ray
+{
+public:
+	constexpr Ray<T>();
+	constexpr Ray<T>(const Vector3<T>& aOrigin, const Vector3<T>& aDirection);
+
+	constexpr Vector3<T> GetPoint(T aDistance) const;
+
+	// Each test reports the nearest hit at distance >= 0 and only writes aOutDistance on a hit.
+	// A ray starting inside a box or sphere hits at distance 0.
+	bool Intersects(const AABB<T>& aBox, T& aOutDistance) const;
+	bool Intersects(const Sphere<T>& aSphere, T& aOutDistance) const;
+	// Both sides of the plane, a ray lying in the plane misses.
+	bool Intersects(const Plane<T>& aPlane, T& aOutDistance) const;
+	// Moller-Trumbore, both faces count and degenerate triangles miss.
+	bool IntersectsTriangle(const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC, T& aOutDistance) const;
+
+	Vector3<T> origin;
+	Vector3<T> direction;
+};
+
+// Intersection kernels written once against the lane interface, Ray<T> runs them through ScalarLane and
+// the RaySoA packets through FloatPackLane. Each returns a value that is >= 0 exactly where the ray hits
+// within [0, aMaxDistance] and writes the hit distance to aOutDistance (meaningless for misses).
+// A ray that grazes a box face while parallel to it may hit or miss depending on the path.
+namespace Ohm::Detail
+{
+	template<typename T, typename Lane, typename Pack>
+	inline void LaneSet(const Vector3<T>& aVector, Pack aOut[3])
+	{
+		aOut[0] = Lane::Set(aVector.x);
+		aOut[1] = Lane::Set(aVector.y);
+		aOut[2] = Lane::Set(aVector.z);
+	}
+
+	// Slab test, clips [0, aMaxDistance] against the three pairs of box planes.
+	template<typename T, typename Lane, typename Pack>
+	inline Pack IntersectRayAABB(const Pack aOrigin[3], const Pack aInverseDirection[3], const AABB<T>& aBox, Pack aMaxDistance, Pack& aOutDistance)
+	{
+		Pack boxMin[3];
+		Pack boxMax[3];
+		LaneSet<T, Lane>(aBox.min, boxMin);
+		LaneSet<T, Lane>(aBox.max, boxMax);
+
+		Pack nearDistance = Lane::Set(static_cast<T>(0));
+		Pack farDistance = aMaxDistance;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			const Pack t1 = Lane::Multiply(Lane::Subtract(boxMin[axis], aOrigin[axis]), aInverseDirection[axis]);
+			const Pack t2 = Lane::Multiply(Lane::Subtract(boxMax[axis], aOrigin[axis]), aInverseDirection[axis]);
+			nearDistance = Lane::Max(nearDistance, Lane::Min(t1, t2));
+			farDistance = Lane::Min(farDistance, Lane::Max(t1, t2));
+		}
+
+		aOutDistance = nearDistance;
+		return Lane::Subtract(farDistance, nearDistance);
+	}
+
+	template<typename T, typename Lane, typename Pack>
+	inline Pack IntersectRaySphere(const Pack aOrigin[3], const Pack aDirection[3], const Sphere<T>& aSphere, Pack aMaxDistance, Pack& aOutDistance)
+	{
+		Pack center[3];
+		LaneSet<T, Lane>(aSphere.center, center);
+		const Pack offset[3] = { Lane::Subtract(aOrigin[0], center[0]), Lane::Subtract(aOrigin[1], center[1]), Lane::Subtract(aOrigin[2], center[2]) };
+
+		// Roots of a t^2 + 2 b t + c.
+		const Pack a = Ohm::Simd::LaneDot<Lane>(aDirection, aDirection);
+		const Pack b = Ohm::Simd::LaneDot<Lane>(offset, aDirection);
+		const Pack c = Lane::Subtract(Ohm::Simd::LaneDot<Lane>(offset, offset), Lane::Set(aSphere.radius * aSphere.radius));
+		const Pack discriminant = Lane::Subtract(Lane::Multiply(b, b), Lane::Multiply(a, c));
+		const Pack root = Lane::Sqrt(Lane::Max(discriminant, Lane::Set(static_cast<T>(0))));
+
+		const Pack minusB = Lane::Subtract(Lane::Set(static_cast<T>(0)), b);
+		const Pack nearDistance = Lane::Max(Lane::Divide(Lane::Subtract(minusB, root), a), Lane::Set(static_cast<T>(0)));
+		const Pack farDistance = Lane::Divide(Lane::Add(minusB, root), a);
+
+		aOutDistance = nearDistance;
+		return Lane::Min(Lane::Min(discriminant, Lane::Subtract(farDistance, nearDistance)), Lane::Subtract(aMaxDistance, nearDistance));
+	}
+
+	template<typename T, typename Lane, typename Pack>
+	inline Pack IntersectRayPlane(const Pack aOrigin[3], const Pack aDirection[3], const Plane<T>& aPlane, Pack aMaxDistance, Pack& aOutDistance)
+	{
+		Pack normal[3];
+		LaneSet<T, Lane>(aPlane.normal, normal);
+
+		// Parallel rays give an infinite or NaN distance, both fail the range check.
+		const Pack height = Lane::Add(Ohm::Simd::LaneDot<Lane>(normal, aOrigin), Lane::Set(aPlane.distance));
+		const Pack distance = Lane::Divide(Lane::Subtract(Lane::Set(static_cast<T>(0)), height), Ohm::Simd::LaneDot<Lane>(normal, aDirection));
+
+		aOutDistance = distance;
+		return Lane::Min(distance, Lane::Subtract(aMaxDistance, distance));
+	}
+
+	template<typename T, typename Lane, typename Pack>
+	inline Pack IntersectRayTriangle(const Pack aOrigin[3], const Pack aDirection[3], const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC, Pack aMaxDistance, Pack& aOutDistance)
+	{
+		Pack edge1[3];
+		Pack edge2[3];
+		Pack vertex[3];
+		LaneSet<T, Lane>(aB - aA, edge1);
+		LaneSet<T, Lane>(aC - aA, edge2);
+		LaneSet<T, Lane>(aA, vertex);
+
+		Pack p[3];
+		Ohm::Simd::LaneCross<Lane>(aDirection, edge2, p);
+		const Pack determinant = Ohm::Simd::LaneDot<Lane>(edge1, p);
+		const Pack inverseDeterminant = Lane::Divide(Lane::Set(static_cast<T>(1)), determinant);
+
+		const Pack s[3] = { Lane::Subtract(aOrigin[0], vertex[0]), Lane::Subtract(aOrigin[1], vertex[1]), Lane::Subtract(aOrigin[2], vertex[2]) };
+		const Pack u = Lane::Multiply(Ohm::Simd::LaneDot<Lane>(s, p), inverseDeterminant);
+
+		Pack q[3];
+		Ohm::Simd::LaneCross<Lane>(s, edge1, q);
+		const Pack v = Lane::Multiply(Ohm::Simd::LaneDot<Lane>(aDirection, q), inverseDeterminant);
+		const Pack distance = Lane::Multiply(Ohm::Simd::LaneDot<Lane>(edge2, q), inverseDeterminant);
+
+		// The determinant term comes first, so for a degenerate triangle the result is negative before any NaN shows up.
+		Pack result = Lane::Subtract(Lane::Abs(determinant), Lane::Set(std::numeric_limits<T>::min()));
+		result = Lane::Min(result, u);
+		result = Lane::Min(result, v);
+		result = Lane::Min(result, Lane::Subtract(Lane::Subtract(Lane::Set(static_cast<T>(1)), u), v));
+		result = Lane::Min(result, distance);
+		result = Lane::Min(result, Lane::Subtract(aMaxDistance, distance));
+
+		aOutDistance = distance;
+		return result;
+	}
+
+	// Runs a kernel for a single ray and converts the result.
+	template<typename T, typename Kernel>
+	inline bool IntersectSingleRay(T& aOutDistance, Kernel&& aKernel)
+	{
+		T distance = static_cast<T>(0);
+		if (Ohm::Simd::ScalarLane<T>::NonNegativeMask(aKernel(Ohm::Simd::ScalarLane<T>::Set(std::numeric_limits<T>::max()), distance)) == 0)
+		{
+			return false;
+		}
+
+		aOutDistance = distance;
+		return true;
+	}
+}
+
+template<class T>
+constexpr Ray<T>::Ray()
+	: origin(static_cast<T>(0)), direction(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1))
+{
+}
+
+template<class T>
+constexpr Ray<T>::Ray(const Vector3<T>& aOrigin, const Vector3<T>& aDirection)
+	: origin(aOrigin), direction(aDirection)
+{
+}
+
+template<class T>
+constexpr Vector3<T> Ray<T>::GetPoint(T aDistance) const
+{
+	return origin + direction * aDistance;
+}
+
+template<class T>
+inline bool Ray<T>::Intersects(const AABB<T>& aBox, T& aOutDistance) const
+{
+	using Lane = Ohm::Simd::ScalarLane<T>;
+	const T rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const T inverseDirection[3] = { static_cast<T>(1) / direction.x, static_cast<T>(1) / direction.y, static_cast<T>(1) / direction.z };
+
+	return Ohm::Detail::IntersectSingleRay(aOutDistance, [&](T aMaxDistance, T& aDistance)
+	{
+		return Ohm::Detail::IntersectRayAABB<T, Lane>(rayOrigin, inverseDirection, aBox, aMaxDistance, aDistance);
+	});
+}
+
+template<class T>
+inline bool Ray<T>::Intersects(const Sphere<T>& aSphere, T& aOutDistance) const
+{
+	using Lane = Ohm::Simd::ScalarLane<T>;
+	const T rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const T rayDirection[3] = { direction.x, direction.y, direction.z };
+
+	return Ohm::Detail::IntersectSingleRay(aOutDistance, [&](T aMaxDistance, T& aDistance)
+	{
+		return Ohm::Detail::IntersectRaySphere<T, Lane>(rayOrigin, rayDirection, aSphere, aMaxDistance, aDistance);
+	});
+}
+
+template<class T>
+inline bool Ray<T>::Intersects(const Plane<T>& aPlane, T& aOutDistance) const
+{
+	using Lane = Ohm::Simd::ScalarLane<T>;
+	const T rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const T rayDirection[3] = { direction.x, direction.y, direction.z };
+
+	return Ohm::Detail::IntersectSingleRay(aOutDistance, [&](T aMaxDistance, T& aDistance)
+	{
+		return Ohm::Detail::IntersectRayPlane<T, Lane>(rayOrigin, rayDirection, aPlane, aMaxDistance, aDistance);
+	});
+}
+
+template<class T>
+inline bool Ray<T>::IntersectsTriangle(const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC, T& aOutDistance) const
+{
+	using Lane = Ohm::Simd::ScalarLane<T>;
+	const T rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const T rayDirection[3] = { direction.x, direction.y, direction.z };
+
+	return Ohm::Detail::IntersectSingleRay(aOutDistance, [&](T aMaxDistance, T& aDistance)
+	{
+		return Ohm::Detail::IntersectRayTriangle<T, Lane>(rayOrigin, rayDirection, aA, aB, aC, aMaxDistance, aDistance);
+	});
+}
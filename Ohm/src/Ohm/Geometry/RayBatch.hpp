@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Ohm/Geometry/Ray.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Structure-of-arrays ray storage for packet queries. Set() also caches the inverse direction for the slab test,
+// so the streams are read-only from the outside.
+template<typename T>
+class RaySoA
+{
+public:
+	RaySoA<T>() = default;
+	RaySoA<T>(size_t aSize);
+	RaySoA<T>(const Ray<T>* aRays, size_t aCount);
+
+	Ray<T> operator[](size_t aIndex) const;
+	void Set(size_t aIndex, const Ray<T>& aRay);
+
+	void Resize(size_t aSize);
+	size_t Size() const { return myOrigins.Size(); }
+
+	const Vector3SoA<T>& Origins() const { return myOrigins; }
+	const Vector3SoA<T>& Directions() const { return myDirections; }
+	const Vector3SoA<T>& InverseDirections() const { return myInverseDirections; }
+
+private:
+	Vector3SoA<T> myOrigins;
+	Vector3SoA<T> myDirections;
+	Vector3SoA<T> myInverseDirections;
+};
+
+template<typename T>
+inline RaySoA<T>::RaySoA(size_t aSize)
+	: myOrigins(aSize), myDirections(aSize), myInverseDirections(aSize)
+{
+}
+
+template<typename T>
+inline RaySoA<T>::RaySoA(const Ray<T>* aRays, size_t aCount)
+	: myOrigins(aCount), myDirections(aCount), myInverseDirections(aCount)
+{
+	for (size_t i = 0; i < aCount; i++)
+	{
+		Set(i, aRays[i]);
+	}
+}
+
+template<typename T>
+inline Ray<T> RaySoA<T>::operator[](size_t aIndex) const
+{
+	return Ray<T>(myOrigins[aIndex], myDirections[aIndex]);
+}
+
+template<typename T>
+inline void RaySoA<T>::Set(size_t aIndex, const Ray<T>& aRay)
+{
+	myOrigins.Set(aIndex, aRay.origin);
+	myDirections.Set(aIndex, aRay.direction);
+	myInverseDirections.Set(aIndex, Vector3<T>(static_cast<T>(1) / aRay.direction.x, static_cast<T>(1) / aRay.direction.y, static_cast<T>(1) / aRay.direction.z));
+}
+
+template<typename T>
+inline void RaySoA<T>::Resize(size_t aSize)
+{
+	myOrigins.Resize(aSize);
+	myDirections.Resize(aSize);
+	myInverseDirections.Resize(aSize);
+}
+
+// Packet ray queries: every ray of aRays against one object, 4 (SSE) or 8 (AVX) rays per step.
+// aInOutDistance[i] is the range of ray i (the closest hit so far, or a maximum distance) and is lowered to
+// the hit distance where ray i hits within it, so a loop over several objects ends with the closest hits.
+// Hit bits go to aOutHits (Ohm::Simd::MaskWordCount(aRays.Size()) words, bit i % 64 of word i / 64).
+// The results match the single ray Ray<T> functions up to rounding.
+namespace Ohm::Detail
+{
+	template<typename Lane, typename T, typename Pack>
+	inline void LoadLanes(const Vector3SoA<T>& aVectors, size_t aIndex, Pack aOut[3])
+	{
+		aOut[0] = Lane::Load(aVectors.X() + aIndex);
+		aOut[1] = Lane::Load(aVectors.Y() + aIndex);
+		aOut[2] = Lane::Load(aVectors.Z() + aIndex);
+	}
+
+	// aKernel(lane, origin, direction, inverseDirection, maxDistance, outDistance) returns the hit value of the Ray.hpp kernels.
+	template<typename T, typename Kernel>
+	inline void IntersectRayPacket(const RaySoA<T>& aRays, T* aInOutDistance, uint64_t* aOutHits, Kernel&& aKernel)
+	{
+		Ohm::Simd::ForEachLaneMask<T>(aRays.Size(), aOutHits, [&](auto aLane, size_t i)
+		{
+			using Lane = decltype(aLane);
+			using Pack = typename Lane::Type;
+
+			Pack origin[3];
+			Pack direction[3];
+			Pack inverseDirection[3];
+			LoadLanes<Lane>(aRays.Origins(), i, origin);
+			LoadLanes<Lane>(aRays.Directions(), i, direction);
+			LoadLanes<Lane>(aRays.InverseDirections(), i, inverseDirection);
+
+			const Pack maxDistance = Lane::Load(aInOutDistance + i);
+			Pack distance;
+			const Pack hit = aKernel(aLane, origin, direction, inverseDirection, maxDistance, distance);
+
+			Lane::Store(aInOutDistance + i, Lane::SelectNonNegative(hit, distance, maxDistance));
+			return Lane::NonNegativeMask(hit);
+		});
+	}
+}
+
+template<typename T>
+inline void IntersectRays(const RaySoA<T>& aRays, const AABB<T>& aBox, T* aInOutDistance, uint64_t* aOutHits)
+{
+	Ohm::Detail::IntersectRayPacket(aRays, aInOutDistance, aOutHits, [&](auto aLane, const auto* aOrigin, const auto*, const auto* aInverseDirection, auto aMaxDistance, auto& aOutDistance)
+	{
+		return Ohm::Detail::IntersectRayAABB<T, decltype(aLane)>(aOrigin, aInverseDirection, aBox, aMaxDistance, aOutDistance);
+	});
+}
+
+template<typename T>
+inline void IntersectRays(const RaySoA<T>& aRays, const Sphere<T>& aSphere, T* aInOutDistance, uint64_t* aOutHits)
+{
+	Ohm::Detail::IntersectRayPacket(aRays, aInOutDistance, aOutHits, [&](auto aLane, const auto* aOrigin, const auto* aDirection, const auto*, auto aMaxDistance, auto& aOutDistance)
+	{
+		return Ohm::Detail::IntersectRaySphere<T, decltype(aLane)>(aOrigin, aDirection, aSphere, aMaxDistance, aOutDistance);
+	});
+}
+
+template<typename T>
+inline void IntersectRays(const RaySoA<T>& aRays, const Plane<T>& aPlane, T* aInOutDistance, uint64_t* aOutHits)
+{
+	Ohm::Detail::IntersectRayPacket(aRays, aInOutDistance, aOutHits, [&](auto aLane, const auto* aOrigin, const auto* aDirection, const auto*, auto aMaxDistance, auto& aOutDistance)
+	{
+		return Ohm::Detail::IntersectRayPlane<T, decltype(aLane)>(aOrigin, aDirection, aPlane, aMaxDistance, aOutDistance);
+	});
+}
+
+template<typename T>
+inline void IntersectRaysTriangle(const RaySoA<T>& aRays, const Vector3<T>& aA, const Vector3<T>& aB, const Vector3<T>& aC, T* aInOutDistance, uint64_t* aOutHits)
+{
+	Ohm::Detail::IntersectRayPacket(aRays, aInOutDistance, aOutHits, [&](auto aLane, const auto* aOrigin, const auto* aDirection, const auto*, auto aMaxDistance, auto& aOutDistance)
+	{
+		return Ohm::Detail::IntersectRayTriangle<T, decltype(aLane)>(aOrigin, aDirection, aA, aB, aC, aMaxDistance, aOutDistance);
+	});
+}
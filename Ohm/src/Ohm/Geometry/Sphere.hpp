@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Ohm/Geometry/AABB.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+// Sphere given by center and radius, the surface counts as inside.
+template<class T>
+class Sphere
+{
+public:
+	constexpr Sphere<T>();
+	constexpr Sphere<T>(const Vector3<T>& aCenter, T aRadius);
+
+	constexpr bool Contains(const Vector3<T>& aPoint) const;
+	constexpr bool Intersects(const Sphere<T>& aSphere) const;
+	constexpr bool Intersects(const AABB<T>& aBox) const;
+	constexpr AABB<T> GetBounds() const;
+
+	Vector3<T> center;
+	T radius;
+};
+
+template<class T>
+constexpr Sphere<T>::Sphere()
+	: center(static_cast<T>(0)), radius(static_cast<T>(0))
+{
+}
+
+template<class T>
+constexpr Sphere<T>::Sphere(const Vector3<T>& aCenter, T aRadius)
+	: center(aCenter), radius(aRadius)
+{
+}
+
+template<class T>
+constexpr bool Sphere<T>::Contains(const Vector3<T>& aPoint) const
+{
+	return (aPoint - center).LengthSqr() <= radius * radius;
+}
+
+template<class T>
+constexpr bool Sphere<T>::Intersects(const Sphere<T>& aSphere) const
+{
+	const T radii = radius + aSphere.radius;
+	return (aSphere.center - center).LengthSqr() <= radii * radii;
+}
+
+template<class T>
+constexpr bool Sphere<T>::Intersects(const AABB<T>& aBox) const
+{
+	// Distance to the closest point of the box.
+	const Vector3<T> closest(
+		Ohm::Math::Min(Ohm::Math::Max(center.x, aBox.min.x), aBox.max.x),
+		Ohm::Math::Min(Ohm::Math::Max(center.y, aBox.min.y), aBox.max.y),
+		Ohm::Math::Min(Ohm::Math::Max(center.z, aBox.min.z), aBox.max.z));
+	return Contains(closest);
+}
+
+template<class T>
+constexpr AABB<T> Sphere<T>::GetBounds() const
+{
+	return AABB<T>(center - Vector3<T>(radius), center + Vector3<T>(radius));
+}
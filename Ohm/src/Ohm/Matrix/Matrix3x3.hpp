@@ -1,6 +1,8 @@
 #pragma once
 #include "Ohm/Vector/Vector3.hpp"
 #include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Utility/FastMath.hpp"
+#include "Ohm/Utility/Math.hpp"
 
 #include <cmath>
 
@@ -8,36 +10,45 @@ template<typename T>
 class Matrix3x3
 {
 public:
-	Matrix3x3<T>();
-	Matrix3x3<T>(Vector3<T> rowOne, Vector3<T> rowTwo, Vector3<T> rowThree);
+	constexpr Matrix3x3<T>();
+	constexpr Matrix3x3<T>(Vector3<T> rowOne, Vector3<T> rowTwo, Vector3<T> rowThree);
 
 	// Copy Constructor.
-	Matrix3x3<T>(const Matrix3x3<T>& aMatrix);
-	Matrix3x3<T>(const Matrix4x4<T>& aMatrix);
-
-	T& operator()(const int aRow, const int aColumn);
-	const T& operator()(const int aRow, const int aColumn) const;
-	const Vector3<T>& operator()(const int aRow) const;
-
-	void operator+=(const Matrix3x3<T>& aMat);
-	void operator-=(const Matrix3x3<T>& aMat);
-	void operator*=(const Matrix3x3<T>& aMat);
-	void operator=(const Matrix3x3<T>& aOther);
-
-	static Matrix3x3<T> CreateRotationAroundX(T aAngleInRadians);
-	static Matrix3x3<T> CreateRotationAroundY(T aAngleInRadians);
-	static Matrix3x3<T> CreateRotationAroundZ(T aAngleInRadians);
-
-	static Matrix3x3<T> Rotate(T aXAngle, T aYAngle, T aZAngle);
-
-	static Matrix3x3<T> Transpose(const Matrix3x3<T>& aMatrixToTranspose);
+	Matrix3x3<T>(const Matrix3x3<T>& aMatrix) = default;
+	constexpr Matrix3x3<T>(const Matrix4x4<T>& aMatrix);
+
+	constexpr T& operator()(const int aRow, const int aColumn);
+	constexpr const T& operator()(const int aRow, const int aColumn) const;
+	constexpr const Vector3<T>& operator()(const int aRow) const;
+
+	constexpr void operator+=(const Matrix3x3<T>& aMat);
+	constexpr void operator-=(const Matrix3x3<T>& aMat);
+	constexpr void operator*=(const Matrix3x3<T>& aMat);
+	Matrix3x3<T>& operator=(const Matrix3x3<T>& aOther) = default;
+
+	// The With versions take the tier of the sine and cosine (see MathAccuracy), the plain ones use Ohm::Math::DefaultAccuracy.
+	static constexpr Matrix3x3<T> CreateRotationAroundX(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix3x3<T> CreateRotationAroundXWith(T aAngleInRadians);
+	static constexpr Matrix3x3<T> CreateRotationAroundY(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix3x3<T> CreateRotationAroundYWith(T aAngleInRadians);
+	static constexpr Matrix3x3<T> CreateRotationAroundZ(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix3x3<T> CreateRotationAroundZWith(T aAngleInRadians);
+
+	static constexpr Matrix3x3<T> Rotate(T aXAngle, T aYAngle, T aZAngle);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix3x3<T> RotateWith(T aXAngle, T aYAngle, T aZAngle);
+
+	static constexpr Matrix3x3<T> Transpose(const Matrix3x3<T>& aMatrixToTranspose);
 
 private:
 	Vector3<T> myData[3];
 };
 
 template<typename T>
-inline Matrix3x3<T>::Matrix3x3()
+constexpr Matrix3x3<T>::Matrix3x3()
 {
 	myData[0].x = static_cast<T>(1);
 	myData[1].y = static_cast<T>(1);
@@ -45,15 +56,7 @@ inline Matrix3x3<T>::Matrix3x3()
 }
 
 template<typename T>
-inline Matrix3x3<T>::Matrix3x3(const Matrix3x3<T>& aMatrix)
-{
-	myData[0] = aMatrix.myData[0];
-	myData[1] = aMatrix.myData[1];
-	myData[2] = aMatrix.myData[2];
-}
-
-template<typename T>
-inline Matrix3x3<T>::Matrix3x3(Vector3<T> rowOne, Vector3<T> rowTwo, Vector3<T> rowThree)
+constexpr Matrix3x3<T>::Matrix3x3(Vector3<T> rowOne, Vector3<T> rowTwo, Vector3<T> rowThree)
 {
 	myData[0] = rowOne;
 	myData[1] = rowTwo;
@@ -61,7 +64,7 @@ inline Matrix3x3<T>::Matrix3x3(Vector3<T> rowOne, Vector3<T> rowTwo, Vector3<T>
 }
 
 template<typename T>
-inline Matrix3x3<T>::Matrix3x3(const Matrix4x4<T>& aMatrix)
+constexpr Matrix3x3<T>::Matrix3x3(const Matrix4x4<T>& aMatrix)
 {
 	myData[0] = { aMatrix(1, 1), aMatrix(1, 2), aMatrix(1, 3) };
 	myData[1] = { aMatrix(2, 1), aMatrix(2, 2), aMatrix(2, 3) };
@@ -69,7 +72,7 @@ inline Matrix3x3<T>::Matrix3x3(const Matrix4x4<T>& aMatrix)
 }
 
 template<typename T>
-inline T& Matrix3x3<T>::operator()(const int aRow, const int aColumn)
+constexpr T& Matrix3x3<T>::operator()(const int aRow, const int aColumn)
 {
 	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
 	assert(aColumn > 0 && aColumn < 4 && "Index out of bounds!");
@@ -78,7 +81,7 @@ inline T& Matrix3x3<T>::operator()(const int aRow, const int aColumn)
 }
 
 template<typename T>
-inline const T& Matrix3x3<T>::operator()(const int aRow, const int aColumn) const
+constexpr const T& Matrix3x3<T>::operator()(const int aRow, const int aColumn) const
 {
 	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
 	assert(aColumn > 0 && aColumn < 4 && "Index out of bounds!");
@@ -87,7 +90,7 @@ inline const T& Matrix3x3<T>::operator()(const int aRow, const int aColumn) cons
 }
 
 template<typename T>
-inline const Vector3<T>& Matrix3x3<T>::operator()(const int aRow) const
+constexpr const Vector3<T>& Matrix3x3<T>::operator()(const int aRow) const
 {
 	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
 
@@ -95,7 +98,7 @@ inline const Vector3<T>& Matrix3x3<T>::operator()(const int aRow) const
 }
 
 template<typename T>
-inline void Matrix3x3<T>::operator+=(const Matrix3x3<T>& aMat)
+constexpr void Matrix3x3<T>::operator+=(const Matrix3x3<T>& aMat)
 {
 	myData[0] += aMat.myData[0];
 	myData[1] += aMat.myData[1];
@@ -103,7 +106,7 @@ inline void Matrix3x3<T>::operator+=(const Matrix3x3<T>& aMat)
 }
 
 template<typename T>
-inline void Matrix3x3<T>::operator-=(const Matrix3x3<T>& aMat)
+constexpr void Matrix3x3<T>::operator-=(const Matrix3x3<T>& aMat)
 {
 	myData[0] -= aMat.myData[0];
 	myData[1] -= aMat.myData[1];
@@ -111,7 +114,7 @@ inline void Matrix3x3<T>::operator-=(const Matrix3x3<T>& aMat)
 }
 
 template<typename T>
-inline Matrix3x3<T> operator+(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
+constexpr Matrix3x3<T> operator+(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
 {
 	Matrix3x3<T> mat =
 	{
@@ -124,7 +127,7 @@ inline Matrix3x3<T> operator+(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo
 }
 
 template<typename T>
-inline Matrix3x3<T> operator-(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
+constexpr Matrix3x3<T> operator-(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
 {
 	Matrix3x3<T> mat =
 	{
@@ -137,7 +140,7 @@ inline Matrix3x3<T> operator-(Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo
 }
 
 template<typename T>
-inline Matrix3x3<T> operator*(const Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
+constexpr Matrix3x3<T> operator*(const Matrix3x3<T>& aMatOne, const Matrix3x3<T>& aMatTwo)
 {
 	Matrix3x3<T> result;
 	result(1, 1) = aMatOne(1, 1) * aMatTwo(1, 1) + aMatOne(1, 2) * aMatTwo(2, 1) + aMatOne(1, 3) * aMatTwo(3, 1);
@@ -156,13 +159,13 @@ inline Matrix3x3<T> operator*(const Matrix3x3<T>& aMatOne, const Matrix3x3<T>& a
 }
 
 template<typename T>
-inline void Matrix3x3<T>::operator*=(const Matrix3x3<T>& aMat)
+constexpr void Matrix3x3<T>::operator*=(const Matrix3x3<T>& aMat)
 {
 	*this = *this * aMat;
 }
 
 template<typename T>
-inline Vector3<T> operator*(const Vector3<T>& aVec, const Matrix3x3<T>& aMat)
+constexpr Vector3<T> operator*(const Vector3<T>& aVec, const Matrix3x3<T>& aMat)
 {
 	Vector3<T> vec =
 	{
@@ -175,54 +178,79 @@ inline Vector3<T> operator*(const Vector3<T>& aVec, const Matrix3x3<T>& aMat)
 }
 
 template<typename T>
-inline void Matrix3x3<T>::operator=(const Matrix3x3<T>& aOther)
+constexpr bool operator==(const Matrix3x3<T>& aFirst, const Matrix3x3<T>& aSecond)
 {
-	myData[0] = aOther.myData[0];
-	myData[1] = aOther.myData[1];
-	myData[2] = aOther.myData[2];
+	return aFirst(1) == aSecond(1) &&
+		aFirst(2) == aSecond(2) &&
+		aFirst(3) == aSecond(3);
 }
 
 template<typename T>
-inline bool operator==(const Matrix3x3<T>& aFirst, const Matrix3x3<T>& aSecond)
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundX(T aAngleInRadians)
 {
-	return aFirst(1) == aSecond(1) &&
-		aFirst(2) == aSecond(2) &&
-		aFirst(3) == aSecond(3);
+	return CreateRotationAroundXWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
 }
 
 template<typename T>
-inline Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundX(T aAngleInRadians)
+template<MathAccuracy Accuracy>
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundXWith(T aAngleInRadians)
 {
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix3x3<T> mat =
 	{
 		Vector3<T>{ 1, 0, 0 },
-		Vector3<T>{ 0, std::cos(aAngleInRadians), std::sin(aAngleInRadians) },
-		Vector3<T>{ 0, -std::sin(aAngleInRadians), std::cos(aAngleInRadians) }
+		Vector3<T>{ 0, cos, sin },
+		Vector3<T>{ 0, -sin, cos }
 	};
 
 	return mat;
 }
 
 template<typename T>
-inline Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundY(T aAngleInRadians)
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundY(T aAngleInRadians)
+{
+	return CreateRotationAroundYWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundYWith(T aAngleInRadians)
 {
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix3x3<T> mat =
 	{
-		Vector3<T>{ std::cos(aAngleInRadians), 0, -std::sin(aAngleInRadians) },
+		Vector3<T>{ cos, 0, -sin },
 		Vector3<T>{ 0, 1, 0 },
-		Vector3<T>{ std::sin(aAngleInRadians), 0, std::cos(aAngleInRadians) }
+		Vector3<T>{ sin, 0, cos }
 	};
 
 	return mat;
 }
 
 template<typename T>
-inline Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundZ(T aAngleInRadians)
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundZ(T aAngleInRadians)
 {
+	return CreateRotationAroundZWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundZWith(T aAngleInRadians)
+{
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix3x3<T> mat =
 	{
-		Vector3<T>{ std::cos(aAngleInRadians), std::sin(aAngleInRadians), 0 },
-		Vector3<T>{ -std::sin(aAngleInRadians), std::cos(aAngleInRadians), 0 },
+		Vector3<T>{ cos, sin, 0 },
+		Vector3<T>{ -sin, cos, 0 },
 		Vector3<T>{ 0, 0, 1 }
 	};
 
@@ -230,13 +258,20 @@ inline Matrix3x3<T> Matrix3x3<T>::CreateRotationAroundZ(T aAngleInRadians)
 }
 
 template<typename T>
-inline Matrix3x3<T> Matrix3x3<T>::Rotate(T aXAngle, T aYAngle, T aZAngle)
+constexpr Matrix3x3<T> Matrix3x3<T>::Rotate(T aXAngle, T aYAngle, T aZAngle)
+{
+	return RotateWith<Ohm::Math::DefaultAccuracy>(aXAngle, aYAngle, aZAngle);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix3x3<T> Matrix3x3<T>::RotateWith(T aXAngle, T aYAngle, T aZAngle)
 {
-	return CreateRotationAroundX(aXAngle) * CreateRotationAroundY(aYAngle) * CreateRotationAroundZ(aZAngle);
+	return CreateRotationAroundXWith<Accuracy>(aXAngle) * CreateRotationAroundYWith<Accuracy>(aYAngle) * CreateRotationAroundZWith<Accuracy>(aZAngle);
 }
 
 template<typename T>
-inline Matrix3x3<T> Matrix3x3<T>::Transpose(const Matrix3x3<T>& aMat)
+constexpr Matrix3x3<T> Matrix3x3<T>::Transpose(const Matrix3x3<T>& aMat)
 {
 	Matrix3x3<T> mat
 	{
@@ -0,0 +1,319 @@
+#pragma once
+
+#include "Ohm/Vector/Vector4.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Matrix/Matrix3x3.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Quaternion/Quaternion.hpp"
+
+#include <cassert>
+
+// Affine transform without the constant (0, 0, 0, 1) last column of Matrix4x4, 12 values instead of 16.
+// It is stored transposed: row i holds column i of the matching Matrix4x4, so (i, 4) is the translation and
+// component i of a transformed point is Dot(row i, (x, y, z, 1)). The products follow Matrix4x4,
+// aFirst * aSecond applies aFirst and then aSecond.
+template<typename T>
+class Matrix3x4
+{
+public:
+	constexpr Matrix3x4<T>();
+	constexpr Matrix3x4<T>(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree);
+	constexpr Matrix3x4<T>(const Matrix3x3<T>& aLinear, const Vector3<T>& aTranslation = Vector3<T>(static_cast<T>(0)));
+
+	// Drops the last column, which has to be (0, 0, 0, 1) for the result to be the same transform.
+	explicit constexpr Matrix3x4<T>(const Matrix4x4<T>& aMatrix);
+
+	// Copy Constructor.
+	Matrix3x4<T>(const Matrix3x4<T>& aMatrix) = default;
+
+	constexpr T& operator()(const int aRow, const int aColumn);
+	constexpr Vector4<T>& operator()(const int aRow);
+
+	constexpr const T& operator()(const int aRow, const int aColumn) const;
+	constexpr const Vector4<T>& operator()(const int aRow) const;
+
+	constexpr void operator*=(const Matrix3x4<T>& aMat);
+	Matrix3x4<T>& operator=(const Matrix3x4<T>& aOther) = default;
+
+	constexpr Matrix4x4<T> ToMatrix4x4() const;
+	// The rotation, scale and shear part in Matrix4x4 layout.
+	constexpr Matrix3x3<T> ToMatrix3x3() const;
+
+	constexpr Vector3<T> GetTranslation() const;
+	constexpr void SetTranslation(const Vector3<T>& aTranslation);
+
+	constexpr Vector3<T> TransformPoint(const Vector3<T>& aPoint) const;
+	constexpr Vector3<T> TransformDirection(const Vector3<T>& aDirection) const;
+
+	static constexpr Matrix3x4<T> CreateTranslation(const Vector3<T>& aPos);
+	// Scales, then rotates, then translates.
+	static constexpr Matrix3x4<T> CreateTransform(const Vector3<T>& aTranslation, const Quaternion<T>& aRotation, const Vector3<T>& aScale = Vector3<T>(static_cast<T>(1)));
+
+	// Assumes aTransform is made up of nothing but rotations and translations.
+	static constexpr Matrix3x4<T> GetFastInverse(const Matrix3x4<T>& aTransform);
+
+	// Any rotation, scale and shear is allowed. Returns false and leaves aOutInverse untouched if the 3x3 part is singular,
+	// its determinant is written to aOutDeterminant either way.
+	static bool Inverse(const Matrix3x4<T>& aTransform, Matrix3x4<T>& aOutInverse, T* aOutDeterminant = nullptr);
+
+private:
+	Vector4<T> myData[3];
+};
+
+template<typename T>
+constexpr Matrix3x4<T>::Matrix3x4()
+{
+	myData[0].x = static_cast<T>(1);
+	myData[1].y = static_cast<T>(1);
+	myData[2].z = static_cast<T>(1);
+}
+
+template<typename T>
+constexpr Matrix3x4<T>::Matrix3x4(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree)
+{
+	myData[0] = rowOne;
+	myData[1] = rowTwo;
+	myData[2] = rowThree;
+}
+
+template<typename T>
+constexpr Matrix3x4<T>::Matrix3x4(const Matrix3x3<T>& aLinear, const Vector3<T>& aTranslation)
+{
+	myData[0] = { aLinear(1, 1), aLinear(2, 1), aLinear(3, 1), aTranslation.x };
+	myData[1] = { aLinear(1, 2), aLinear(2, 2), aLinear(3, 2), aTranslation.y };
+	myData[2] = { aLinear(1, 3), aLinear(2, 3), aLinear(3, 3), aTranslation.z };
+}
+
+template<typename T>
+constexpr Matrix3x4<T>::Matrix3x4(const Matrix4x4<T>& aMatrix)
+{
+	myData[0] = { aMatrix(1, 1), aMatrix(2, 1), aMatrix(3, 1), aMatrix(4, 1) };
+	myData[1] = { aMatrix(1, 2), aMatrix(2, 2), aMatrix(3, 2), aMatrix(4, 2) };
+	myData[2] = { aMatrix(1, 3), aMatrix(2, 3), aMatrix(3, 3), aMatrix(4, 3) };
+}
+
+template<typename T>
+constexpr T& Matrix3x4<T>::operator()(const int aRow, const int aColumn)
+{
+	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
+	assert(aColumn > 0 && aColumn < 5 && "Index out of bounds!");
+
+	return myData[aRow - 1][aColumn - 1];
+}
+
+template<typename T>
+constexpr Vector4<T>& Matrix3x4<T>::operator()(const int aRow)
+{
+	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
+
+	return myData[aRow - 1];
+}
+
+template<typename T>
+constexpr const T& Matrix3x4<T>::operator()(const int aRow, const int aColumn) const
+{
+	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
+	assert(aColumn > 0 && aColumn < 5 && "Index out of bounds!");
+
+	return myData[aRow - 1][aColumn - 1];
+}
+
+template<typename T>
+constexpr const Vector4<T>& Matrix3x4<T>::operator()(const int aRow) const
+{
+	assert(aRow > 0 && aRow < 4 && "Index out of bounds!");
+
+	return myData[aRow - 1];
+}
+
+// Row i of the result combines the rows of aMatOne weighted by row i of aMatTwo, whose last element adds to the translation.
+template<typename T>
+constexpr Matrix3x4<T> operator*(const Matrix3x4<T>& aMatOne, const Matrix3x4<T>& aMatTwo)
+{
+	Matrix3x4<T> result;
+	result(1, 1) = aMatTwo(1, 1) * aMatOne(1, 1) + aMatTwo(1, 2) * aMatOne(2, 1) + aMatTwo(1, 3) * aMatOne(3, 1);
+	result(1, 2) = aMatTwo(1, 1) * aMatOne(1, 2) + aMatTwo(1, 2) * aMatOne(2, 2) + aMatTwo(1, 3) * aMatOne(3, 2);
+	result(1, 3) = aMatTwo(1, 1) * aMatOne(1, 3) + aMatTwo(1, 2) * aMatOne(2, 3) + aMatTwo(1, 3) * aMatOne(3, 3);
+	result(1, 4) = aMatTwo(1, 1) * aMatOne(1, 4) + aMatTwo(1, 2) * aMatOne(2, 4) + aMatTwo(1, 3) * aMatOne(3, 4) + aMatTwo(1, 4);
+
+	result(2, 1) = aMatTwo(2, 1) * aMatOne(1, 1) + aMatTwo(2, 2) * aMatOne(2, 1) + aMatTwo(2, 3) * aMatOne(3, 1);
+	result(2, 2) = aMatTwo(2, 1) * aMatOne(1, 2) + aMatTwo(2, 2) * aMatOne(2, 2) + aMatTwo(2, 3) * aMatOne(3, 2);
+	result(2, 3) = aMatTwo(2, 1) * aMatOne(1, 3) + aMatTwo(2, 2) * aMatOne(2, 3) + aMatTwo(2, 3) * aMatOne(3, 3);
+	result(2, 4) = aMatTwo(2, 1) * aMatOne(1, 4) + aMatTwo(2, 2) * aMatOne(2, 4) + aMatTwo(2, 3) * aMatOne(3, 4) + aMatTwo(2, 4);
+
+	result(3, 1) = aMatTwo(3, 1) * aMatOne(1, 1) + aMatTwo(3, 2) * aMatOne(2, 1) + aMatTwo(3, 3) * aMatOne(3, 1);
+	result(3, 2) = aMatTwo(3, 1) * aMatOne(1, 2) + aMatTwo(3, 2) * aMatOne(2, 2) + aMatTwo(3, 3) * aMatOne(3, 2);
+	result(3, 3) = aMatTwo(3, 1) * aMatOne(1, 3) + aMatTwo(3, 2) * aMatOne(2, 3) + aMatTwo(3, 3) * aMatOne(3, 3);
+	result(3, 4) = aMatTwo(3, 1) * aMatOne(1, 4) + aMatTwo(3, 2) * aMatOne(2, 4) + aMatTwo(3, 3) * aMatOne(3, 4) + aMatTwo(3, 4);
+
+	return result;
+}
+
+template<typename T>
+constexpr void Matrix3x4<T>::operator*=(const Matrix3x4<T>& aMat)
+{
+	*this = *this * aMat;
+}
+
+template<typename T>
+constexpr bool operator==(const Matrix3x4<T>& aFirst, const Matrix3x4<T>& aSecond)
+{
+	return aFirst(1) == aSecond(1) &&
+		aFirst(2) == aSecond(2) &&
+		aFirst(3) == aSecond(3);
+}
+
+template<typename T>
+constexpr Matrix4x4<T> Matrix3x4<T>::ToMatrix4x4() const
+{
+	Matrix4x4<T> result =
+	{
+		Vector4<T>{ myData[0].x, myData[1].x, myData[2].x, static_cast<T>(0) },
+		Vector4<T>{ myData[0].y, myData[1].y, myData[2].y, static_cast<T>(0) },
+		Vector4<T>{ myData[0].z, myData[1].z, myData[2].z, static_cast<T>(0) },
+		Vector4<T>{ myData[0].w, myData[1].w, myData[2].w, static_cast<T>(1) }
+	};
+
+	return result;
+}
+
+template<typename T>
+constexpr Matrix3x3<T> Matrix3x4<T>::ToMatrix3x3() const
+{
+	Matrix3x3<T> result =
+	{
+		Vector3<T>{ myData[0].x, myData[1].x, myData[2].x },
+		Vector3<T>{ myData[0].y, myData[1].y, myData[2].y },
+		Vector3<T>{ myData[0].z, myData[1].z, myData[2].z }
+	};
+
+	return result;
+}
+
+template<typename T>
+constexpr Vector3<T> Matrix3x4<T>::GetTranslation() const
+{
+	return Vector3<T>(myData[0].w, myData[1].w, myData[2].w);
+}
+
+template<typename T>
+constexpr void Matrix3x4<T>::SetTranslation(const Vector3<T>& aTranslation)
+{
+	myData[0].w = aTranslation.x;
+	myData[1].w = aTranslation.y;
+	myData[2].w = aTranslation.z;
+}
+
+template<typename T>
+constexpr Vector3<T> Matrix3x4<T>::TransformPoint(const Vector3<T>& aPoint) const
+{
+	Vector3<T> vec =
+	{
+		aPoint.x * myData[0].x + aPoint.y * myData[0].y + aPoint.z * myData[0].z + myData[0].w,
+		aPoint.x * myData[1].x + aPoint.y * myData[1].y + aPoint.z * myData[1].z + myData[1].w,
+		aPoint.x * myData[2].x + aPoint.y * myData[2].y + aPoint.z * myData[2].z + myData[2].w,
+	};
+
+	return vec;
+}
+
+template<typename T>
+constexpr Vector3<T> Matrix3x4<T>::TransformDirection(const Vector3<T>& aDirection) const
+{
+	Vector3<T> vec =
+	{
+		aDirection.x * myData[0].x + aDirection.y * myData[0].y + aDirection.z * myData[0].z,
+		aDirection.x * myData[1].x + aDirection.y * myData[1].y + aDirection.z * myData[1].z,
+		aDirection.x * myData[2].x + aDirection.y * myData[2].y + aDirection.z * myData[2].z,
+	};
+
+	return vec;
+}
+
+template<typename T>
+constexpr Matrix3x4<T> Matrix3x4<T>::CreateTranslation(const Vector3<T>& aPos)
+{
+	Matrix3x4<T> result;
+	result.SetTranslation(aPos);
+
+	return result;
+}
+
+template<typename T>
+constexpr Matrix3x4<T> Matrix3x4<T>::CreateTransform(const Vector3<T>& aTranslation, const Quaternion<T>& aRotation, const Vector3<T>& aScale)
+{
+	// Quaternion<T>::ToMatrix3x3 transposed, with every column scaled by its scale component.
+	const T two = static_cast<T>(2);
+	const T xx = aRotation.x * aRotation.x * two;
+	const T yy = aRotation.y * aRotation.y * two;
+	const T zz = aRotation.z * aRotation.z * two;
+	const T xy = aRotation.x * aRotation.y * two;
+	const T xz = aRotation.x * aRotation.z * two;
+	const T yz = aRotation.y * aRotation.z * two;
+	const T wx = aRotation.w * aRotation.x * two;
+	const T wy = aRotation.w * aRotation.y * two;
+	const T wz = aRotation.w * aRotation.z * two;
+
+	Matrix3x4<T> result =
+	{
+		Vector4<T>{ (static_cast<T>(1) - yy - zz) * aScale.x, (xy - wz) * aScale.y, (xz + wy) * aScale.z, aTranslation.x },
+		Vector4<T>{ (xy + wz) * aScale.x, (static_cast<T>(1) - xx - zz) * aScale.y, (yz - wx) * aScale.z, aTranslation.y },
+		Vector4<T>{ (xz - wy) * aScale.x, (yz + wx) * aScale.y, (static_cast<T>(1) - xx - yy) * aScale.z, aTranslation.z }
+	};
+
+	return result;
+}
+
+template<typename T>
+constexpr Matrix3x4<T> Matrix3x4<T>::GetFastInverse(const Matrix3x4<T>& aTransform)
+{
+	const Vector4<T>* m = aTransform.myData;
+
+	// The 3x3 part is transposed and the translation rotated back through it.
+	Matrix3x4<T> inverse =
+	{
+		Vector4<T>{ m[0].x, m[1].x, m[2].x, -(m[0].x * m[0].w + m[1].x * m[1].w + m[2].x * m[2].w) },
+		Vector4<T>{ m[0].y, m[1].y, m[2].y, -(m[0].y * m[0].w + m[1].y * m[1].w + m[2].y * m[2].w) },
+		Vector4<T>{ m[0].z, m[1].z, m[2].z, -(m[0].z * m[0].w + m[1].z * m[1].w + m[2].z * m[2].w) }
+	};
+
+	return inverse;
+}
+
+template<typename T>
+inline bool Matrix3x4<T>::Inverse(const Matrix3x4<T>& aTransform, Matrix3x4<T>& aOutInverse, T* aOutDeterminant)
+{
+	const Vector3<T> row0{ aTransform(1, 1), aTransform(1, 2), aTransform(1, 3) };
+	const Vector3<T> row1{ aTransform(2, 1), aTransform(2, 2), aTransform(2, 3) };
+	const Vector3<T> row2{ aTransform(3, 1), aTransform(3, 2), aTransform(3, 3) };
+
+	// The columns of the inverse 3x3 are the cross products of the rows divided by the determinant.
+	const Vector3<T> column0 = row1.Cross(row2);
+	const Vector3<T> column1 = row2.Cross(row0);
+	const Vector3<T> column2 = row0.Cross(row1);
+
+	const T determinant = row0.Dot(column0);
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	if (determinant == static_cast<T>(0))
+	{
+		return false;
+	}
+
+	const T invDet = static_cast<T>(1) / determinant;
+	const Vector3<T> translation = (column0 * aTransform(1, 4) + column1 * aTransform(2, 4) + column2 * aTransform(3, 4)) * -invDet;
+
+	aOutInverse = Matrix3x4<T>
+	{
+		Vector4<T>{ column0.x * invDet, column1.x * invDet, column2.x * invDet, translation.x },
+		Vector4<T>{ column0.y * invDet, column1.y * invDet, column2.y * invDet, translation.y },
+		Vector4<T>{ column0.z * invDet, column1.z * invDet, column2.z * invDet, translation.z }
+	};
+
+	return true;
+}
+
+#include "Ohm/Matrix/Matrix3x4Simd.hpp"
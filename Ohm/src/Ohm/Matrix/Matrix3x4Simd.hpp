@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#if defined(OHM_SIMD_SSE2)
+
+// Row-broadcast kernels for Matrix3x4<float>.
+// All kernels work on 16 byte aligned float[12] data (three rows) and may be called with aResult aliasing an input.
+// Without FMA the product accumulates in the same order as the scalar operator*, so results are bit-identical.
+namespace Ohm::Simd
+{
+	// aResult = aLhs * aRhs, aLhs applied first. Three broadcasts per row instead of the four of Matrix4x4.
+	inline void MultiplyMatrix3x4(const float* aLhs, const float* aRhs, float* aResult)
+	{
+		const __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+		const __m128 lhsRow0 = _mm_load_ps(aLhs + 0);
+		const __m128 lhsRow1 = _mm_load_ps(aLhs + 4);
+		const __m128 lhsRow2 = _mm_load_ps(aLhs + 8);
+
+		__m128 result[3];
+		for (int row = 0; row < 3; row++)
+		{
+			const __m128 factors = _mm_load_ps(aRhs + row * 4);
+
+			__m128 value = _mm_mul_ps(_mm_shuffle_ps(factors, factors, _MM_SHUFFLE(0, 0, 0, 0)), lhsRow0);
+			value = MultiplyAdd(_mm_shuffle_ps(factors, factors, _MM_SHUFFLE(1, 1, 1, 1)), lhsRow1, value);
+			value = MultiplyAdd(_mm_shuffle_ps(factors, factors, _MM_SHUFFLE(2, 2, 2, 2)), lhsRow2, value);
+			result[row] = _mm_add_ps(value, _mm_and_ps(factors, wMask));
+		}
+
+		_mm_store_ps(aResult + 0, result[0]);
+		_mm_store_ps(aResult + 4, result[1]);
+		_mm_store_ps(aResult + 8, result[2]);
+	}
+
+	// Returns the determinant of the 3x3 part in all lanes, aResult is only written when it is non-zero.
+	inline __m128 InverseMatrix3x4(const float* aMatrix, float* aResult)
+	{
+		const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 fullRow0 = _mm_load_ps(aMatrix + 0);
+		const __m128 fullRow1 = _mm_load_ps(aMatrix + 4);
+		const __m128 fullRow2 = _mm_load_ps(aMatrix + 8);
+		const __m128 row0 = _mm_and_ps(fullRow0, xyzMask);
+		const __m128 row1 = _mm_and_ps(fullRow1, xyzMask);
+		const __m128 row2 = _mm_and_ps(fullRow2, xyzMask);
+
+		__m128 column0 = Cross3(row1, row2);
+		__m128 column1 = Cross3(row2, row0);
+		__m128 column2 = Cross3(row0, row1);
+
+		const __m128 determinant = Dot4(row0, column0);
+		if (_mm_cvtss_f32(determinant) == 0.f)
+		{
+			return determinant;
+		}
+
+		const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.f), determinant);
+		column0 = _mm_mul_ps(column0, invDet);
+		column1 = _mm_mul_ps(column1, invDet);
+		column2 = _mm_mul_ps(column2, invDet);
+
+		// -inverse(3x3) * translation, the translation is the last lane of each row.
+		__m128 translation = _mm_mul_ps(_mm_shuffle_ps(fullRow0, fullRow0, _MM_SHUFFLE(3, 3, 3, 3)), column0);
+		translation = MultiplyAdd(_mm_shuffle_ps(fullRow1, fullRow1, _MM_SHUFFLE(3, 3, 3, 3)), column1, translation);
+		translation = MultiplyAdd(_mm_shuffle_ps(fullRow2, fullRow2, _MM_SHUFFLE(3, 3, 3, 3)), column2, translation);
+		translation = _mm_sub_ps(_mm_setzero_ps(), translation);
+
+		// Row i of the inverse is lane i of the columns followed by the translation.
+		_MM_TRANSPOSE4_PS(column0, column1, column2, translation);
+		_mm_store_ps(aResult + 0, column0);
+		_mm_store_ps(aResult + 4, column1);
+		_mm_store_ps(aResult + 8, column2);
+
+		return determinant;
+	}
+}
+
+constexpr Matrix3x4<float> operator*(const Matrix3x4<float>& aMatOne, const Matrix3x4<float>& aMatTwo)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return operator*<float>(aMatOne, aMatTwo);
+	}
+
+	Matrix3x4<float> result;
+	Ohm::Simd::MultiplyMatrix3x4(&aMatOne(1).x, &aMatTwo(1).x, &result(1).x);
+
+	return result;
+}
+
+template<>
+inline bool Matrix3x4<float>::Inverse(const Matrix3x4<float>& aTransform, Matrix3x4<float>& aOutInverse, float* aOutDeterminant)
+{
+	const float determinant = _mm_cvtss_f32(Ohm::Simd::InverseMatrix3x4(&aTransform(1).x, &aOutInverse(1).x));
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	return determinant != 0.f;
+}
+
+#endif
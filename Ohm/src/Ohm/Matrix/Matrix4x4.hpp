@@ -2,44 +2,65 @@
 
 #include "Ohm/Vector/Vector4.hpp"
 #include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Utility/FastMath.hpp"
+#include "Ohm/Utility/Math.hpp"
 
 #include <cmath>
 #include <limits>
 
+template<typename T>
+class Matrix3x3;
+
 template<typename T>
 class Matrix4x4
 {
 public:
-	Matrix4x4<T>();
-	Matrix4x4<T>(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree, Vector4<T> rowFour);
+	constexpr Matrix4x4<T>();
+	constexpr Matrix4x4<T>(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree, Vector4<T> rowFour);
 
 	// Copy Constructor.
-	Matrix4x4<T>(const Matrix4x4<T>& aMatrix);
+	Matrix4x4<T>(const Matrix4x4<T>& aMatrix) = default;
 
-	T& operator()(const int aRow, const int aColumn);
-	Vector4<T>& operator()(const int aRow);
+	constexpr T& operator()(const int aRow, const int aColumn);
+	constexpr Vector4<T>& operator()(const int aRow);
 
-	const T& operator()(const int aRow, const int aColumn) const;
-	const Vector4<T>& operator()(const int aRow) const;
+	constexpr const T& operator()(const int aRow, const int aColumn) const;
+	constexpr const Vector4<T>& operator()(const int aRow) const;
 
-	void operator+=(const Matrix4x4<T>& aMat);
-	void operator-=(const Matrix4x4<T>& aMat);
-	void operator*=(const Matrix4x4<T>& aMat);
-	void operator=(const Matrix4x4<T>& aOther);
+	constexpr void operator+=(const Matrix4x4<T>& aMat);
+	constexpr void operator-=(const Matrix4x4<T>& aMat);
+	constexpr void operator*=(const Matrix4x4<T>& aMat);
+	Matrix4x4<T>& operator=(const Matrix4x4<T>& aOther) = default;
 
-	static Matrix4x4<T> CreateRotationAroundX(T aAngleInRadians);
-	static Matrix4x4<T> CreateRotationAroundY(T aAngleInRadians);
-	static Matrix4x4<T> CreateRotationAroundZ(T aAngleInRadians);
+	// The With versions take the tier of the sine and cosine (see MathAccuracy), the plain ones use Ohm::Math::DefaultAccuracy.
+	static constexpr Matrix4x4<T> CreateRotationAroundX(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix4x4<T> CreateRotationAroundXWith(T aAngleInRadians);
+	static constexpr Matrix4x4<T> CreateRotationAroundY(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix4x4<T> CreateRotationAroundYWith(T aAngleInRadians);
+	static constexpr Matrix4x4<T> CreateRotationAroundZ(T aAngleInRadians);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix4x4<T> CreateRotationAroundZWith(T aAngleInRadians);
 
-	static Matrix4x4<T> CreateRotation(T aXAngle, T aYAngle, T aZAngle);
-	static Matrix4x4<T> CreateTranslation(const Vector3<T>& aPos);
+	static constexpr Matrix4x4<T> CreateRotation(T aXAngle, T aYAngle, T aZAngle);
+	template<MathAccuracy Accuracy>
+	static constexpr Matrix4x4<T> CreateRotationWith(T aXAngle, T aYAngle, T aZAngle);
+	static constexpr Matrix4x4<T> CreateTranslation(const Vector3<T>& aPos);
 
-	static Matrix4x4<T> Transpose(const Matrix4x4<T>& aMatrixToTranspose);
+	static constexpr Matrix4x4<T> Transpose(const Matrix4x4<T>& aMatrixToTranspose);
 
 	// Assumes aTransform is made up of nothing but rotations and translations.
-	static Matrix4x4<T> GetFastInverse(const Matrix4x4<T>& aTransform);
-	static Matrix4x4<T> CreateLookAt(const Vector3<T>& aEye, const Vector3<T>& aCenter, const Vector3<T>& aUp);
-	static Matrix4x4<T> CreatePerspective(T aFOV, T aAspect, T aNear, T aFar);
+	static constexpr Matrix4x4<T> GetFastInverse(const Matrix4x4<T>& aTransform);
+
+	// General inverse through cofactors. Returns false and leaves aOutInverse untouched if aMatrix is singular,
+	// the determinant is written to aOutDeterminant either way so callers can apply their own tolerance.
+	static bool Inverse(const Matrix4x4<T>& aMatrix, Matrix4x4<T>& aOutInverse, T* aOutDeterminant = nullptr);
+
+	// Assumes the last column of aTransform is (0, 0, 0, 1), any rotation, scale and shear in the upper 3x3 is allowed.
+	static bool InverseAffine(const Matrix4x4<T>& aTransform, Matrix4x4<T>& aOutInverse, T* aOutDeterminant = nullptr);
+	static constexpr Matrix4x4<T> CreateLookAt(const Vector3<T>& aEye, const Vector3<T>& aCenter, const Vector3<T>& aUp);
+	static constexpr Matrix4x4<T> CreatePerspective(T aFOV, T aAspect, T aNear, T aFar);
 
 private:
 	friend class Vector4<T>;
@@ -48,7 +69,7 @@ private:
 };
 
 template<typename T>
-inline Matrix4x4<T>::Matrix4x4()
+constexpr Matrix4x4<T>::Matrix4x4()
 {
 	m_data[0].x = static_cast<T>(1);
 	m_data[1].y = static_cast<T>(1);
@@ -57,16 +78,7 @@ inline Matrix4x4<T>::Matrix4x4()
 }
 
 template<typename T>
-inline Matrix4x4<T>::Matrix4x4(const Matrix4x4<T>& aMatrix)
-{
-	m_data[0] = aMatrix.myData[0];
-	m_data[1] = aMatrix.myData[1];
-	m_data[2] = aMatrix.myData[2];
-	m_data[3] = aMatrix.myData[3];
-}
-
-template<typename T>
-inline Matrix4x4<T>::Matrix4x4(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree, Vector4<T> rowFour)
+constexpr Matrix4x4<T>::Matrix4x4(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T> rowThree, Vector4<T> rowFour)
 {
 	m_data[0] = rowOne;
 	m_data[1] = rowTwo;
@@ -75,7 +87,7 @@ inline Matrix4x4<T>::Matrix4x4(Vector4<T> rowOne, Vector4<T> rowTwo, Vector4<T>
 }
 
 template<typename T>
-inline T& Matrix4x4<T>::operator()(const int aRow, const int aColumn)
+constexpr T& Matrix4x4<T>::operator()(const int aRow, const int aColumn)
 {
 	assert(aRow > 0 && aRow <= 5 && "Index out of bounds!");
 	assert(aColumn > 0 && aColumn <= 5 && "Index out of bounds!");
@@ -84,13 +96,13 @@ inline T& Matrix4x4<T>::operator()(const int aRow, const int aColumn)
 }
 
 template<typename T>
-inline Vector4<T>& Matrix4x4<T>::operator()(const int aRow)
+constexpr Vector4<T>& Matrix4x4<T>::operator()(const int aRow)
 {
 	return m_data[aRow - 1];
 }
 
 template<typename T>
-inline const T& Matrix4x4<T>::operator()(const int aRow, const int aColumn) const
+constexpr const T& Matrix4x4<T>::operator()(const int aRow, const int aColumn) const
 {
 	assert(aRow > 0 && aRow <= 5 && "Index out of bounds!");
 	assert(aColumn > 0 && aColumn <= 5 && "Index out of bounds!");
@@ -99,13 +111,13 @@ inline const T& Matrix4x4<T>::operator()(const int aRow, const int aColumn) cons
 }
 
 template<typename T>
-inline const Vector4<T>& Matrix4x4<T>::operator()(const int aRow) const
+constexpr const Vector4<T>& Matrix4x4<T>::operator()(const int aRow) const
 {
 	return m_data[aRow - 1];
 }
 
 template<typename T>
-inline Matrix4x4<T> operator+(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
+constexpr Matrix4x4<T> operator+(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
 {
 	Matrix4x4<T> mat =
 	{
@@ -119,25 +131,25 @@ inline Matrix4x4<T> operator+(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo
 }
 
 template<typename T>
-inline void Matrix4x4<T>::operator+=(const Matrix4x4<T>& aMat)
+constexpr void Matrix4x4<T>::operator+=(const Matrix4x4<T>& aMat)
 {
-	m_data[0] += aMat.myData[0];
-	m_data[1] += aMat.myData[1];
-	m_data[2] += aMat.myData[2];
-	m_data[3] += aMat.myData[3];
+	m_data[0] += aMat.m_data[0];
+	m_data[1] += aMat.m_data[1];
+	m_data[2] += aMat.m_data[2];
+	m_data[3] += aMat.m_data[3];
 }
 
 template<typename T>
-inline void Matrix4x4<T>::operator-=(const Matrix4x4<T>& aMat)
+constexpr void Matrix4x4<T>::operator-=(const Matrix4x4<T>& aMat)
 {
-	m_data[0] -= aMat.myData[0];
-	m_data[1] -= aMat.myData[1];
-	m_data[2] -= aMat.myData[2];
-	m_data[3] -= aMat.myData[3];
+	m_data[0] -= aMat.m_data[0];
+	m_data[1] -= aMat.m_data[1];
+	m_data[2] -= aMat.m_data[2];
+	m_data[3] -= aMat.m_data[3];
 }
 
 template<typename T>
-inline Matrix4x4<T> operator-(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
+constexpr Matrix4x4<T> operator-(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
 {
 	Matrix4x4<T> mat =
 	{
@@ -151,7 +163,7 @@ inline Matrix4x4<T> operator-(Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo
 }
 
 template<typename T>
-inline Matrix4x4<T> operator*(const Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
+constexpr Matrix4x4<T> operator*(const Matrix4x4<T>& aMatOne, const Matrix4x4<T>& aMatTwo)
 {
 	Matrix4x4<T> result;
 	result(1, 1) = aMatOne(1, 1) * aMatTwo(1, 1) + aMatOne(1, 2) * aMatTwo(2, 1) + aMatOne(1, 3) * aMatTwo(3, 1) + aMatOne(1, 4) * aMatTwo(4, 1);
@@ -178,13 +190,13 @@ inline Matrix4x4<T> operator*(const Matrix4x4<T>& aMatOne, const Matrix4x4<T>& a
 }
 
 template<typename T>
-inline void Matrix4x4<T>::operator*=(const Matrix4x4<T>& aMat)
+constexpr void Matrix4x4<T>::operator*=(const Matrix4x4<T>& aMat)
 {
 	*this = *this * aMat;
 }
 
 template<typename T>
-inline Vector4<T> operator*(const Vector4<T>& aVec, const Matrix4x4<T>& aMat)
+constexpr Vector4<T> operator*(const Vector4<T>& aVec, const Matrix4x4<T>& aMat)
 {
 	Vector4<T> vec =
 	{
@@ -198,16 +210,7 @@ inline Vector4<T> operator*(const Vector4<T>& aVec, const Matrix4x4<T>& aMat)
 }
 
 template<typename T>
-inline void Matrix4x4<T>::operator=(const Matrix4x4<T>& aOther)
-{
-	m_data[0] = aOther.myData[0];
-	m_data[1] = aOther.myData[1];
-	m_data[2] = aOther.myData[2];
-	m_data[3] = aOther.myData[3];
-}
-
-template<typename T>
-inline bool operator==(const Matrix4x4<T>& aFirst, const Matrix4x4<T>& aSecond)
+constexpr bool operator==(const Matrix4x4<T>& aFirst, const Matrix4x4<T>& aSecond)
 {
 	return aFirst(1) == aSecond(1) &&
 		aFirst(2) == aSecond(2) &&
@@ -216,13 +219,24 @@ inline bool operator==(const Matrix4x4<T>& aFirst, const Matrix4x4<T>& aSecond)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundX(T aAngleInRadians)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundX(T aAngleInRadians)
+{
+	return CreateRotationAroundXWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundXWith(T aAngleInRadians)
 {
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix4x4<T> mat =
 	{
 		Vector4<T>{ 1, 0, 0, 0},
-		Vector4<T>{ 0, std::cos(aAngleInRadians), std::sin(aAngleInRadians), 0 },
-		Vector4<T>{ 0, -std::sin(aAngleInRadians), std::cos(aAngleInRadians), 0 },
+		Vector4<T>{ 0, cos, sin, 0 },
+		Vector4<T>{ 0, -sin, cos, 0 },
 		Vector4<T>{ 0, 0, 0, 1 }
 	};
 
@@ -230,13 +244,24 @@ inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundX(T aAngleInRadians)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundY(T aAngleInRadians)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundY(T aAngleInRadians)
+{
+	return CreateRotationAroundYWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundYWith(T aAngleInRadians)
 {
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix4x4<T> mat =
 	{
-		Vector4<T>{ std::cos(aAngleInRadians), 0, -std::sin(aAngleInRadians), 0 },
+		Vector4<T>{ cos, 0, -sin, 0 },
 		Vector4<T>{ 0, 1, 0, 0 },
-		Vector4<T>{ std::sin(aAngleInRadians), 0, std::cos(aAngleInRadians), 0 },
+		Vector4<T>{ sin, 0, cos, 0 },
 		Vector4<T>{ 0, 0, 0, 1 }
 	};
 
@@ -244,12 +269,23 @@ inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundY(T aAngleInRadians)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundZ(T aAngleInRadians)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundZ(T aAngleInRadians)
 {
+	return CreateRotationAroundZWith<Ohm::Math::DefaultAccuracy>(aAngleInRadians);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundZWith(T aAngleInRadians)
+{
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(aAngleInRadians, sin, cos);
+
 	Matrix4x4<T> mat =
 	{
-		Vector4<T>{ std::cos(aAngleInRadians), std::sin(aAngleInRadians), 0, 0 },
-		Vector4<T>{ -std::sin(aAngleInRadians), std::cos(aAngleInRadians), 0, 0 },
+		Vector4<T>{ cos, sin, 0, 0 },
+		Vector4<T>{ -sin, cos, 0, 0 },
 		Vector4<T>{ 0, 0, 1, 0 },
 		Vector4<T>{ 0, 0, 0, 1 }
 	};
@@ -258,13 +294,20 @@ inline Matrix4x4<T> Matrix4x4<T>::CreateRotationAroundZ(T aAngleInRadians)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateRotation(T aXAngle, T aYAngle, T aZAngle)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotation(T aXAngle, T aYAngle, T aZAngle)
 {
-	return CreateRotationAroundX(aXAngle) * CreateRotationAroundY(aYAngle) * CreateRotationAroundZ(aZAngle);
+	return CreateRotationWith<Ohm::Math::DefaultAccuracy>(aXAngle, aYAngle, aZAngle);
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::Transpose(const Matrix4x4<T>& aMat)
+template<MathAccuracy Accuracy>
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateRotationWith(T aXAngle, T aYAngle, T aZAngle)
+{
+	return CreateRotationAroundXWith<Accuracy>(aXAngle) * CreateRotationAroundYWith<Accuracy>(aYAngle) * CreateRotationAroundZWith<Accuracy>(aZAngle);
+}
+
+template<typename T>
+constexpr Matrix4x4<T> Matrix4x4<T>::Transpose(const Matrix4x4<T>& aMat)
 {
 	Matrix4x4<T> mat
 	{
@@ -278,7 +321,7 @@ inline Matrix4x4<T> Matrix4x4<T>::Transpose(const Matrix4x4<T>& aMat)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::GetFastInverse(const Matrix4x4<T>& aTransform)
+constexpr Matrix4x4<T> Matrix4x4<T>::GetFastInverse(const Matrix4x4<T>& aTransform)
 {
 	Matrix3x3<T> rotMat;
 	rotMat(1, 1) = aTransform(1, 1);
@@ -310,7 +353,116 @@ inline Matrix4x4<T> Matrix4x4<T>::GetFastInverse(const Matrix4x4<T>& aTransform)
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateLookAt(const Vector3<T>& aEye, const Vector3<T>& aCenter, const Vector3<T>& aUp)
+inline bool Matrix4x4<T>::Inverse(const Matrix4x4<T>& aMatrix, Matrix4x4<T>& aOutInverse, T* aOutDeterminant)
+{
+	const Vector4<T>* m = aMatrix.m_data;
+
+	// 2x2 determinants of the upper and lower row pairs.
+	const T s0 = m[0].x * m[1].y - m[1].x * m[0].y;
+	const T s1 = m[0].x * m[1].z - m[1].x * m[0].z;
+	const T s2 = m[0].x * m[1].w - m[1].x * m[0].w;
+	const T s3 = m[0].y * m[1].z - m[1].y * m[0].z;
+	const T s4 = m[0].y * m[1].w - m[1].y * m[0].w;
+	const T s5 = m[0].z * m[1].w - m[1].z * m[0].w;
+
+	const T c5 = m[2].z * m[3].w - m[3].z * m[2].w;
+	const T c4 = m[2].y * m[3].w - m[3].y * m[2].w;
+	const T c3 = m[2].y * m[3].z - m[3].y * m[2].z;
+	const T c2 = m[2].x * m[3].w - m[3].x * m[2].w;
+	const T c1 = m[2].x * m[3].z - m[3].x * m[2].z;
+	const T c0 = m[2].x * m[3].y - m[3].x * m[2].y;
+
+	const T determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	if (determinant == static_cast<T>(0))
+	{
+		return false;
+	}
+
+	const T invDet = static_cast<T>(1) / determinant;
+
+	aOutInverse = Matrix4x4<T>
+	{
+		Vector4<T>
+		{
+			(m[1].y * c5 - m[1].z * c4 + m[1].w * c3) * invDet,
+			(-m[0].y * c5 + m[0].z * c4 - m[0].w * c3) * invDet,
+			(m[3].y * s5 - m[3].z * s4 + m[3].w * s3) * invDet,
+			(-m[2].y * s5 + m[2].z * s4 - m[2].w * s3) * invDet
+		},
+		Vector4<T>
+		{
+			(-m[1].x * c5 + m[1].z * c2 - m[1].w * c1) * invDet,
+			(m[0].x * c5 - m[0].z * c2 + m[0].w * c1) * invDet,
+			(-m[3].x * s5 + m[3].z * s2 - m[3].w * s1) * invDet,
+			(m[2].x * s5 - m[2].z * s2 + m[2].w * s1) * invDet
+		},
+		Vector4<T>
+		{
+			(m[1].x * c4 - m[1].y * c2 + m[1].w * c0) * invDet,
+			(-m[0].x * c4 + m[0].y * c2 - m[0].w * c0) * invDet,
+			(m[3].x * s4 - m[3].y * s2 + m[3].w * s0) * invDet,
+			(-m[2].x * s4 + m[2].y * s2 - m[2].w * s0) * invDet
+		},
+		Vector4<T>
+		{
+			(-m[1].x * c3 + m[1].y * c1 - m[1].z * c0) * invDet,
+			(m[0].x * c3 - m[0].y * c1 + m[0].z * c0) * invDet,
+			(-m[3].x * s3 + m[3].y * s1 - m[3].z * s0) * invDet,
+			(m[2].x * s3 - m[2].y * s1 + m[2].z * s0) * invDet
+		}
+	};
+
+	return true;
+}
+
+template<typename T>
+inline bool Matrix4x4<T>::InverseAffine(const Matrix4x4<T>& aTransform, Matrix4x4<T>& aOutInverse, T* aOutDeterminant)
+{
+	const Vector3<T> row0{ aTransform(1, 1), aTransform(1, 2), aTransform(1, 3) };
+	const Vector3<T> row1{ aTransform(2, 1), aTransform(2, 2), aTransform(2, 3) };
+	const Vector3<T> row2{ aTransform(3, 1), aTransform(3, 2), aTransform(3, 3) };
+
+	// The columns of the inverse 3x3 are the cross products of the rows divided by the determinant.
+	const Vector3<T> column0 = row1.Cross(row2);
+	const Vector3<T> column1 = row2.Cross(row0);
+	const Vector3<T> column2 = row0.Cross(row1);
+
+	const T determinant = row0.Dot(column0);
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	if (determinant == static_cast<T>(0))
+	{
+		return false;
+	}
+
+	const T invDet = static_cast<T>(1) / determinant;
+	const Vector3<T> inverseRow0 = Vector3<T>{ column0.x, column1.x, column2.x } * invDet;
+	const Vector3<T> inverseRow1 = Vector3<T>{ column0.y, column1.y, column2.y } * invDet;
+	const Vector3<T> inverseRow2 = Vector3<T>{ column0.z, column1.z, column2.z } * invDet;
+
+	const Vector3<T> translation = (inverseRow0 * aTransform(4, 1) + inverseRow1 * aTransform(4, 2) + inverseRow2 * aTransform(4, 3)) * static_cast<T>(-1);
+
+	aOutInverse = Matrix4x4<T>
+	{
+		Vector4<T>{ inverseRow0, static_cast<T>(0) },
+		Vector4<T>{ inverseRow1, static_cast<T>(0) },
+		Vector4<T>{ inverseRow2, static_cast<T>(0) },
+		Vector4<T>{ translation, static_cast<T>(1) }
+	};
+
+	return true;
+}
+
+template<typename T>
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateLookAt(const Vector3<T>& aEye, const Vector3<T>& aCenter, const Vector3<T>& aUp)
 {
 	Vector3<T> const forward = (aCenter - aEye).GetNormalized();
 	Vector3<T> const right = aUp.Cross(forward).GetNormalized();
@@ -328,10 +480,10 @@ inline Matrix4x4<T> Matrix4x4<T>::CreateLookAt(const Vector3<T>& aEye, const Vec
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreatePerspective(T aFOV, T aAspect, T aNear, T aFar)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreatePerspective(T aFOV, T aAspect, T aNear, T aFar)
 {
-	assert(std::abs(aAspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
-	T const tanHalfFOV = tan(aFOV / static_cast<T>(2));
+	assert(Ohm::Math::Abs(aAspect - std::numeric_limits<T>::epsilon()) > static_cast<T>(0));
+	T const tanHalfFOV = Ohm::Math::Tan(aFOV / static_cast<T>(2));
 
 	Matrix4x4<T> result =
 	{
@@ -345,7 +497,7 @@ inline Matrix4x4<T> Matrix4x4<T>::CreatePerspective(T aFOV, T aAspect, T aNear,
 }
 
 template<typename T>
-inline Matrix4x4<T> Matrix4x4<T>::CreateTranslation(const Vector3<T>& aPos)
+constexpr Matrix4x4<T> Matrix4x4<T>::CreateTranslation(const Vector3<T>& aPos)
 {
 	Matrix4x4<T> result;
 
@@ -353,3 +505,6 @@ inline Matrix4x4<T> Matrix4x4<T>::CreateTranslation(const Vector3<T>& aPos)
 
 	return result;
 }
+
+#include "Ohm/Matrix/Matrix3x3.hpp"
+#include "Ohm/Matrix/Matrix4x4Simd.hpp"
\ No newline at end of file
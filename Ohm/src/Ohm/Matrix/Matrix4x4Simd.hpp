@@ -0,0 +1,257 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#if defined(OHM_SIMD_SSE2)
+
+// Row-broadcast kernels for Matrix4x4<float>.
+// All kernels work on 16 byte aligned, row-major float[16] data and may be called with aResult aliasing an input.
+//
+// Without FMA the kernels accumulate in the same order as the scalar operator*, so results are bit-identical.
+// With FMA every element is within 4 ULP of sum(|aLhs(i, k) * aRhs(k, j)|) of the scalar result.
+namespace Ohm::Simd
+{
+	inline void MultiplyMatrix4x4SSE(const float* aLhs, const float* aRhs, float* aResult)
+	{
+		const __m128 rhsRow0 = _mm_load_ps(aRhs + 0);
+		const __m128 rhsRow1 = _mm_load_ps(aRhs + 4);
+		const __m128 rhsRow2 = _mm_load_ps(aRhs + 8);
+		const __m128 rhsRow3 = _mm_load_ps(aRhs + 12);
+
+		__m128 result[4];
+		for (int row = 0; row < 4; row++)
+		{
+			const __m128 lhsRow = _mm_load_ps(aLhs + row * 4);
+
+			__m128 value = _mm_mul_ps(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+			value = MultiplyAdd(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1, value);
+			value = MultiplyAdd(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2, value);
+			result[row] = MultiplyAdd(_mm_shuffle_ps(lhsRow, lhsRow, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3, value);
+		}
+
+		_mm_store_ps(aResult + 0, result[0]);
+		_mm_store_ps(aResult + 4, result[1]);
+		_mm_store_ps(aResult + 8, result[2]);
+		_mm_store_ps(aResult + 12, result[3]);
+	}
+
+#if defined(OHM_SIMD_AVX)
+	// Computes two result rows per iteration, one in each 128 bit lane.
+	inline void MultiplyMatrix4x4AVX(const float* aLhs, const float* aRhs, float* aResult)
+	{
+		const __m256 rhsRow0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aRhs + 0));
+		const __m256 rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aRhs + 4));
+		const __m256 rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aRhs + 8));
+		const __m256 rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(aRhs + 12));
+
+		__m256 result[2];
+		for (int rowPair = 0; rowPair < 2; rowPair++)
+		{
+			const __m256 lhsRows = _mm256_loadu_ps(aLhs + rowPair * 8);
+
+			__m256 value = _mm256_mul_ps(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+			value = MultiplyAdd(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1, value);
+			value = MultiplyAdd(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2, value);
+			result[rowPair] = MultiplyAdd(_mm256_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3, value);
+		}
+
+		_mm256_storeu_ps(aResult + 0, result[0]);
+		_mm256_storeu_ps(aResult + 8, result[1]);
+	}
+#endif
+
+	inline __m128 TransformVector4(__m128 aVector, const float* aMatrix)
+	{
+		__m128 value = _mm_mul_ps(_mm_shuffle_ps(aVector, aVector, _MM_SHUFFLE(0, 0, 0, 0)), _mm_load_ps(aMatrix + 0));
+		value = MultiplyAdd(_mm_shuffle_ps(aVector, aVector, _MM_SHUFFLE(1, 1, 1, 1)), _mm_load_ps(aMatrix + 4), value);
+		value = MultiplyAdd(_mm_shuffle_ps(aVector, aVector, _MM_SHUFFLE(2, 2, 2, 2)), _mm_load_ps(aMatrix + 8), value);
+		return MultiplyAdd(_mm_shuffle_ps(aVector, aVector, _MM_SHUFFLE(3, 3, 3, 3)), _mm_load_ps(aMatrix + 12), value);
+	}
+
+	// 2x2 row-major matrix helpers for the block inverse, a register holds (m00, m01, m10, m11).
+	inline __m128 Matrix2x2Multiply(__m128 aA, __m128 aB)
+	{
+		return _mm_add_ps(_mm_mul_ps(aA, _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(3, 0, 3, 0))),
+			_mm_mul_ps(_mm_shuffle_ps(aA, aA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// adjugate(aA) * aB
+	inline __m128 Matrix2x2AdjugateMultiply(__m128 aA, __m128 aB)
+	{
+		return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(aA, aA, _MM_SHUFFLE(0, 0, 3, 3)), aB),
+			_mm_mul_ps(_mm_shuffle_ps(aA, aA, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(1, 0, 3, 2))));
+	}
+
+	// aA * adjugate(aB)
+	inline __m128 Matrix2x2MultiplyAdjugate(__m128 aA, __m128 aB)
+	{
+		return _mm_sub_ps(_mm_mul_ps(aA, _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(0, 3, 0, 3))),
+			_mm_mul_ps(_mm_shuffle_ps(aA, aA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(1, 2, 1, 2))));
+	}
+
+	// Block-wise inverse through the 2x2 sub-matrix adjugates. Returns the determinant in all lanes,
+	// aResult is only written when it is non-zero.
+	inline __m128 InverseMatrix4x4(const float* aMatrix, float* aResult)
+	{
+		const __m128 row0 = _mm_load_ps(aMatrix + 0);
+		const __m128 row1 = _mm_load_ps(aMatrix + 4);
+		const __m128 row2 = _mm_load_ps(aMatrix + 8);
+		const __m128 row3 = _mm_load_ps(aMatrix + 12);
+
+		const __m128 a = _mm_movelh_ps(row0, row1);
+		const __m128 b = _mm_movehl_ps(row1, row0);
+		const __m128 c = _mm_movelh_ps(row2, row3);
+		const __m128 d = _mm_movehl_ps(row3, row2);
+
+		// (|A|, |B|, |C|, |D|)
+		const __m128 subDeterminants = _mm_sub_ps(
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+			_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+		const __m128 detA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 detB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 detC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+		const __m128 detD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+		const __m128 adjugateDC = Matrix2x2AdjugateMultiply(d, c);
+		const __m128 adjugateAB = Matrix2x2AdjugateMultiply(a, b);
+
+		__m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), Matrix2x2Multiply(b, adjugateDC));
+		__m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), Matrix2x2Multiply(c, adjugateAB));
+		__m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), Matrix2x2MultiplyAdjugate(d, adjugateAB));
+		__m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), Matrix2x2MultiplyAdjugate(a, adjugateDC));
+
+		// |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+		__m128 trace = _mm_mul_ps(adjugateAB, _mm_shuffle_ps(adjugateDC, adjugateDC, _MM_SHUFFLE(3, 1, 2, 0)));
+		trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+		trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+
+		const __m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), trace);
+		if (_mm_cvtss_f32(determinant) == 0.f)
+		{
+			return determinant;
+		}
+
+		const __m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), determinant);
+		x = _mm_mul_ps(x, reciprocal);
+		y = _mm_mul_ps(y, reciprocal);
+		z = _mm_mul_ps(z, reciprocal);
+		w = _mm_mul_ps(w, reciprocal);
+
+		// The adjugate swizzle and the transposed block layout are folded into the stores.
+		_mm_store_ps(aResult + 0, _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_store_ps(aResult + 4, _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+		_mm_store_ps(aResult + 8, _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+		_mm_store_ps(aResult + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+
+		return determinant;
+	}
+
+	inline __m128 Cross3(__m128 aA, __m128 aB)
+	{
+		const __m128 aYZX = _mm_shuffle_ps(aA, aA, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 bYZX = _mm_shuffle_ps(aB, aB, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 product = _mm_sub_ps(_mm_mul_ps(aA, bYZX), _mm_mul_ps(aYZX, aB));
+
+		return _mm_shuffle_ps(product, product, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	// Inverse of an affine transform with (0, 0, 0, 1) as last column. Returns the determinant of the upper 3x3 in all lanes,
+	// aResult is only written when it is non-zero.
+	inline __m128 InverseAffineMatrix4x4(const float* aMatrix, float* aResult)
+	{
+		const __m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 row0 = _mm_and_ps(_mm_load_ps(aMatrix + 0), xyzMask);
+		const __m128 row1 = _mm_and_ps(_mm_load_ps(aMatrix + 4), xyzMask);
+		const __m128 row2 = _mm_and_ps(_mm_load_ps(aMatrix + 8), xyzMask);
+		const __m128 translation = _mm_load_ps(aMatrix + 12);
+
+		__m128 column0 = Cross3(row1, row2);
+		__m128 column1 = Cross3(row2, row0);
+		__m128 column2 = Cross3(row0, row1);
+
+		const __m128 determinant = Dot4(row0, column0);
+		if (_mm_cvtss_f32(determinant) == 0.f)
+		{
+			return determinant;
+		}
+
+		const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.f), determinant);
+		column0 = _mm_mul_ps(column0, invDet);
+		column1 = _mm_mul_ps(column1, invDet);
+		column2 = _mm_mul_ps(column2, invDet);
+
+		__m128 column3 = _mm_setzero_ps();
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+
+		__m128 inverseTranslation = _mm_mul_ps(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(0, 0, 0, 0)), column0);
+		inverseTranslation = MultiplyAdd(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(1, 1, 1, 1)), column1, inverseTranslation);
+		inverseTranslation = MultiplyAdd(_mm_shuffle_ps(translation, translation, _MM_SHUFFLE(2, 2, 2, 2)), column2, inverseTranslation);
+		inverseTranslation = _mm_sub_ps(_mm_setr_ps(0.f, 0.f, 0.f, 1.f), inverseTranslation);
+
+		_mm_store_ps(aResult + 0, column0);
+		_mm_store_ps(aResult + 4, column1);
+		_mm_store_ps(aResult + 8, column2);
+		_mm_store_ps(aResult + 12, inverseTranslation);
+
+		return determinant;
+	}
+
+	// Picks the widest kernel the translation unit is compiled for.
+	inline void MultiplyMatrix4x4(const float* aLhs, const float* aRhs, float* aResult)
+	{
+#if defined(OHM_SIMD_AVX)
+		MultiplyMatrix4x4AVX(aLhs, aRhs, aResult);
+#else
+		MultiplyMatrix4x4SSE(aLhs, aRhs, aResult);
+#endif
+	}
+}
+
+constexpr Matrix4x4<float> operator*(const Matrix4x4<float>& aMatOne, const Matrix4x4<float>& aMatTwo)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return operator*<float>(aMatOne, aMatTwo);
+	}
+
+	Matrix4x4<float> result;
+	Ohm::Simd::MultiplyMatrix4x4(&aMatOne(1).x, &aMatTwo(1).x, &result(1).x);
+
+	return result;
+}
+
+template<>
+inline bool Matrix4x4<float>::Inverse(const Matrix4x4<float>& aMatrix, Matrix4x4<float>& aOutInverse, float* aOutDeterminant)
+{
+	const float determinant = _mm_cvtss_f32(Ohm::Simd::InverseMatrix4x4(&aMatrix(1).x, &aOutInverse(1).x));
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	return determinant != 0.f;
+}
+
+template<>
+inline bool Matrix4x4<float>::InverseAffine(const Matrix4x4<float>& aTransform, Matrix4x4<float>& aOutInverse, float* aOutDeterminant)
+{
+	const float determinant = _mm_cvtss_f32(Ohm::Simd::InverseAffineMatrix4x4(&aTransform(1).x, &aOutInverse(1).x));
+	if (aOutDeterminant)
+	{
+		*aOutDeterminant = determinant;
+	}
+
+	return determinant != 0.f;
+}
+
+constexpr Vector4<float> operator*(const Vector4<float>& aVec, const Matrix4x4<float>& aMat)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return operator*<float>(aVec, aMat);
+	}
+	return Vector4<float>(Ohm::Simd::TransformVector4(aVec.myRegister, &aMat(1).x));
+}
+
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Ohm/Matrix/Matrix3x4.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Vector/Vector4.hpp"
+
+#include <cstddef>
+
+// Batch transforms of contiguous point/direction arrays by a single Matrix4x4 or Matrix3x4.
+// Points are treated as row vectors (aPoint * aMatrix), matching Vector4<T> * Matrix4x4<T>.
+// aOut may be the same array as the input, partially overlapping ranges are not supported.
+
+// Transforms points as (x, y, z, 1).
+template<typename T>
+inline void TransformPoints(const Matrix4x4<T>& aMatrix, const Vector3<T>* aPoints, Vector3<T>* aOut, size_t aCount)
+{
+	const Vector4<T> row1 = aMatrix(1);
+	const Vector4<T> row2 = aMatrix(2);
+	const Vector4<T> row3 = aMatrix(3);
+	const Vector4<T> row4 = aMatrix(4);
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector3<T> point = aPoints[i];
+		aOut[i].x = point.x * row1.x + point.y * row2.x + point.z * row3.x + row4.x;
+		aOut[i].y = point.x * row1.y + point.y * row2.y + point.z * row3.y + row4.y;
+		aOut[i].z = point.x * row1.z + point.y * row2.z + point.z * row3.z + row4.z;
+	}
+}
+
+// Transforms directions as (x, y, z, 0), the translation row is ignored.
+template<typename T>
+inline void TransformDirections(const Matrix4x4<T>& aMatrix, const Vector3<T>* aDirections, Vector3<T>* aOut, size_t aCount)
+{
+	const Vector4<T> row1 = aMatrix(1);
+	const Vector4<T> row2 = aMatrix(2);
+	const Vector4<T> row3 = aMatrix(3);
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector3<T> direction = aDirections[i];
+		aOut[i].x = direction.x * row1.x + direction.y * row2.x + direction.z * row3.x;
+		aOut[i].y = direction.x * row1.y + direction.y * row2.y + direction.z * row3.y;
+		aOut[i].z = direction.x * row1.z + direction.y * row2.z + direction.z * row3.z;
+	}
+}
+
+// Transforms points as (x, y, z, 1) and divides the result by w.
+template<typename T>
+inline void TransformPointsProjective(const Matrix4x4<T>& aMatrix, const Vector3<T>* aPoints, Vector3<T>* aOut, size_t aCount)
+{
+	const Vector4<T> row1 = aMatrix(1);
+	const Vector4<T> row2 = aMatrix(2);
+	const Vector4<T> row3 = aMatrix(3);
+	const Vector4<T> row4 = aMatrix(4);
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector3<T> point = aPoints[i];
+		const T w = point.x * row1.w + point.y * row2.w + point.z * row3.w + row4.w;
+		const T x = point.x * row1.x + point.y * row2.x + point.z * row3.x + row4.x;
+		const T y = point.x * row1.y + point.y * row2.y + point.z * row3.y + row4.y;
+		const T z = point.x * row1.z + point.y * row2.z + point.z * row3.z + row4.z;
+
+		aOut[i].x = x / w;
+		aOut[i].y = y / w;
+		aOut[i].z = z / w;
+	}
+}
+
+// Transforms homogeneous points, the input w is used as is.
+template<typename T>
+inline void TransformPoints(const Matrix4x4<T>& aMatrix, const Vector4<T>* aPoints, Vector4<T>* aOut, size_t aCount)
+{
+	for (size_t i = 0; i < aCount; i++)
+	{
+		aOut[i] = aPoints[i] * aMatrix;
+	}
+}
+
+// Transforms directions, the input w is treated as 0.
+template<typename T>
+inline void TransformDirections(const Matrix4x4<T>& aMatrix, const Vector4<T>* aDirections, Vector4<T>* aOut, size_t aCount)
+{
+	for (size_t i = 0; i < aCount; i++)
+	{
+		aOut[i] = Vector4<T>(aDirections[i].x, aDirections[i].y, aDirections[i].z, static_cast<T>(0)) * aMatrix;
+	}
+}
+
+// Transforms homogeneous points and divides the result by its w.
+template<typename T>
+inline void TransformPointsProjective(const Matrix4x4<T>& aMatrix, const Vector4<T>* aPoints, Vector4<T>* aOut, size_t aCount)
+{
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector4<T> point = aPoints[i] * aMatrix;
+		aOut[i] = point / point.w;
+	}
+}
+
+// Matrix3x4 rows are the Matrix4x4 columns, every output component is one row dotted with (x, y, z, 1).
+template<typename T>
+inline void TransformPoints(const Matrix3x4<T>& aMatrix, const Vector3<T>* aPoints, Vector3<T>* aOut, size_t aCount)
+{
+	const Vector4<T> row1 = aMatrix(1);
+	const Vector4<T> row2 = aMatrix(2);
+	const Vector4<T> row3 = aMatrix(3);
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector3<T> point = aPoints[i];
+		aOut[i].x = point.x * row1.x + point.y * row1.y + point.z * row1.z + row1.w;
+		aOut[i].y = point.x * row2.x + point.y * row2.y + point.z * row2.z + row2.w;
+		aOut[i].z = point.x * row3.x + point.y * row3.y + point.z * row3.z + row3.w;
+	}
+}
+
+template<typename T>
+inline void TransformDirections(const Matrix3x4<T>& aMatrix, const Vector3<T>* aDirections, Vector3<T>* aOut, size_t aCount)
+{
+	const Vector4<T> row1 = aMatrix(1);
+	const Vector4<T> row2 = aMatrix(2);
+	const Vector4<T> row3 = aMatrix(3);
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		const Vector3<T> direction = aDirections[i];
+		aOut[i].x = direction.x * row1.x + direction.y * row1.y + direction.z * row1.z;
+		aOut[i].y = direction.x * row2.x + direction.y * row2.y + direction.z * row2.z;
+		aOut[i].z = direction.x * row3.x + direction.y * row3.y + direction.z * row3.z;
+	}
+}
+
+#include "Ohm/Matrix/TransformBatchSimd.hpp"
+
+// Threaded versions of all of the above, for any matrix and vector pair they support. aPool runs the same kernels
+// on ParallelGrain sized chunks, the results match the single threaded calls exactly. A null aPool runs them inline.
+template<typename Matrix, typename Vector>
+inline void TransformPoints(const Matrix& aMatrix, const Vector* aPoints, Vector* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Vector) * 2), [&](size_t aBegin, size_t aEnd)
+	{
+		TransformPoints(aMatrix, aPoints + aBegin, aOut + aBegin, aEnd - aBegin);
+	});
+}
+
+template<typename Matrix, typename Vector>
+inline void TransformDirections(const Matrix& aMatrix, const Vector* aDirections, Vector* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Vector) * 2), [&](size_t aBegin, size_t aEnd)
+	{
+		TransformDirections(aMatrix, aDirections + aBegin, aOut + aBegin, aEnd - aBegin);
+	});
+}
+
+template<typename Matrix, typename Vector>
+inline void TransformPointsProjective(const Matrix& aMatrix, const Vector* aPoints, Vector* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Vector) * 2), [&](size_t aBegin, size_t aEnd)
+	{
+		TransformPointsProjective(aMatrix, aPoints + aBegin, aOut + aBegin, aEnd - aBegin);
+	});
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#if defined(OHM_SIMD_SSE2)
+
+// SIMD batch transforms for float arrays.
+// Vector3<float> arrays are transposed to x/y/z registers four (SSE) or eight (AVX) points at a time,
+// the remaining tail goes through the scalar templates. Accumulation order matches the scalar path.
+namespace Ohm::Simd
+{
+	enum class TransformMode
+	{
+		Point,
+		Direction,
+		ProjectivePoint
+	};
+
+	// Transforms floor(aCount / 4) * 4 points and returns how many were processed.
+	template<TransformMode Mode>
+	inline size_t TransformVector3SSE(const float* aMatrix, const float* aIn, float* aOut, size_t aCount)
+	{
+		__m128 m[16];
+		for (int i = 0; i < 16; i++)
+		{
+			m[i] = _mm_set1_ps(aMatrix[i]);
+		}
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			__m128 x, y, z;
+			LoadVector3x4(aIn + i * 3, x, y, z);
+
+			__m128 out[4];
+			for (int column = 0; column < (Mode == TransformMode::ProjectivePoint ? 4 : 3); column++)
+			{
+				__m128 value = _mm_mul_ps(x, m[column]);
+				value = MultiplyAdd(y, m[4 + column], value);
+				value = MultiplyAdd(z, m[8 + column], value);
+				if constexpr (Mode != TransformMode::Direction)
+				{
+					value = _mm_add_ps(value, m[12 + column]);
+				}
+				out[column] = value;
+			}
+
+			if constexpr (Mode == TransformMode::ProjectivePoint)
+			{
+				out[0] = _mm_div_ps(out[0], out[3]);
+				out[1] = _mm_div_ps(out[1], out[3]);
+				out[2] = _mm_div_ps(out[2], out[3]);
+			}
+
+			StoreVector3x4(aOut + i * 3, out[0], out[1], out[2]);
+		}
+
+		return i;
+	}
+
+	// Transforms floor(aCount / 4) * 4 homogeneous points and returns how many were processed.
+	template<TransformMode Mode>
+	inline size_t TransformVector4SSE(const float* aMatrix, const float* aIn, float* aOut, size_t aCount)
+	{
+		const __m128 row1 = _mm_load_ps(aMatrix + 0);
+		const __m128 row2 = _mm_load_ps(aMatrix + 4);
+		const __m128 row3 = _mm_load_ps(aMatrix + 8);
+		const __m128 row4 = _mm_load_ps(aMatrix + 12);
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			__m128 out[4];
+			for (int j = 0; j < 4; j++)
+			{
+				const __m128 point = _mm_load_ps(aIn + (i + j) * 4);
+
+				__m128 value = _mm_mul_ps(_mm_shuffle_ps(point, point, _MM_SHUFFLE(0, 0, 0, 0)), row1);
+				value = MultiplyAdd(_mm_shuffle_ps(point, point, _MM_SHUFFLE(1, 1, 1, 1)), row2, value);
+				value = MultiplyAdd(_mm_shuffle_ps(point, point, _MM_SHUFFLE(2, 2, 2, 2)), row3, value);
+				if constexpr (Mode != TransformMode::Direction)
+				{
+					value = MultiplyAdd(_mm_shuffle_ps(point, point, _MM_SHUFFLE(3, 3, 3, 3)), row4, value);
+				}
+				if constexpr (Mode == TransformMode::ProjectivePoint)
+				{
+					value = _mm_div_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(3, 3, 3, 3)));
+				}
+				out[j] = value;
+			}
+
+			for (int j = 0; j < 4; j++)
+			{
+				_mm_store_ps(aOut + (i + j) * 4, out[j]);
+			}
+		}
+
+		return i;
+	}
+
+#if defined(OHM_SIMD_AVX)
+	// Transforms floor(aCount / 8) * 8 points and returns how many were processed.
+	template<TransformMode Mode>
+	inline size_t TransformVector3AVX(const float* aMatrix, const float* aIn, float* aOut, size_t aCount)
+	{
+		__m256 m[16];
+		for (int i = 0; i < 16; i++)
+		{
+			m[i] = _mm256_set1_ps(aMatrix[i]);
+		}
+
+		size_t i = 0;
+		for (; i + 8 <= aCount; i += 8)
+		{
+			__m256 x, y, z;
+			LoadVector3x8(aIn + i * 3, x, y, z);
+
+			__m256 out[4];
+			for (int column = 0; column < (Mode == TransformMode::ProjectivePoint ? 4 : 3); column++)
+			{
+				__m256 value = _mm256_mul_ps(x, m[column]);
+				value = MultiplyAdd(y, m[4 + column], value);
+				value = MultiplyAdd(z, m[8 + column], value);
+				if constexpr (Mode != TransformMode::Direction)
+				{
+					value = _mm256_add_ps(value, m[12 + column]);
+				}
+				out[column] = value;
+			}
+
+			if constexpr (Mode == TransformMode::ProjectivePoint)
+			{
+				out[0] = _mm256_div_ps(out[0], out[3]);
+				out[1] = _mm256_div_ps(out[1], out[3]);
+				out[2] = _mm256_div_ps(out[2], out[3]);
+			}
+
+			StoreVector3x8(aOut + i * 3, out[0], out[1], out[2]);
+		}
+
+		return i;
+	}
+#endif
+
+	template<TransformMode Mode>
+	inline size_t TransformVector3(const float* aMatrix, const float* aIn, float* aOut, size_t aCount)
+	{
+		size_t processed = 0;
+#if defined(OHM_SIMD_AVX)
+		processed = TransformVector3AVX<Mode>(aMatrix, aIn, aOut, aCount);
+#endif
+		return processed + TransformVector3SSE<Mode>(aMatrix, aIn + processed * 3, aOut + processed * 3, aCount - processed);
+	}
+}
+
+inline void TransformPoints(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector3<Ohm::Simd::TransformMode::Point>(&aMatrix(1).x, reinterpret_cast<const float*>(aPoints), reinterpret_cast<float*>(aOut), aCount);
+	TransformPoints<float>(aMatrix, aPoints + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformDirections(const Matrix4x4<float>& aMatrix, const Vector3<float>* aDirections, Vector3<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector3<Ohm::Simd::TransformMode::Direction>(&aMatrix(1).x, reinterpret_cast<const float*>(aDirections), reinterpret_cast<float*>(aOut), aCount);
+	TransformDirections<float>(aMatrix, aDirections + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformPointsProjective(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector3<Ohm::Simd::TransformMode::ProjectivePoint>(&aMatrix(1).x, reinterpret_cast<const float*>(aPoints), reinterpret_cast<float*>(aOut), aCount);
+	TransformPointsProjective<float>(aMatrix, aPoints + processed, aOut + processed, aCount - processed);
+}
+
+// The Vector3 kernels broadcast every matrix element anyway, so Matrix3x4 runs them on the expanded matrix.
+inline void TransformPoints(const Matrix3x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+{
+	const Matrix4x4<float> matrix = aMatrix.ToMatrix4x4();
+	const size_t processed = Ohm::Simd::TransformVector3<Ohm::Simd::TransformMode::Point>(&matrix(1).x, reinterpret_cast<const float*>(aPoints), reinterpret_cast<float*>(aOut), aCount);
+	TransformPoints<float>(aMatrix, aPoints + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformDirections(const Matrix3x4<float>& aMatrix, const Vector3<float>* aDirections, Vector3<float>* aOut, size_t aCount)
+{
+	const Matrix4x4<float> matrix = aMatrix.ToMatrix4x4();
+	const size_t processed = Ohm::Simd::TransformVector3<Ohm::Simd::TransformMode::Direction>(&matrix(1).x, reinterpret_cast<const float*>(aDirections), reinterpret_cast<float*>(aOut), aCount);
+	TransformDirections<float>(aMatrix, aDirections + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformPoints(const Matrix4x4<float>& aMatrix, const Vector4<float>* aPoints, Vector4<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector4SSE<Ohm::Simd::TransformMode::Point>(&aMatrix(1).x, reinterpret_cast<const float*>(aPoints), reinterpret_cast<float*>(aOut), aCount);
+	TransformPoints<float>(aMatrix, aPoints + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformDirections(const Matrix4x4<float>& aMatrix, const Vector4<float>* aDirections, Vector4<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector4SSE<Ohm::Simd::TransformMode::Direction>(&aMatrix(1).x, reinterpret_cast<const float*>(aDirections), reinterpret_cast<float*>(aOut), aCount);
+	TransformDirections<float>(aMatrix, aDirections + processed, aOut + processed, aCount - processed);
+}
+
+inline void TransformPointsProjective(const Matrix4x4<float>& aMatrix, const Vector4<float>* aPoints, Vector4<float>* aOut, size_t aCount)
+{
+	const size_t processed = Ohm::Simd::TransformVector4SSE<Ohm::Simd::TransformMode::ProjectivePoint>(&aMatrix(1).x, reinterpret_cast<const float*>(aPoints), reinterpret_cast<float*>(aOut), aCount);
+	TransformPointsProjective<float>(aMatrix, aPoints + processed, aOut + processed, aCount - processed);
+}
+
+#endif
@@ -0,0 +1,348 @@
+#pragma once
+
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Quaternion/Quaternion.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+#include "Ohm/Vector/Vector4SoA.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Scene graph transforms: local translation, rotation and scale per node, kept in SoA streams in parent-before-child order.
+// Update() rebuilds the local matrices of changed nodes and then computes world = local * parent world in one linear pass,
+// skipping every node whose own TRS and ancestors are unchanged. Matrices use the row vector convention of Matrix4x4<T>,
+// so a point goes through scale, rotation and translation in that order.
+template<class T>
+class TransformHierarchy
+{
+public:
+	static constexpr uint32_t InvalidIndex = ~uint32_t(0);
+
+	TransformHierarchy<T>() = default;
+
+	// Appends a node and returns its index. aParent must be an existing node or InvalidIndex for a root,
+	// which keeps every parent before its children.
+	uint32_t Add(uint32_t aParent, const Vector3<T>& aTranslation = Vector3<T>(static_cast<T>(0)), const Quaternion<T>& aRotation = Quaternion<T>(), const Vector3<T>& aScale = Vector3<T>(static_cast<T>(1)));
+	void Reserve(size_t aCount);
+	void Clear();
+
+	size_t Size() const { return myParents.size(); }
+	uint32_t GetParent(uint32_t aIndex) const { return myParents[aIndex]; }
+
+	Vector3<T> GetTranslation(uint32_t aIndex) const { return myTranslations[aIndex]; }
+	Quaternion<T> GetRotation(uint32_t aIndex) const;
+	Vector3<T> GetScale(uint32_t aIndex) const { return myScales[aIndex]; }
+
+	// Setters mark the node dirty, its world matrix and those below it are recomputed by the next Update().
+	void SetTranslation(uint32_t aIndex, const Vector3<T>& aTranslation);
+	void SetRotation(uint32_t aIndex, const Quaternion<T>& aRotation);
+	void SetScale(uint32_t aIndex, const Vector3<T>& aScale);
+	void SetLocal(uint32_t aIndex, const Vector3<T>& aTranslation, const Quaternion<T>& aRotation, const Vector3<T>& aScale);
+
+	// aPool splits the work over its threads. Nodes of one root subtree always stay in the same task,
+	// so the result is identical with or without a pool.
+	void Update(ThreadPool* aPool = nullptr);
+	bool IsDirty() const { return myDirty; }
+
+	// Valid after Update().
+	const Matrix4x4<T>& GetLocalMatrix(uint32_t aIndex) const { return myLocalMatrices[aIndex]; }
+	const Matrix4x4<T>& GetWorldMatrix(uint32_t aIndex) const { return myWorldMatrices[aIndex]; }
+	const Matrix4x4<T>* GetWorldMatrices() const { return myWorldMatrices.data(); }
+
+private:
+	void MarkDirty(uint32_t aIndex);
+	void UpdateLocalMatrices(size_t aBegin, size_t aEnd);
+	void UpdateWorldMatrix(uint32_t aIndex);
+	void BuildTaskGroups(size_t aGroupCount);
+
+	// The SoA streams grow geometrically and may be longer than Size(), Vector3SoA::Resize alone reallocates every cache line.
+	Vector3SoA<T> myTranslations;
+	Vector4SoA<T> myRotations;
+	Vector3SoA<T> myScales;
+
+	std::vector<uint32_t> myParents;
+	std::vector<uint8_t> myLocalDirty;
+	// Set during Update() for nodes whose world matrix changed, read by their children.
+	std::vector<uint8_t> myWorldChanged;
+	std::vector<Matrix4x4<T>> myLocalMatrices;
+	std::vector<Matrix4x4<T>> myWorldMatrices;
+	bool myDirty = false;
+
+	// Node lists per ParallelFor task, whole root subtrees balanced by size. Rebuilt when nodes are added or the pool size changes.
+	std::vector<std::vector<uint32_t>> myTaskGroups;
+};
+
+template<class T>
+inline uint32_t TransformHierarchy<T>::Add(uint32_t aParent, const Vector3<T>& aTranslation, const Quaternion<T>& aRotation, const Vector3<T>& aScale)
+{
+	assert((aParent == InvalidIndex || aParent < myParents.size()) && "Parent has to be added before its children!");
+
+	const uint32_t index = static_cast<uint32_t>(myParents.size());
+	if (index >= myTranslations.Size())
+	{
+		Reserve(Ohm::Math::Max<size_t>(static_cast<size_t>(index) * 2, 64));
+	}
+
+	myParents.push_back(aParent);
+	myLocalDirty.push_back(0);
+	myWorldChanged.push_back(0);
+	myLocalMatrices.emplace_back();
+	myWorldMatrices.emplace_back();
+	myTaskGroups.clear();
+
+	SetLocal(index, aTranslation, aRotation, aScale);
+	return index;
+}
+
+template<class T>
+inline void TransformHierarchy<T>::Reserve(size_t aCount)
+{
+	if (aCount > myTranslations.Size())
+	{
+		myTranslations.Resize(aCount);
+		myRotations.Resize(aCount);
+		myScales.Resize(aCount);
+	}
+
+	myParents.reserve(aCount);
+	myLocalDirty.reserve(aCount);
+	myWorldChanged.reserve(aCount);
+	myLocalMatrices.reserve(aCount);
+	myWorldMatrices.reserve(aCount);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::Clear()
+{
+	myParents.clear();
+	myLocalDirty.clear();
+	myWorldChanged.clear();
+	myLocalMatrices.clear();
+	myWorldMatrices.clear();
+	myTaskGroups.clear();
+	myDirty = false;
+}
+
+template<class T>
+inline Quaternion<T> TransformHierarchy<T>::GetRotation(uint32_t aIndex) const
+{
+	return Quaternion<T>(myRotations.X()[aIndex], myRotations.Y()[aIndex], myRotations.Z()[aIndex], myRotations.W()[aIndex]);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::SetTranslation(uint32_t aIndex, const Vector3<T>& aTranslation)
+{
+	myTranslations.Set(aIndex, aTranslation);
+	MarkDirty(aIndex);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::SetRotation(uint32_t aIndex, const Quaternion<T>& aRotation)
+{
+	myRotations.Set(aIndex, Vector4<T>(aRotation.x, aRotation.y, aRotation.z, aRotation.w));
+	MarkDirty(aIndex);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::SetScale(uint32_t aIndex, const Vector3<T>& aScale)
+{
+	myScales.Set(aIndex, aScale);
+	MarkDirty(aIndex);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::SetLocal(uint32_t aIndex, const Vector3<T>& aTranslation, const Quaternion<T>& aRotation, const Vector3<T>& aScale)
+{
+	myTranslations.Set(aIndex, aTranslation);
+	myRotations.Set(aIndex, Vector4<T>(aRotation.x, aRotation.y, aRotation.z, aRotation.w));
+	myScales.Set(aIndex, aScale);
+	MarkDirty(aIndex);
+}
+
+template<class T>
+inline void TransformHierarchy<T>::MarkDirty(uint32_t aIndex)
+{
+	assert(aIndex < myParents.size() && "Index out of bounds!");
+	myLocalDirty[aIndex] = 1;
+	myDirty = true;
+}
+
+template<class T>
+inline void TransformHierarchy<T>::UpdateLocalMatrices(size_t aBegin, size_t aEnd)
+{
+	const T* translationX = myTranslations.X();
+	const T* translationY = myTranslations.Y();
+	const T* translationZ = myTranslations.Z();
+	const T* rotationX = myRotations.X();
+	const T* rotationY = myRotations.Y();
+	const T* rotationZ = myRotations.Z();
+	const T* rotationW = myRotations.W();
+	const T* scaleX = myScales.X();
+	const T* scaleY = myScales.Y();
+	const T* scaleZ = myScales.Z();
+
+	Ohm::Simd::ForEachLane<T>(aEnd - aBegin, [&](auto aLane, size_t aOffset)
+	{
+		using Lane = decltype(aLane);
+		using Pack = typename Lane::Type;
+
+		// A whole pack is rebuilt when any of its nodes changed, the others get the same matrix again.
+		const size_t i = aBegin + aOffset;
+		if (std::find(myLocalDirty.begin() + i, myLocalDirty.begin() + i + Lane::Width, uint8_t(1)) == myLocalDirty.begin() + i + Lane::Width)
+		{
+			return;
+		}
+
+		const Pack x = Lane::Load(rotationX + i);
+		const Pack y = Lane::Load(rotationY + i);
+		const Pack z = Lane::Load(rotationZ + i);
+		const Pack w = Lane::Load(rotationW + i);
+
+		// Quaternion<T>::ToMatrix3x3 with every row scaled by its scale component.
+		const Pack one = Lane::Set(static_cast<T>(1));
+		const Pack two = Lane::Set(static_cast<T>(2));
+		const Pack xx = Lane::Multiply(Lane::Multiply(x, x), two);
+		const Pack yy = Lane::Multiply(Lane::Multiply(y, y), two);
+		const Pack zz = Lane::Multiply(Lane::Multiply(z, z), two);
+		const Pack xy = Lane::Multiply(Lane::Multiply(x, y), two);
+		const Pack xz = Lane::Multiply(Lane::Multiply(x, z), two);
+		const Pack yz = Lane::Multiply(Lane::Multiply(y, z), two);
+		const Pack wx = Lane::Multiply(Lane::Multiply(w, x), two);
+		const Pack wy = Lane::Multiply(Lane::Multiply(w, y), two);
+		const Pack wz = Lane::Multiply(Lane::Multiply(w, z), two);
+
+		const Pack sx = Lane::Load(scaleX + i);
+		const Pack sy = Lane::Load(scaleY + i);
+		const Pack sz = Lane::Load(scaleZ + i);
+		const Pack zero = Lane::Set(static_cast<T>(0));
+
+		// Matrices are 16 consecutive values, so element k of the pack lands 16 values further.
+		T* matrix = &myLocalMatrices[i](1).x;
+		Lane::StoreTransposed4(matrix + 0, Lane::Multiply(Lane::Subtract(Lane::Subtract(one, yy), zz), sx), Lane::Multiply(Lane::Add(xy, wz), sx), Lane::Multiply(Lane::Subtract(xz, wy), sx), zero, 16);
+		Lane::StoreTransposed4(matrix + 4, Lane::Multiply(Lane::Subtract(xy, wz), sy), Lane::Multiply(Lane::Subtract(Lane::Subtract(one, xx), zz), sy), Lane::Multiply(Lane::Add(yz, wx), sy), zero, 16);
+		Lane::StoreTransposed4(matrix + 8, Lane::Multiply(Lane::Add(xz, wy), sz), Lane::Multiply(Lane::Subtract(yz, wx), sz), Lane::Multiply(Lane::Subtract(Lane::Subtract(one, xx), yy), sz), zero, 16);
+		Lane::StoreTransposed4(matrix + 12, Lane::Load(translationX + i), Lane::Load(translationY + i), Lane::Load(translationZ + i), one, 16);
+	});
+}
+
+template<class T>
+inline void TransformHierarchy<T>::UpdateWorldMatrix(uint32_t aIndex)
+{
+	const uint32_t parent = myParents[aIndex];
+	const bool changed = myLocalDirty[aIndex] != 0 || (parent != InvalidIndex && myWorldChanged[parent] != 0);
+	myWorldChanged[aIndex] = changed ? 1 : 0;
+	if (!changed)
+	{
+		return;
+	}
+
+	if (parent == InvalidIndex)
+	{
+		myWorldMatrices[aIndex] = myLocalMatrices[aIndex];
+		return;
+	}
+
+	// Straight into the array, without the temporary of operator*.
+#if defined(OHM_SIMD_SSE2)
+	if constexpr (std::is_same_v<T, float>)
+	{
+		Ohm::Simd::MultiplyMatrix4x4(&myLocalMatrices[aIndex](1).x, &myWorldMatrices[parent](1).x, &myWorldMatrices[aIndex](1).x);
+		return;
+	}
+#endif
+	myWorldMatrices[aIndex] = myLocalMatrices[aIndex] * myWorldMatrices[parent];
+}
+
+template<class T>
+inline void TransformHierarchy<T>::BuildTaskGroups(size_t aGroupCount)
+{
+	// Subtree sizes accumulated at their roots, parents come first so a node's root is already known.
+	std::vector<uint32_t> roots(myParents.size());
+	std::vector<size_t> subtreeSizes(myParents.size(), 0);
+	std::vector<uint32_t> rootOrder;
+	for (uint32_t i = 0; i < myParents.size(); i++)
+	{
+		roots[i] = myParents[i] == InvalidIndex ? i : roots[myParents[i]];
+		subtreeSizes[roots[i]]++;
+		if (roots[i] == i)
+		{
+			rootOrder.push_back(i);
+		}
+	}
+
+	// Largest subtrees first, each to the least loaded group.
+	std::stable_sort(rootOrder.begin(), rootOrder.end(), [&](uint32_t aA, uint32_t aB) { return subtreeSizes[aA] > subtreeSizes[aB]; });
+	std::vector<size_t> rootGroup(myParents.size(), 0);
+	std::vector<size_t> load(aGroupCount, 0);
+	for (const uint32_t root : rootOrder)
+	{
+		const size_t group = static_cast<size_t>(std::min_element(load.begin(), load.end()) - load.begin());
+		rootGroup[root] = group;
+		load[group] += subtreeSizes[root];
+	}
+
+	myTaskGroups.assign(aGroupCount, {});
+	for (size_t group = 0; group < aGroupCount; group++)
+	{
+		myTaskGroups[group].reserve(load[group]);
+	}
+	for (uint32_t i = 0; i < myParents.size(); i++)
+	{
+		myTaskGroups[rootGroup[roots[i]]].push_back(i);
+	}
+}
+
+template<class T>
+inline void TransformHierarchy<T>::Update(ThreadPool* aPool)
+{
+	if (!myDirty)
+	{
+		return;
+	}
+
+	const size_t count = myParents.size();
+
+	if (!aPool || aPool->GetWorkerCount() == 0)
+	{
+		UpdateLocalMatrices(0, count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			UpdateWorldMatrix(i);
+		}
+	}
+	else
+	{
+		// Chunks on cache line boundaries, so threads never share a line of flags and every pack is the same as single threaded.
+		aPool->ParallelFor(count, Ohm::Detail::ParallelGrain(sizeof(T) * 10 + sizeof(Matrix4x4<T>)), [&](size_t aBegin, size_t aEnd)
+		{
+			UpdateLocalMatrices(aBegin, aEnd);
+		});
+
+		// A few groups per thread, so idle threads still find uneven subtrees to steal.
+		const size_t groupCount = aPool->GetThreadCount() * 4;
+		if (myTaskGroups.size() != groupCount)
+		{
+			BuildTaskGroups(groupCount);
+		}
+		aPool->ParallelFor(groupCount, 1, [&](size_t aBegin, size_t aEnd)
+		{
+			for (size_t group = aBegin; group < aEnd; group++)
+			{
+				for (const uint32_t i : myTaskGroups[group])
+				{
+					UpdateWorldMatrix(i);
+				}
+			}
+		});
+	}
+
+	std::fill(myLocalDirty.begin(), myLocalDirty.end(), uint8_t(0));
+	myDirty = false;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Ohm/Matrix/Matrix3x4.hpp"
+#include "Ohm/Quaternion/Quaternion.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+// Rigid transform as a unit dual quaternion: real is the rotation, dual = 0.5 * (translation, 0) * real.
+// Blending dual quaternions keeps rotations rigid, which avoids the volume loss of blended matrices in skinning.
+// Products follow Quaternion<T>, aFirst * aSecond applies aSecond and then aFirst.
+template<typename T>
+class DualQuaternion
+{
+public:
+	constexpr DualQuaternion();
+	constexpr DualQuaternion(const Quaternion<T>& aReal, const Quaternion<T>& aDual);
+	// Rotates, then translates. aRotation is expected to be a unit quaternion.
+	constexpr DualQuaternion(const Quaternion<T>& aRotation, const Vector3<T>& aTranslation);
+
+	// aTransform is expected to be made up of nothing but rotations and translations.
+	static constexpr DualQuaternion<T> FromMatrix(const Matrix3x4<T>& aTransform);
+	constexpr Matrix3x4<T> ToMatrix3x4() const;
+
+	constexpr const Quaternion<T>& GetRotation() const { return real; }
+	constexpr Vector3<T> GetTranslation() const;
+
+	// Expect a normalized dual quaternion.
+	constexpr Vector3<T> TransformPoint(const Vector3<T>& aPoint) const;
+	constexpr Vector3<T> TransformDirection(const Vector3<T>& aDirection) const;
+
+	// Scales both parts so the rotation has unit length.
+	constexpr void Normalize();
+	constexpr DualQuaternion<T> GetNormalized() const;
+
+	constexpr DualQuaternion<T> operator*(const DualQuaternion<T>& rhs) const;
+	constexpr void operator*=(const DualQuaternion<T>& rhs);
+
+	Quaternion<T> real;
+	Quaternion<T> dual;
+};
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion()
+	: real(), dual(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0))
+{
+}
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion(const Quaternion<T>& aReal, const Quaternion<T>& aDual)
+	: real(aReal), dual(aDual)
+{
+}
+
+template<typename T>
+constexpr DualQuaternion<T>::DualQuaternion(const Quaternion<T>& aRotation, const Vector3<T>& aTranslation)
+	: real(aRotation), dual(Quaternion<T>(aTranslation.x, aTranslation.y, aTranslation.z, static_cast<T>(0)) * aRotation * static_cast<T>(0.5))
+{
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::FromMatrix(const Matrix3x4<T>& aTransform)
+{
+	return DualQuaternion<T>(Quaternion<T>::FromMatrix(aTransform.ToMatrix3x3()), aTransform.GetTranslation());
+}
+
+template<typename T>
+constexpr Matrix3x4<T> DualQuaternion<T>::ToMatrix3x4() const
+{
+	return Matrix3x4<T>::CreateTransform(GetTranslation(), real);
+}
+
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::GetTranslation() const
+{
+	// Vector part of 2 * dual * conjugate(real).
+	const Vector3<T> realVector{ real.x, real.y, real.z };
+	const Vector3<T> dualVector{ dual.x, dual.y, dual.z };
+
+	return (dualVector * real.w - realVector * dual.w + realVector.Cross(dualVector)) * static_cast<T>(2);
+}
+
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::TransformPoint(const Vector3<T>& aPoint) const
+{
+	return real.Rotate(aPoint) + GetTranslation();
+}
+
+template<typename T>
+constexpr Vector3<T> DualQuaternion<T>::TransformDirection(const Vector3<T>& aDirection) const
+{
+	return real.Rotate(aDirection);
+}
+
+template<typename T>
+constexpr void DualQuaternion<T>::Normalize()
+{
+	const T norm = real.Norm();
+	if (norm != 0)
+	{
+		const T normValue = static_cast<T>(1) / norm;
+		real *= normValue;
+		dual *= normValue;
+	}
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::GetNormalized() const
+{
+	DualQuaternion<T> result(*this);
+	result.Normalize();
+
+	return result;
+}
+
+template<typename T>
+constexpr DualQuaternion<T> DualQuaternion<T>::operator*(const DualQuaternion<T>& rhs) const
+{
+	return DualQuaternion<T>(real * rhs.real, real * rhs.dual + dual * rhs.real);
+}
+
+template<typename T>
+constexpr void DualQuaternion<T>::operator*=(const DualQuaternion<T>& rhs)
+{
+	*this = *this * rhs;
+}
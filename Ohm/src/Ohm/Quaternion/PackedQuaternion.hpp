@@ -0,0 +1,258 @@
+#pragma once
+
+#include "Ohm/Quaternion/Quaternion.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Unit quaternion in 48 bits with the smallest three encoding: the index of the largest component (2 bits) and the
+// other three components (15 bits each). Since the largest component is at least 1/2, the others lie in
+// [-1/sqrt(2), 1/sqrt(2)] and the largest is rebuilt from the unit length constraint.
+// The stored components are within 2.2e-5 of the input, the rebuilt one within 6.5e-5, and the decoded rotation
+// is within 1.5e-4 radians (0.009 degrees) of the input rotation.
+// The quaternion is negated if needed so the largest component is positive, which is the same rotation.
+class PackedQuaternion
+{
+public:
+	PackedQuaternion() = default;
+	explicit PackedQuaternion(const Quaternion<float>& aRotation);
+
+	static PackedQuaternion FromBits(uint64_t aBits);
+	uint64_t GetBits() const;
+
+	Quaternion<float> ToQuaternion() const;
+
+private:
+	uint16_t myBits[3];
+};
+
+namespace Ohm::Detail
+{
+	// Maps [-1/sqrt(2), 1/sqrt(2)] onto [0, 32767] and back.
+	constexpr float SmallestThreeRange = 0.70710678118654752f;
+	constexpr float SmallestThreeEncodeScale = 32767.f / (2.f * SmallestThreeRange);
+	constexpr float SmallestThreeEncodeOffset = 32767.f / 2.f;
+	constexpr float SmallestThreeDecodeScale = (2.f * SmallestThreeRange) / 32767.f;
+
+	inline uint64_t QuantizeSmallestThree(float aValue)
+	{
+		const long quantized = std::lrint(aValue * SmallestThreeEncodeScale + SmallestThreeEncodeOffset);
+		return static_cast<uint64_t>(quantized < 0 ? 0 : (quantized > 32767 ? 32767 : quantized));
+	}
+
+	inline float DequantizeSmallestThree(uint64_t aValue)
+	{
+		return static_cast<float>(aValue) * SmallestThreeDecodeScale - SmallestThreeRange;
+	}
+
+	inline uint64_t PackSmallestThree(uint64_t aLargest, uint64_t aA, uint64_t aB, uint64_t aC)
+	{
+		return (aLargest << 45) | (aA << 30) | (aB << 15) | aC;
+	}
+}
+
+inline PackedQuaternion::PackedQuaternion(const Quaternion<float>& aRotation)
+{
+	const float components[4] = { aRotation.x, aRotation.y, aRotation.z, aRotation.w };
+
+	int largest = 0;
+	for (int i = 1; i < 4; i++)
+	{
+		if (std::abs(components[i]) > std::abs(components[largest]))
+		{
+			largest = i;
+		}
+	}
+
+	const float sign = std::signbit(components[largest]) ? -1.f : 1.f;
+	uint64_t quantized[3];
+	for (int i = 0, j = 0; i < 4; i++)
+	{
+		if (i != largest)
+		{
+			quantized[j++] = Ohm::Detail::QuantizeSmallestThree(components[i] * sign);
+		}
+	}
+
+	*this = FromBits(Ohm::Detail::PackSmallestThree(static_cast<uint64_t>(largest), quantized[0], quantized[1], quantized[2]));
+}
+
+inline PackedQuaternion PackedQuaternion::FromBits(uint64_t aBits)
+{
+	PackedQuaternion packed;
+	packed.myBits[0] = static_cast<uint16_t>(aBits);
+	packed.myBits[1] = static_cast<uint16_t>(aBits >> 16);
+	packed.myBits[2] = static_cast<uint16_t>(aBits >> 32);
+	return packed;
+}
+
+inline uint64_t PackedQuaternion::GetBits() const
+{
+	return static_cast<uint64_t>(myBits[0]) | (static_cast<uint64_t>(myBits[1]) << 16) | (static_cast<uint64_t>(myBits[2]) << 32);
+}
+
+inline Quaternion<float> PackedQuaternion::ToQuaternion() const
+{
+	const uint64_t bits = GetBits();
+	const int largest = static_cast<int>((bits >> 45) & 3u);
+	const float a = Ohm::Detail::DequantizeSmallestThree((bits >> 30) & 0x7FFFu);
+	const float b = Ohm::Detail::DequantizeSmallestThree((bits >> 15) & 0x7FFFu);
+	const float c = Ohm::Detail::DequantizeSmallestThree(bits & 0x7FFFu);
+	const float rebuilt = std::sqrt(std::fmax(0.f, 1.f - a * a - b * b - c * c));
+
+	switch (largest)
+	{
+		case 0: return Quaternion<float>(rebuilt, a, b, c);
+		case 1: return Quaternion<float>(a, rebuilt, b, c);
+		case 2: return Quaternion<float>(a, b, rebuilt, c);
+		default: return Quaternion<float>(a, b, c, rebuilt);
+	}
+}
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	// Four quaternions at a time, transposed to one register per component.
+	inline size_t PackQuaternionsSSE(const Quaternion<float>* aRotations, PackedQuaternion* aOut, size_t aCount)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		const __m128 encodeScale = _mm_set1_ps(Ohm::Detail::SmallestThreeEncodeScale);
+		const __m128 encodeOffset = _mm_set1_ps(Ohm::Detail::SmallestThreeEncodeOffset);
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(&aRotations[i + 0].x);
+			__m128 y = _mm_loadu_ps(&aRotations[i + 1].x);
+			__m128 z = _mm_loadu_ps(&aRotations[i + 2].x);
+			__m128 w = _mm_loadu_ps(&aRotations[i + 3].x);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			// Strictly greater, so ties keep the first component like the scalar path.
+			__m128 largestMagnitude = _mm_andnot_ps(signMask, x);
+			__m128i largest = _mm_setzero_si128();
+			const __m128 components[3] = { y, z, w };
+			for (int component = 0; component < 3; component++)
+			{
+				const __m128 magnitude = _mm_andnot_ps(signMask, components[component]);
+				const __m128i greater = _mm_castps_si128(_mm_cmpgt_ps(magnitude, largestMagnitude));
+				largest = _mm_or_si128(_mm_and_si128(greater, _mm_set1_epi32(component + 1)), _mm_andnot_si128(greater, largest));
+				largestMagnitude = _mm_max_ps(largestMagnitude, magnitude);
+			}
+
+			const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128()));
+			const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+			const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+			const __m128 atMost1 = _mm_or_ps(is0, is1);
+			const __m128 atMost2 = _mm_or_ps(atMost1, is2);
+
+			// The three components that are kept, in order, and the sign of the dropped one.
+			const __m128 a = _mm_or_ps(_mm_and_ps(is0, y), _mm_andnot_ps(is0, x));
+			const __m128 b = _mm_or_ps(_mm_and_ps(atMost1, z), _mm_andnot_ps(atMost1, y));
+			const __m128 c = _mm_or_ps(_mm_and_ps(atMost2, w), _mm_andnot_ps(atMost2, z));
+			const __m128 dropped = _mm_or_ps(_mm_and_ps(is0, x), _mm_or_ps(_mm_and_ps(is1, y), _mm_or_ps(_mm_and_ps(is2, z), _mm_andnot_ps(atMost2, w))));
+			const __m128 sign = _mm_and_ps(dropped, signMask);
+
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 maximum = _mm_set1_ps(32767.f);
+			const __m128i quantizedA = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_xor_ps(a, sign), encodeScale), encodeOffset), zero), maximum));
+			const __m128i quantizedB = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_xor_ps(b, sign), encodeScale), encodeOffset), zero), maximum));
+			const __m128i quantizedC = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(_mm_xor_ps(c, sign), encodeScale), encodeOffset), zero), maximum));
+
+			// The low and high 32 bits of every element's 48 bit pattern, see PackSmallestThree.
+			const __m128i lowWords = _mm_or_si128(_mm_or_si128(quantizedC, _mm_slli_epi32(quantizedB, 15)), _mm_slli_epi32(quantizedA, 30));
+			const __m128i highWords = _mm_or_si128(_mm_srli_epi32(quantizedA, 2), _mm_slli_epi32(largest, 13));
+
+			alignas(16) uint64_t bits[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(bits + 0), _mm_unpacklo_epi32(lowWords, highWords));
+			_mm_store_si128(reinterpret_cast<__m128i*>(bits + 2), _mm_unpackhi_epi32(lowWords, highWords));
+			for (int lane = 0; lane < 4; lane++)
+			{
+				aOut[i + lane] = PackedQuaternion::FromBits(bits[lane]);
+			}
+		}
+		return i;
+	}
+
+	inline size_t UnpackQuaternionsSSE(const PackedQuaternion* aPacked, Quaternion<float>* aOut, size_t aCount)
+	{
+		const __m128 decodeScale = _mm_set1_ps(Ohm::Detail::SmallestThreeDecodeScale);
+		const __m128 range = _mm_set1_ps(Ohm::Detail::SmallestThreeRange);
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			const uint64_t bits0 = aPacked[i + 0].GetBits();
+			const uint64_t bits1 = aPacked[i + 1].GetBits();
+			const uint64_t bits2 = aPacked[i + 2].GetBits();
+			const uint64_t bits3 = aPacked[i + 3].GetBits();
+
+			// Two elements per 64 bit half, then the fields are shifted and masked for all four at once.
+			const __m128i low = _mm_set_epi64x(static_cast<int64_t>(bits1), static_cast<int64_t>(bits0));
+			const __m128i high = _mm_set_epi64x(static_cast<int64_t>(bits3), static_cast<int64_t>(bits2));
+			const __m128i fieldMask = _mm_set1_epi32(0x7FFF);
+
+			// Low 32 bits of every element: c, b and the start of a. High 16 bits: the rest of a and the index.
+			const __m128i lowWords = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(low), _mm_castsi128_ps(high), _MM_SHUFFLE(2, 0, 2, 0)));
+			const __m128i highWords = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(low), _mm_castsi128_ps(high), _MM_SHUFFLE(3, 1, 3, 1)));
+
+			const __m128i quantizedC = _mm_and_si128(lowWords, fieldMask);
+			const __m128i quantizedB = _mm_and_si128(_mm_srli_epi32(lowWords, 15), fieldMask);
+			const __m128i quantizedA = _mm_and_si128(_mm_or_si128(_mm_srli_epi32(lowWords, 30), _mm_slli_epi32(highWords, 2)), fieldMask);
+			const __m128i largest = _mm_and_si128(_mm_srli_epi32(highWords, 13), _mm_set1_epi32(3));
+
+			const __m128 a = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantizedA), decodeScale), range);
+			const __m128 b = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantizedB), decodeScale), range);
+			const __m128 c = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantizedC), decodeScale), range);
+
+			__m128 rebuilt = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(a, a)), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+			rebuilt = _mm_sqrt_ps(_mm_max_ps(rebuilt, _mm_setzero_ps()));
+
+			const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_setzero_si128()));
+			const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(1)));
+			const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(2)));
+			const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(largest, _mm_set1_epi32(3)));
+			const __m128 atMost1 = _mm_or_ps(is0, is1);
+
+			// Inverse of the selection in PackQuaternionsSSE.
+			__m128 x = _mm_or_ps(_mm_and_ps(is0, rebuilt), _mm_andnot_ps(is0, a));
+			__m128 y = _mm_or_ps(_mm_and_ps(is0, a), _mm_or_ps(_mm_and_ps(is1, rebuilt), _mm_andnot_ps(atMost1, b)));
+			__m128 z = _mm_or_ps(_mm_and_ps(atMost1, b), _mm_or_ps(_mm_and_ps(is2, rebuilt), _mm_and_ps(is3, c)));
+			__m128 w = _mm_or_ps(_mm_and_ps(is3, rebuilt), _mm_andnot_ps(is3, c));
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			_mm_storeu_ps(&aOut[i + 0].x, x);
+			_mm_storeu_ps(&aOut[i + 1].x, y);
+			_mm_storeu_ps(&aOut[i + 2].x, z);
+			_mm_storeu_ps(&aOut[i + 3].x, w);
+		}
+		return i;
+	}
+}
+#endif
+
+inline void PackQuaternions(const Quaternion<float>* aRotations, PackedQuaternion* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_SSE2)
+	i = Ohm::Simd::PackQuaternionsSSE(aRotations, aOut, aCount);
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = PackedQuaternion(aRotations[i]);
+	}
+}
+
+inline void UnpackQuaternions(const PackedQuaternion* aPacked, Quaternion<float>* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_SSE2)
+	i = Ohm::Simd::UnpackQuaternionsSSE(aPacked, aOut, aCount);
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = aPacked[i].ToQuaternion();
+	}
+}
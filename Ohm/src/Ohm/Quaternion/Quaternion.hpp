@@ -2,44 +2,81 @@
 
 #include "Ohm/Vector/Vector4.hpp"
 #include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Matrix/Matrix3x3.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Utility/FastMath.hpp"
+#include "Ohm/Utility/Math.hpp"
+
+#include <cmath>
 
 template<typename T>
 class Quaternion
 {
 public:
-	Quaternion();
-	Quaternion(const T& x, const T& y, const T& z, const T& w);
-	Quaternion(const Vector4<T>& vector);
-	Quaternion(const Quaternion<T>& quaternion);
-	~Quaternion();
-
-	Quaternion<T> Multiply(const Quaternion<T>& rhs);
-	T Norm();
-
-	void Normalize();
-	Quaternion<T> GetNormalized();
-
-	Quaternion<T> Conjugate();
-	Quaternion<T> Inverse();
-
-	void ToUnitNorm();
-
-	const bool operator==(const Quaternion<T>& rhs);
-	const bool operator!=(const Quaternion<T>& rhs);
-
-	Quaternion<T>& operator=(const Quaternion<T>& rhs);
+	constexpr Quaternion();
+	constexpr Quaternion(const T& x, const T& y, const T& z, const T& w);
+	constexpr Quaternion(const Vector4<T>& vector);
+	Quaternion(const Quaternion<T>& quaternion) = default;
+	~Quaternion() = default;
+
+	constexpr Quaternion<T> Multiply(const Quaternion<T>& rhs) const;
+	constexpr T Norm() const;
+	template<MathAccuracy Accuracy>
+	constexpr T NormWith() const;
+	constexpr T Dot(const Quaternion<T>& rhs) const;
+
+	// The With versions here and of the interpolations take the tier of the square root and trigonometry (see MathAccuracy),
+	// the plain ones use Ohm::Math::DefaultAccuracy.
+	constexpr void Normalize();
+	template<MathAccuracy Accuracy>
+	constexpr void NormalizeWith();
+	constexpr Quaternion<T> GetNormalized() const;
+	template<MathAccuracy Accuracy>
+	constexpr Quaternion<T> GetNormalizedWith() const;
+
+	constexpr Quaternion<T> Conjugate() const;
+	constexpr Quaternion<T> Inverse() const;
+
+	constexpr void ToUnitNorm();
+	template<MathAccuracy Accuracy>
+	constexpr void ToUnitNormWith();
+
+	// Rotation matrices in the row-vector convention of Matrix3x3/Matrix4x4, aVector * ToMatrix3x3() == Rotate(aVector).
+	// Expects a unit quaternion.
+	constexpr Matrix3x3<T> ToMatrix3x3() const;
+	constexpr Matrix4x4<T> ToMatrix4x4() const;
+
+	// Shepperd's method, aMatrix is expected to be a pure rotation.
+	static constexpr Quaternion<T> FromMatrix(const Matrix3x3<T>& aMatrix);
+	static constexpr Quaternion<T> FromMatrix(const Matrix4x4<T>& aMatrix);
+
+	// Rotates aVector by this unit quaternion, v + w * t + q x t with t = 2 * (q x v).
+	constexpr Vector3<T> Rotate(const Vector3<T>& aVector) const;
+
+	// Interpolates along the shortest arc, aFrom and aTo are expected to be unit quaternions.
+	static Quaternion<T> Slerp(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT);
+	template<MathAccuracy Accuracy>
+	static Quaternion<T> SlerpWith(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT);
+	static constexpr Quaternion<T> Nlerp(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT);
+	template<MathAccuracy Accuracy>
+	static constexpr Quaternion<T> NlerpWith(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT);
+
+	constexpr const bool operator==(const Quaternion<T>& rhs);
+	constexpr const bool operator!=(const Quaternion<T>& rhs);
+
+	Quaternion<T>& operator=(const Quaternion<T>& rhs) = default;
 	
-	void operator+=(const Quaternion<T>& rhs);
-	Quaternion<T> operator+(const Quaternion<T>& rhs) const;
+	constexpr void operator+=(const Quaternion<T>& rhs);
+	constexpr Quaternion<T> operator+(const Quaternion<T>& rhs) const;
 
-	void operator-=(const Quaternion<T>& rhs);
-	Quaternion<T> operator-(const Quaternion<T>& rhs) const;
+	constexpr void operator-=(const Quaternion<T>& rhs);
+	constexpr Quaternion<T> operator-(const Quaternion<T>& rhs) const;
 
-	void operator*=(const Quaternion<T>& rhs);
-	Quaternion<T> operator*(const Quaternion<T>& rhs) const;
+	constexpr void operator*=(const Quaternion<T>& rhs);
+	constexpr Quaternion<T> operator*(const Quaternion<T>& rhs) const;
 
-	void operator*=(const T& rhs);
-	Quaternion<T> operator*(const T& rhs) const;
+	constexpr void operator*=(const T& rhs);
+	constexpr Quaternion<T> operator*(const T& rhs) const;
 
 	T x;
 	T y;
@@ -48,55 +85,80 @@ public:
 };
 
 template<typename T>
-inline Quaternion<T>::Quaternion()
+constexpr Quaternion<T>::Quaternion()
+	: x(0), y(0), z(0), w(1)
 {
 }
 
 template<typename T>
-inline Quaternion<T>::Quaternion(const T& x, const T& y, const T& z, const T& w)
+constexpr Quaternion<T>::Quaternion(const T& x, const T& y, const T& z, const T& w)
 	: x(x), y(y), z(z), w(w)
 {
 }
 
 template<typename T>
-inline Quaternion<T>::Quaternion(const Vector4<T>& vector)
+constexpr Quaternion<T>::Quaternion(const Vector4<T>& vector)
 	: x(vector.x), y(vector.y), z(vector.z), w(vector.w)
 {
 }
 
 template<typename T>
-inline Quaternion<T>::Quaternion(const Quaternion<T>& quaternion)
-	: x(quaternion.x), y(quaternion.y), z(quaternion.z), w(quaternion.w)
+constexpr Quaternion<T> Quaternion<T>::Multiply(const Quaternion<T>& rhs) const
 {
+	Vector3<T> vector{ x, y, z };
+	const Vector3<T> rhsVector{ rhs.x, rhs.y, rhs.z };
+	const T scalar = w * rhs.w - vector.Dot(rhsVector);
+	
+	vector = rhsVector * w + vector * rhs.w + vector.Cross(rhsVector);
+
+	return Quaternion<T>(vector.x, vector.y, vector.z, scalar);
 }
 
 template<typename T>
-inline Quaternion<T>::~Quaternion()
+constexpr T Quaternion<T>::Norm() const
 {
+	return NormWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::Multiply(const Quaternion<T>& rhs)
+template<MathAccuracy Accuracy>
+constexpr T Quaternion<T>::NormWith() const
 {
-	Vector3<T> vector{ x, y, z };
-	const Vector3<T> rhsVector{ rhs.x, rhs.y, rhs.z };
-	const T scalar = w * rhs.w - vector.Dot(rhsVector);
-	
-	vector = rhsVector * w + w * rhs.w + vector.Cross(rhsVector);
+	return Ohm::Math::Sqrt<Accuracy>(x * x + y * y + z * z + w * w);
+}
 
-	return Quaternion<T>(vector.x, vector.y, vector.z, scalar);
+template<typename T>
+constexpr T Quaternion<T>::Dot(const Quaternion<T>& rhs) const
+{
+	return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w;
 }
 
 template<typename T>
-inline T Quaternion<T>::Norm()
+constexpr void Quaternion<T>::Normalize()
 {
-	return sqrt(x * x + y * y + z * z + w * w);
+	NormalizeWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<typename T>
-inline void Quaternion<T>::Normalize()
+template<MathAccuracy Accuracy>
+constexpr void Quaternion<T>::NormalizeWith()
 {
-	const T norm = Norm();
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		const T normSqr = Dot(*this);
+		if (normSqr != 0)
+		{
+			const T normValue = Ohm::Math::InvSqrt<Accuracy>(normSqr);
+
+			x *= normValue;
+			y *= normValue;
+			z *= normValue;
+			w *= normValue;
+		}
+		return;
+	}
+
+	const T norm = NormWith<Accuracy>();
 	if (norm != 0)
 	{
 		T normValue = static_cast<T>(1) / norm;
@@ -109,22 +171,29 @@ inline void Quaternion<T>::Normalize()
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::GetNormalized()
+constexpr Quaternion<T> Quaternion<T>::GetNormalized() const
+{
+	return GetNormalizedWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr Quaternion<T> Quaternion<T>::GetNormalizedWith() const
 {
 	Quaternion<T> result(*this);
-	result.Normalize();
+	result.template NormalizeWith<Accuracy>();
 
 	return result;
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::Conjugate()
+constexpr Quaternion<T> Quaternion<T>::Conjugate() const
 {
 	return Quaternion<T>(-x, -y, -z, w);
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::Inverse()
+constexpr Quaternion<T> Quaternion<T>::Inverse() const
 {
 	T absolute = Norm();
 	absolute *= absolute;
@@ -134,15 +203,26 @@ inline Quaternion<T> Quaternion<T>::Inverse()
 }
 
 template<typename T>
-inline void Quaternion<T>::ToUnitNorm()
+constexpr void Quaternion<T>::ToUnitNorm()
+{
+	ToUnitNormWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+constexpr void Quaternion<T>::ToUnitNormWith()
 {
 	T angle = w;
 	
 	Vector3<T> vector(x, y, z);
-	vector.Normalize();
+	vector.template NormalizeWith<Accuracy>();
 	
-	w = static_cast<T>(std::cos(angle * static_cast<T>(0.5)));
-	vector = vector * static_cast<T>(std::sin(angle * static_cast<T>(0.5)));
+	T sin = static_cast<T>(0);
+	T cos = static_cast<T>(0);
+	Ohm::Math::SinCos<Accuracy>(angle * static_cast<T>(0.5), sin, cos);
+
+	w = cos;
+	vector = vector * sin;
 
 	x = vector.x;
 	y = vector.y;
@@ -150,30 +230,166 @@ inline void Quaternion<T>::ToUnitNorm()
 }
 
 template<typename T>
-inline const bool Quaternion<T>::operator==(const Quaternion<T>& rhs)
+constexpr Matrix3x3<T> Quaternion<T>::ToMatrix3x3() const
 {
-	return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+	const T two = static_cast<T>(2);
+	const T one = static_cast<T>(1);
+
+	const T xx = x * x * two;
+	const T yy = y * y * two;
+	const T zz = z * z * two;
+	const T xy = x * y * two;
+	const T xz = x * z * two;
+	const T yz = y * z * two;
+	const T wx = w * x * two;
+	const T wy = w * y * two;
+	const T wz = w * z * two;
+
+	return Matrix3x3<T>
+	{
+		Vector3<T>{ one - yy - zz, xy + wz, xz - wy },
+		Vector3<T>{ xy - wz, one - xx - zz, yz + wx },
+		Vector3<T>{ xz + wy, yz - wx, one - xx - yy }
+	};
 }
 
 template<typename T>
-inline const bool Quaternion<T>::operator!=(const Quaternion<T>& rhs)
+constexpr Matrix4x4<T> Quaternion<T>::ToMatrix4x4() const
 {
-	return !(*this == rhs);
+	const Matrix3x3<T> rotation = ToMatrix3x3();
+
+	return Matrix4x4<T>
+	{
+		Vector4<T>{ rotation(1), static_cast<T>(0) },
+		Vector4<T>{ rotation(2), static_cast<T>(0) },
+		Vector4<T>{ rotation(3), static_cast<T>(0) },
+		Vector4<T>{ static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1) }
+	};
+}
+
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::FromMatrix(const Matrix3x3<T>& aMatrix)
+{
+	const T m11 = aMatrix(1, 1);
+	const T m22 = aMatrix(2, 2);
+	const T m33 = aMatrix(3, 3);
+	const T trace = m11 + m22 + m33;
+
+	const T one = static_cast<T>(1);
+	const T quarter = static_cast<T>(0.25);
+
+	// Solve for the largest component first so the division below stays well conditioned.
+	if (trace >= m11 && trace >= m22 && trace >= m33)
+	{
+		const T s = static_cast<T>(Ohm::Math::Sqrt(trace + one)) * static_cast<T>(2);
+		return Quaternion<T>((aMatrix(2, 3) - aMatrix(3, 2)) / s, (aMatrix(3, 1) - aMatrix(1, 3)) / s, (aMatrix(1, 2) - aMatrix(2, 1)) / s, s * quarter);
+	}
+
+	if (m11 >= m22 && m11 >= m33)
+	{
+		const T s = static_cast<T>(Ohm::Math::Sqrt(one + m11 - m22 - m33)) * static_cast<T>(2);
+		return Quaternion<T>(s * quarter, (aMatrix(1, 2) + aMatrix(2, 1)) / s, (aMatrix(3, 1) + aMatrix(1, 3)) / s, (aMatrix(2, 3) - aMatrix(3, 2)) / s);
+	}
+
+	if (m22 >= m33)
+	{
+		const T s = static_cast<T>(Ohm::Math::Sqrt(one + m22 - m11 - m33)) * static_cast<T>(2);
+		return Quaternion<T>((aMatrix(1, 2) + aMatrix(2, 1)) / s, s * quarter, (aMatrix(2, 3) + aMatrix(3, 2)) / s, (aMatrix(3, 1) - aMatrix(1, 3)) / s);
+	}
+
+	const T s = static_cast<T>(Ohm::Math::Sqrt(one + m33 - m11 - m22)) * static_cast<T>(2);
+	return Quaternion<T>((aMatrix(3, 1) + aMatrix(1, 3)) / s, (aMatrix(2, 3) + aMatrix(3, 2)) / s, s * quarter, (aMatrix(1, 2) - aMatrix(2, 1)) / s);
+}
+
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::FromMatrix(const Matrix4x4<T>& aMatrix)
+{
+	return FromMatrix(Matrix3x3<T>(aMatrix));
+}
+
+template<typename T>
+constexpr Vector3<T> Quaternion<T>::Rotate(const Vector3<T>& aVector) const
+{
+	const Vector3<T> axis{ x, y, z };
+	const Vector3<T> t = axis.Cross(aVector) * static_cast<T>(2);
+
+	return aVector + t * w + axis.Cross(t);
+}
+
+template<typename T>
+inline Quaternion<T> Quaternion<T>::Slerp(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT)
+{
+	return SlerpWith<Ohm::Math::DefaultAccuracy>(aFrom, aTo, aT);
+}
+
+template<typename T>
+template<MathAccuracy Accuracy>
+inline Quaternion<T> Quaternion<T>::SlerpWith(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT)
+{
+	T cosAngle = aFrom.Dot(aTo);
+	const T sign = cosAngle < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+	cosAngle *= sign;
+
+	// Nearly parallel, sin(angle) gets too small to divide by.
+	if (cosAngle > static_cast<T>(0.9995))
+	{
+		return NlerpWith<Accuracy>(aFrom, aTo, aT);
+	}
+
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		// One SinCos, sin((1 - t) * angle) = sin(angle) * cos(t * angle) - cos(angle) * sin(t * angle).
+		T sin = static_cast<T>(0);
+		T cos = static_cast<T>(0);
+		Ohm::Math::SinCos<Accuracy>(aT * Ohm::Math::Acos<Accuracy>(cosAngle), sin, cos);
+
+		const T scaledSin = sin * Ohm::Math::InvSqrt<Accuracy>(static_cast<T>(1) - cosAngle * cosAngle);
+		const T fromWeight = cos - cosAngle * scaledSin;
+		const T toWeight = scaledSin * sign;
+
+		return aFrom * fromWeight + aTo * toWeight;
+	}
+
+	const T angle = static_cast<T>(std::acos(cosAngle));
+	const T invSinAngle = static_cast<T>(1) / static_cast<T>(std::sin(angle));
+	const T fromWeight = static_cast<T>(std::sin((static_cast<T>(1) - aT) * angle)) * invSinAngle;
+	const T toWeight = static_cast<T>(std::sin(aT * angle)) * invSinAngle * sign;
+
+	return aFrom * fromWeight + aTo * toWeight;
+}
+
+template<typename T>
+constexpr Quaternion<T> Quaternion<T>::Nlerp(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT)
+{
+	return NlerpWith<Ohm::Math::DefaultAccuracy>(aFrom, aTo, aT);
 }
 
 template<typename T>
-inline Quaternion<T>& Quaternion<T>::operator=(const Quaternion<T>& rhs)
+template<MathAccuracy Accuracy>
+constexpr Quaternion<T> Quaternion<T>::NlerpWith(const Quaternion<T>& aFrom, const Quaternion<T>& aTo, T aT)
 {
-	x = rhs.x;
-	y = rhs.y;
-	z = rhs.z;
-	w = rhs.w;
+	const T toWeight = aFrom.Dot(aTo) < static_cast<T>(0) ? -aT : aT;
 
-	return *this;
+	Quaternion<T> result = aFrom * (static_cast<T>(1) - aT) + aTo * toWeight;
+	result.template NormalizeWith<Accuracy>();
+
+	return result;
+}
+
+template<typename T>
+constexpr const bool Quaternion<T>::operator==(const Quaternion<T>& rhs)
+{
+	return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+}
+
+template<typename T>
+constexpr const bool Quaternion<T>::operator!=(const Quaternion<T>& rhs)
+{
+	return !(*this == rhs);
 }
 
 template<typename T>
-inline void Quaternion<T>::operator+=(const Quaternion<T>& rhs)
+constexpr void Quaternion<T>::operator+=(const Quaternion<T>& rhs)
 {
 	x += rhs.x;
 	y += rhs.y;
@@ -182,13 +398,13 @@ inline void Quaternion<T>::operator+=(const Quaternion<T>& rhs)
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::operator+(const Quaternion<T>& rhs) const
+constexpr Quaternion<T> Quaternion<T>::operator+(const Quaternion<T>& rhs) const
 {
 	return Quaternion<T>(x + rhs.x, y + rhs.y, z + rhs.z, w + rhs.w);
 }
 
 template<typename T>
-inline void Quaternion<T>::operator-=(const Quaternion<T>& rhs)
+constexpr void Quaternion<T>::operator-=(const Quaternion<T>& rhs)
 {
 	x -= rhs.x;
 	y -= rhs.y;
@@ -197,25 +413,25 @@ inline void Quaternion<T>::operator-=(const Quaternion<T>& rhs)
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::operator-(const Quaternion<T>& rhs) const
+constexpr Quaternion<T> Quaternion<T>::operator-(const Quaternion<T>& rhs) const
 {
 	return Quaternion<T>(x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w);
 }
 
 template<typename T>
-inline void Quaternion<T>::operator*=(const Quaternion<T>& rhs)
+constexpr void Quaternion<T>::operator*=(const Quaternion<T>& rhs)
 {
 	(*this) = Multiply(rhs);
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& rhs) const
+constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& rhs) const
 {
 	return Multiply(rhs);
 }
 
 template<typename T>
-inline void Quaternion<T>::operator*=(const T& rhs)
+constexpr void Quaternion<T>::operator*=(const T& rhs)
 {
 	x *= rhs;
 	y *= rhs;
@@ -224,7 +440,7 @@ inline void Quaternion<T>::operator*=(const T& rhs)
 }
 
 template<typename T>
-inline Quaternion<T> Quaternion<T>::operator*(const T& rhs) const
+constexpr Quaternion<T> Quaternion<T>::operator*(const T& rhs) const
 {
 	return Quaternion<T>(x * rhs, y * rhs, z * rhs, w * rhs);
 }
@@ -0,0 +1,288 @@
+#pragma once
+
+#include "Ohm/Quaternion/Quaternion.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <cstddef>
+#include <limits>
+
+// Array kernels over contiguous Quaternion<T> data, e.g. a full skeleton pose.
+// For float, elements are transposed to x/y/z/w registers four (SSE) or eight (AVX) at a time.
+// aOut may be the same array as an input.
+
+enum class QuaternionInterpolation
+{
+	// Per element Quaternion<T>::Slerp.
+	Exact,
+	// Nlerp with a corrected blend factor, runs fully in SIMD.
+	// For unit inputs the interpolated arc is within 4e-4 radians of the exact slerp (8e-4 radians of rotation angle).
+	Approximate
+};
+
+namespace Ohm::Simd
+{
+	// Scales (aX, aY, aZ, aW) to unit length. A zero quaternion stays zero.
+	template<typename Lane, typename V, typename T>
+	inline void NormalizeQuaternion(V& aX, V& aY, V& aZ, V& aW)
+	{
+		V normSqr = Lane::Multiply(aX, aX);
+		normSqr = Lane::MultiplyAdd(aY, aY, normSqr);
+		normSqr = Lane::MultiplyAdd(aZ, aZ, normSqr);
+		normSqr = Lane::MultiplyAdd(aW, aW, normSqr);
+
+		const V norm = Lane::Max(Lane::Sqrt(normSqr), Lane::Set(std::numeric_limits<T>::min()));
+		const V invNorm = Lane::Divide(Lane::Set(static_cast<T>(1)), norm);
+
+		aX = Lane::Multiply(aX, invNorm);
+		aY = Lane::Multiply(aY, invNorm);
+		aZ = Lane::Multiply(aZ, invNorm);
+		aW = Lane::Multiply(aW, invNorm);
+	}
+
+	// Blends (x0, y0, z0, w0) towards (x1, y1, z1, w1) by aT along the shortest arc and normalizes, aDot is their dot product.
+	template<typename Lane, typename V, typename T>
+	inline void BlendQuaternion(V aX0, V aY0, V aZ0, V aW0, V aX1, V aY1, V aZ1, V aW1, V aDot, V aT, V& aX, V& aY, V& aZ, V& aW)
+	{
+		const V fromWeight = Lane::Subtract(Lane::Set(static_cast<T>(1)), aT);
+		const V toWeight = Lane::FlipSign(aT, aDot);
+
+		aX = Lane::MultiplyAdd(aX1, toWeight, Lane::Multiply(aX0, fromWeight));
+		aY = Lane::MultiplyAdd(aY1, toWeight, Lane::Multiply(aY0, fromWeight));
+		aZ = Lane::MultiplyAdd(aZ1, toWeight, Lane::Multiply(aZ0, fromWeight));
+		aW = Lane::MultiplyAdd(aW1, toWeight, Lane::Multiply(aW0, fromWeight));
+		NormalizeQuaternion<Lane, V, T>(aX, aY, aZ, aW);
+	}
+
+	// Shortest arc normalized lerp. aCorrected applies the slerp approximation to the blend factor.
+	template<typename T>
+	inline void NlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, T aT, Quaternion<T>* aOut, size_t aCount, bool aCorrected)
+	{
+		// Constant parts of t' = t + t(t - 0.5)(t - 1) * (A(d)(t - 0.5)^2 + B(d)), with d = |dot(from, to)|.
+		const T halfOffset = aT - static_cast<T>(0.5);
+		const T halfOffsetSqr = halfOffset * halfOffset;
+		const T cubic = aT * halfOffset * (aT - static_cast<T>(1));
+
+		ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+		{
+			using Lane = decltype(aLane);
+			using V = typename Lane::Type;
+
+			V x0, y0, z0, w0, x1, y1, z1, w1;
+			Lane::LoadTransposed4(&aFrom[i].x, x0, y0, z0, w0);
+			Lane::LoadTransposed4(&aTo[i].x, x1, y1, z1, w1);
+
+			V dot = Lane::Multiply(x0, x1);
+			dot = Lane::MultiplyAdd(y0, y1, dot);
+			dot = Lane::MultiplyAdd(z0, z1, dot);
+			dot = Lane::MultiplyAdd(w0, w1, dot);
+
+			V t = Lane::Set(aT);
+			if (aCorrected)
+			{
+				const V d = Lane::Abs(dot);
+				const V a = Lane::MultiplyAdd(d, Lane::MultiplyAdd(d, Lane::MultiplyAdd(d, Lane::Set(static_cast<T>(-1.43519)), Lane::Set(static_cast<T>(3.55645))), Lane::Set(static_cast<T>(-3.2452))), Lane::Set(static_cast<T>(1.0904)));
+				const V b = Lane::MultiplyAdd(d, Lane::MultiplyAdd(d, Lane::Set(static_cast<T>(0.215638)), Lane::Set(static_cast<T>(-1.06021))), Lane::Set(static_cast<T>(0.848013)));
+				const V k = Lane::MultiplyAdd(a, Lane::Set(halfOffsetSqr), b);
+				t = Lane::MultiplyAdd(Lane::Set(cubic), k, t);
+			}
+
+			V x, y, z, w;
+			BlendQuaternion<Lane, V, T>(x0, y0, z0, w0, x1, y1, z1, w1, dot, t, x, y, z, w);
+			Lane::StoreTransposed4(&aOut[i].x, x, y, z, w);
+		});
+	}
+}
+
+// aOut[i] = aLhs[i] * aRhs[i]
+template<typename T>
+inline void MultiplyQuaternions(const Quaternion<T>* aLhs, const Quaternion<T>* aRhs, Quaternion<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using V = typename Lane::Type;
+
+		V x0, y0, z0, w0, x1, y1, z1, w1;
+		Lane::LoadTransposed4(&aLhs[i].x, x0, y0, z0, w0);
+		Lane::LoadTransposed4(&aRhs[i].x, x1, y1, z1, w1);
+
+		// v = w0 * v1 + w1 * v0 + v0 x v1, w = w0 * w1 - v0 . v1
+		const V x = Lane::Add(Lane::MultiplyAdd(w0, x1, Lane::Multiply(w1, x0)), Lane::Subtract(Lane::Multiply(y0, z1), Lane::Multiply(z0, y1)));
+		const V y = Lane::Add(Lane::MultiplyAdd(w0, y1, Lane::Multiply(w1, y0)), Lane::Subtract(Lane::Multiply(z0, x1), Lane::Multiply(x0, z1)));
+		const V z = Lane::Add(Lane::MultiplyAdd(w0, z1, Lane::Multiply(w1, z0)), Lane::Subtract(Lane::Multiply(x0, y1), Lane::Multiply(y0, x1)));
+
+		V dot = Lane::Multiply(x0, x1);
+		dot = Lane::MultiplyAdd(y0, y1, dot);
+		dot = Lane::MultiplyAdd(z0, z1, dot);
+		const V w = Lane::Subtract(Lane::Multiply(w0, w1), dot);
+
+		Lane::StoreTransposed4(&aOut[i].x, x, y, z, w);
+	});
+}
+
+template<typename T>
+inline void NormalizeQuaternions(const Quaternion<T>* aQuaternions, Quaternion<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using V = typename Lane::Type;
+
+		V x, y, z, w;
+		Lane::LoadTransposed4(&aQuaternions[i].x, x, y, z, w);
+		Ohm::Simd::NormalizeQuaternion<Lane, V, T>(x, y, z, w);
+		Lane::StoreTransposed4(&aOut[i].x, x, y, z, w);
+	});
+}
+
+// Blends every element with the same factor aT, e.g. two full skeleton poses.
+template<typename T>
+inline void NlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, T aT, Quaternion<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::NlerpQuaternions(aFrom, aTo, aT, aOut, aCount, false);
+}
+
+// Blends element i with its own factor aT[i], e.g. the keys of an animation clip.
+template<typename T>
+inline void NlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, const T* aT, Quaternion<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using V = typename Lane::Type;
+
+		V x0, y0, z0, w0, x1, y1, z1, w1;
+		Lane::LoadTransposed4(&aFrom[i].x, x0, y0, z0, w0);
+		Lane::LoadTransposed4(&aTo[i].x, x1, y1, z1, w1);
+
+		V dot = Lane::Multiply(x0, x1);
+		dot = Lane::MultiplyAdd(y0, y1, dot);
+		dot = Lane::MultiplyAdd(z0, z1, dot);
+		dot = Lane::MultiplyAdd(w0, w1, dot);
+
+		V x, y, z, w;
+		Ohm::Simd::BlendQuaternion<Lane, V, T>(x0, y0, z0, w0, x1, y1, z1, w1, dot, Lane::Load(aT + i), x, y, z, w);
+		Lane::StoreTransposed4(&aOut[i].x, x, y, z, w);
+	});
+}
+
+template<typename T>
+inline void SlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, T aT, Quaternion<T>* aOut, size_t aCount,
+	QuaternionInterpolation aMode = QuaternionInterpolation::Exact)
+{
+	if (aMode == QuaternionInterpolation::Approximate)
+	{
+		Ohm::Simd::NlerpQuaternions(aFrom, aTo, aT, aOut, aCount, true);
+		return;
+	}
+
+	for (size_t i = 0; i < aCount; i++)
+	{
+		aOut[i] = Quaternion<T>::Slerp(aFrom[i], aTo[i], aT);
+	}
+}
+
+// aOut[i] = aRotations[i].ToMatrix4x4()
+template<typename T>
+inline void QuaternionsToMatrices(const Quaternion<T>* aRotations, Matrix4x4<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using V = typename Lane::Type;
+
+		V x, y, z, w;
+		Lane::LoadTransposed4(&aRotations[i].x, x, y, z, w);
+
+		const V two = Lane::Set(static_cast<T>(2));
+		const V one = Lane::Set(static_cast<T>(1));
+		const V zero = Lane::Set(static_cast<T>(0));
+
+		const V x2 = Lane::Multiply(x, two);
+		const V y2 = Lane::Multiply(y, two);
+		const V z2 = Lane::Multiply(z, two);
+		const V xx = Lane::Multiply(x, x2);
+		const V yy = Lane::Multiply(y, y2);
+		const V zz = Lane::Multiply(z, z2);
+		const V xy = Lane::Multiply(x, y2);
+		const V xz = Lane::Multiply(x, z2);
+		const V yz = Lane::Multiply(y, z2);
+		const V wx = Lane::Multiply(w, x2);
+		const V wy = Lane::Multiply(w, y2);
+		const V wz = Lane::Multiply(w, z2);
+
+		// Every matrix is 16 scalars, each row is written as a transposed 4 component store.
+		T* destination = &aOut[i](1).x;
+		Lane::StoreTransposed4(destination + 0, Lane::Subtract(Lane::Subtract(one, yy), zz), Lane::Add(xy, wz), Lane::Subtract(xz, wy), zero, 16);
+		Lane::StoreTransposed4(destination + 4, Lane::Subtract(xy, wz), Lane::Subtract(Lane::Subtract(one, xx), zz), Lane::Add(yz, wx), zero, 16);
+		Lane::StoreTransposed4(destination + 8, Lane::Add(xz, wy), Lane::Subtract(yz, wx), Lane::Subtract(Lane::Subtract(one, xx), yy), zero, 16);
+		Lane::StoreTransposed4(destination + 12, zero, zero, zero, one, 16);
+	});
+}
+
+// aOut[i] = aRotations[i].Rotate(aVectors[i])
+template<typename T>
+inline void RotateVectors(const Quaternion<T>* aRotations, const Vector3<T>* aVectors, Vector3<T>* aOut, size_t aCount)
+{
+	Ohm::Simd::ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		using V = typename Lane::Type;
+
+		V qx, qy, qz, qw, vx, vy, vz;
+		Lane::LoadTransposed4(&aRotations[i].x, qx, qy, qz, qw);
+		Lane::LoadTransposed3(&aVectors[i].x, vx, vy, vz);
+
+		// t = 2 * (q x v)
+		const V two = Lane::Set(static_cast<T>(2));
+		const V tx = Lane::Multiply(two, Lane::Subtract(Lane::Multiply(qy, vz), Lane::Multiply(qz, vy)));
+		const V ty = Lane::Multiply(two, Lane::Subtract(Lane::Multiply(qz, vx), Lane::Multiply(qx, vz)));
+		const V tz = Lane::Multiply(two, Lane::Subtract(Lane::Multiply(qx, vy), Lane::Multiply(qy, vx)));
+
+		// v + w * t + q x t
+		const V x = Lane::Add(Lane::MultiplyAdd(qw, tx, vx), Lane::Subtract(Lane::Multiply(qy, tz), Lane::Multiply(qz, ty)));
+		const V y = Lane::Add(Lane::MultiplyAdd(qw, ty, vy), Lane::Subtract(Lane::Multiply(qz, tx), Lane::Multiply(qx, tz)));
+		const V z = Lane::Add(Lane::MultiplyAdd(qw, tz, vz), Lane::Subtract(Lane::Multiply(qx, ty), Lane::Multiply(qy, tx)));
+
+		Lane::StoreTransposed3(&aOut[i].x, x, y, z);
+	});
+}
+
+// Threaded blends, aPool runs the kernels above on ParallelGrain sized chunks with the same results.
+template<typename T>
+inline void NormalizeQuaternions(const Quaternion<T>* aQuaternions, Quaternion<T>* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Quaternion<T>) * 2), [&](size_t aBegin, size_t aEnd)
+	{
+		NormalizeQuaternions(aQuaternions + aBegin, aOut + aBegin, aEnd - aBegin);
+	});
+}
+
+template<typename T>
+inline void NlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, T aT, Quaternion<T>* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Quaternion<T>) * 3), [&](size_t aBegin, size_t aEnd)
+	{
+		NlerpQuaternions(aFrom + aBegin, aTo + aBegin, aT, aOut + aBegin, aEnd - aBegin);
+	});
+}
+
+template<typename T>
+inline void NlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, const T* aT, Quaternion<T>* aOut, size_t aCount, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Quaternion<T>) * 3 + sizeof(T)), [&](size_t aBegin, size_t aEnd)
+	{
+		NlerpQuaternions(aFrom + aBegin, aTo + aBegin, aT + aBegin, aOut + aBegin, aEnd - aBegin);
+	});
+}
+
+template<typename T>
+inline void SlerpQuaternions(const Quaternion<T>* aFrom, const Quaternion<T>* aTo, T aT, Quaternion<T>* aOut, size_t aCount,
+	QuaternionInterpolation aMode, ThreadPool* aPool)
+{
+	Ohm::Detail::ParallelFor(aPool, aCount, Ohm::Detail::ParallelGrain(sizeof(Quaternion<T>) * 3), [&](size_t aBegin, size_t aEnd)
+	{
+		SlerpQuaternions(aFrom + aBegin, aTo + aBegin, aT, aOut + aBegin, aEnd - aBegin, aMode);
+	});
+}
@@ -0,0 +1,381 @@
+#pragma once
+
+#include "Ohm/Utility/Utility.hpp"
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Matrix/Matrix4x4.hpp"
+#include "Ohm/Matrix/TransformBatch.hpp"
+#include "Ohm/Vector/Vector3SoA.hpp"
+
+// Runtime dispatched float kernels.
+// Every kernel has a scalar, an SSE and an AVX2+FMA version, the AVX2 and AVX-512 versions are compiled with
+// per-function target attributes so they exist regardless of the flags the translation unit is built with.
+// Ohm::Dispatch functions call the version matching Ohm::GetInstructionSet(), the compile-time API is unaffected.
+//
+// SSE2 and SSE4.1 share the SSE kernels, the AVX-512 table uses 16 wide matrix multiply and normalize kernels
+// and the AVX2 transforms. FMA versions are not bit-identical to the scalar path.
+#if defined(OHM_SIMD_SSE2)
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#define OHM_TARGET_AVX2
+		#define OHM_TARGET_AVX512
+	#else
+		#define OHM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+		#define OHM_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+	#endif
+#endif
+
+namespace Ohm::Dispatch
+{
+	struct KernelTable
+	{
+		void (*MultiplyMatrices)(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount);
+		void (*TransformPoints)(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount);
+		void (*TransformDirections)(const Matrix4x4<float>& aMatrix, const Vector3<float>* aDirections, Vector3<float>* aOut, size_t aCount);
+		void (*TransformPointsProjective)(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount);
+		void (*NormalizeVector3)(const float* aX, const float* aY, const float* aZ, float* aOutX, float* aOutY, float* aOutZ, size_t aCount);
+	};
+
+	namespace Scalar
+	{
+		inline void MultiplyMatrices(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount)
+		{
+			for (size_t i = 0; i < aCount; i++)
+			{
+				aOut[i] = operator*<float>(aLhs[i], aRhs[i]);
+			}
+		}
+
+		inline void TransformPoints(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+		{
+			::TransformPoints<float>(aMatrix, aPoints, aOut, aCount);
+		}
+
+		inline void TransformDirections(const Matrix4x4<float>& aMatrix, const Vector3<float>* aDirections, Vector3<float>* aOut, size_t aCount)
+		{
+			::TransformDirections<float>(aMatrix, aDirections, aOut, aCount);
+		}
+
+		inline void TransformPointsProjective(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+		{
+			::TransformPointsProjective<float>(aMatrix, aPoints, aOut, aCount);
+		}
+
+		inline void NormalizeVector3(const float* aX, const float* aY, const float* aZ, float* aOutX, float* aOutY, float* aOutZ, size_t aCount)
+		{
+			for (size_t i = 0; i < aCount; i++)
+			{
+				const float length = std::sqrt(aX[i] * aX[i] + aY[i] * aY[i] + aZ[i] * aZ[i]);
+				aOutX[i] = aX[i] / length;
+				aOutY[i] = aY[i] / length;
+				aOutZ[i] = aZ[i] / length;
+			}
+		}
+
+		constexpr KernelTable Kernels = { &MultiplyMatrices, &TransformPoints, &TransformDirections, &TransformPointsProjective, &NormalizeVector3 };
+	}
+
+#if defined(OHM_SIMD_SSE2)
+	namespace SSE
+	{
+		inline void MultiplyMatrices(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount)
+		{
+			for (size_t i = 0; i < aCount; i++)
+			{
+				Ohm::Simd::MultiplyMatrix4x4SSE(&aLhs[i](1).x, &aRhs[i](1).x, &aOut[i](1).x);
+			}
+		}
+
+		template<Ohm::Simd::TransformMode Mode>
+		inline void TransformVector3(const Matrix4x4<float>& aMatrix, const Vector3<float>* aIn, Vector3<float>* aOut, size_t aCount)
+		{
+			const size_t processed = Ohm::Simd::TransformVector3SSE<Mode>(&aMatrix(1).x, reinterpret_cast<const float*>(aIn), reinterpret_cast<float*>(aOut), aCount);
+			if constexpr (Mode == Ohm::Simd::TransformMode::Point)
+			{
+				::TransformPoints<float>(aMatrix, aIn + processed, aOut + processed, aCount - processed);
+			}
+			else if constexpr (Mode == Ohm::Simd::TransformMode::Direction)
+			{
+				::TransformDirections<float>(aMatrix, aIn + processed, aOut + processed, aCount - processed);
+			}
+			else
+			{
+				::TransformPointsProjective<float>(aMatrix, aIn + processed, aOut + processed, aCount - processed);
+			}
+		}
+
+		inline void NormalizeVector3(const float* aX, const float* aY, const float* aZ, float* aOutX, float* aOutY, float* aOutZ, size_t aCount)
+		{
+			size_t i = 0;
+			for (; i + 4 <= aCount; i += 4)
+			{
+				const __m128 x = _mm_loadu_ps(aX + i);
+				const __m128 y = _mm_loadu_ps(aY + i);
+				const __m128 z = _mm_loadu_ps(aZ + i);
+				const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+
+				_mm_storeu_ps(aOutX + i, _mm_div_ps(x, length));
+				_mm_storeu_ps(aOutY + i, _mm_div_ps(y, length));
+				_mm_storeu_ps(aOutZ + i, _mm_div_ps(z, length));
+			}
+
+			Scalar::NormalizeVector3(aX + i, aY + i, aZ + i, aOutX + i, aOutY + i, aOutZ + i, aCount - i);
+		}
+
+		constexpr KernelTable Kernels =
+		{
+			&MultiplyMatrices,
+			&TransformVector3<Ohm::Simd::TransformMode::Point>,
+			&TransformVector3<Ohm::Simd::TransformMode::Direction>,
+			&TransformVector3<Ohm::Simd::TransformMode::ProjectivePoint>,
+			&NormalizeVector3
+		};
+	}
+
+	namespace AVX2
+	{
+		OHM_TARGET_AVX2 inline void MultiplyMatrices(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount)
+		{
+			for (size_t i = 0; i < aCount; i++)
+			{
+				const float* lhs = &aLhs[i](1).x;
+				const float* rhs = &aRhs[i](1).x;
+				float* out = &aOut[i](1).x;
+
+				const __m256 rhsRow0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 0));
+				const __m256 rhsRow1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 4));
+				const __m256 rhsRow2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 8));
+				const __m256 rhsRow3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 12));
+
+				// Two result rows per register, one in each 128 bit lane.
+				const __m256 lhsRows01 = _mm256_loadu_ps(lhs + 0);
+				const __m256 lhsRows23 = _mm256_loadu_ps(lhs + 8);
+
+				__m256 rows01 = _mm256_mul_ps(_mm256_permute_ps(lhsRows01, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+				__m256 rows23 = _mm256_mul_ps(_mm256_permute_ps(lhsRows23, _MM_SHUFFLE(0, 0, 0, 0)), rhsRow0);
+				rows01 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows01, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1, rows01);
+				rows23 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows23, _MM_SHUFFLE(1, 1, 1, 1)), rhsRow1, rows23);
+				rows01 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows01, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2, rows01);
+				rows23 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows23, _MM_SHUFFLE(2, 2, 2, 2)), rhsRow2, rows23);
+				rows01 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows01, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3, rows01);
+				rows23 = _mm256_fmadd_ps(_mm256_permute_ps(lhsRows23, _MM_SHUFFLE(3, 3, 3, 3)), rhsRow3, rows23);
+
+				_mm256_storeu_ps(out + 0, rows01);
+				_mm256_storeu_ps(out + 8, rows23);
+			}
+		}
+
+		// Same transposition as Ohm::Simd::LoadVector3x8 and StoreVector3x8, repeated here so it is compiled for AVX2.
+		OHM_TARGET_AVX2 inline void LoadVector3x8(const float* aSource, __m256& aX, __m256& aY, __m256& aZ)
+		{
+			const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 0)), _mm_loadu_ps(aSource + 12), 1);
+			const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 4)), _mm_loadu_ps(aSource + 16), 1);
+			const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 8)), _mm_loadu_ps(aSource + 20), 1);
+
+			const __m256 bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+			aX = _mm256_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+			aY = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), bc, _MM_SHUFFLE(3, 1, 2, 0));
+			aZ = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+		}
+
+		OHM_TARGET_AVX2 inline void StoreVector3x8(float* aDestination, __m256 aX, __m256 aY, __m256 aZ)
+		{
+			const __m256 xyLow = _mm256_unpacklo_ps(aX, aY);
+			const __m256 xyHigh = _mm256_unpackhi_ps(aX, aY);
+			const __m256 yzLow = _mm256_unpacklo_ps(aY, aZ);
+			const __m256 yzHigh = _mm256_unpackhi_ps(aY, aZ);
+			const __m256 zxLow = _mm256_unpacklo_ps(aZ, aX);
+			const __m256 zxHigh = _mm256_unpackhi_ps(aZ, aX);
+
+			const __m256 a = _mm256_shuffle_ps(xyLow, zxLow, _MM_SHUFFLE(3, 0, 1, 0));
+			const __m256 b = _mm256_shuffle_ps(yzLow, xyHigh, _MM_SHUFFLE(1, 0, 3, 2));
+			const __m256 c = _mm256_shuffle_ps(zxHigh, yzHigh, _MM_SHUFFLE(3, 2, 3, 0));
+
+			_mm_storeu_ps(aDestination + 0, _mm256_castps256_ps128(a));
+			_mm_storeu_ps(aDestination + 4, _mm256_castps256_ps128(b));
+			_mm_storeu_ps(aDestination + 8, _mm256_castps256_ps128(c));
+			_mm_storeu_ps(aDestination + 12, _mm256_extractf128_ps(a, 1));
+			_mm_storeu_ps(aDestination + 16, _mm256_extractf128_ps(b, 1));
+			_mm_storeu_ps(aDestination + 20, _mm256_extractf128_ps(c, 1));
+		}
+
+		template<Ohm::Simd::TransformMode Mode>
+		OHM_TARGET_AVX2 inline void TransformVector3(const Matrix4x4<float>& aMatrix, const Vector3<float>* aIn, Vector3<float>* aOut, size_t aCount)
+		{
+			const float* matrix = &aMatrix(1).x;
+			const float* in = reinterpret_cast<const float*>(aIn);
+			float* out = reinterpret_cast<float*>(aOut);
+
+			__m256 m[16];
+			for (int i = 0; i < 16; i++)
+			{
+				m[i] = _mm256_set1_ps(matrix[i]);
+			}
+
+			size_t i = 0;
+			for (; i + 8 <= aCount; i += 8)
+			{
+				__m256 x, y, z;
+				LoadVector3x8(in + i * 3, x, y, z);
+
+				__m256 result[4];
+				for (int column = 0; column < (Mode == Ohm::Simd::TransformMode::ProjectivePoint ? 4 : 3); column++)
+				{
+					__m256 value = _mm256_mul_ps(x, m[column]);
+					value = _mm256_fmadd_ps(y, m[4 + column], value);
+					value = _mm256_fmadd_ps(z, m[8 + column], value);
+					if constexpr (Mode != Ohm::Simd::TransformMode::Direction)
+					{
+						value = _mm256_add_ps(value, m[12 + column]);
+					}
+					result[column] = value;
+				}
+
+				if constexpr (Mode == Ohm::Simd::TransformMode::ProjectivePoint)
+				{
+					result[0] = _mm256_div_ps(result[0], result[3]);
+					result[1] = _mm256_div_ps(result[1], result[3]);
+					result[2] = _mm256_div_ps(result[2], result[3]);
+				}
+
+				StoreVector3x8(out + i * 3, result[0], result[1], result[2]);
+			}
+
+			SSE::TransformVector3<Mode>(aMatrix, aIn + i, aOut + i, aCount - i);
+		}
+
+		OHM_TARGET_AVX2 inline void NormalizeVector3(const float* aX, const float* aY, const float* aZ, float* aOutX, float* aOutY, float* aOutZ, size_t aCount)
+		{
+			size_t i = 0;
+			for (; i + 8 <= aCount; i += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(aX + i);
+				const __m256 y = _mm256_loadu_ps(aY + i);
+				const __m256 z = _mm256_loadu_ps(aZ + i);
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x))));
+
+				_mm256_storeu_ps(aOutX + i, _mm256_div_ps(x, length));
+				_mm256_storeu_ps(aOutY + i, _mm256_div_ps(y, length));
+				_mm256_storeu_ps(aOutZ + i, _mm256_div_ps(z, length));
+			}
+
+			SSE::NormalizeVector3(aX + i, aY + i, aZ + i, aOutX + i, aOutY + i, aOutZ + i, aCount - i);
+		}
+
+		constexpr KernelTable Kernels =
+		{
+			&MultiplyMatrices,
+			&TransformVector3<Ohm::Simd::TransformMode::Point>,
+			&TransformVector3<Ohm::Simd::TransformMode::Direction>,
+			&TransformVector3<Ohm::Simd::TransformMode::ProjectivePoint>,
+			&NormalizeVector3
+		};
+	}
+
+	// GCC 12 reports the _mm512_undefined_ps() inside its own intrinsics as uninitialized (GCC bug 105593).
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+	namespace AVX512
+	{
+		// One matrix per register, the four 128 bit lanes hold the four rows.
+		OHM_TARGET_AVX512 inline void MultiplyMatrices(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount)
+		{
+			for (size_t i = 0; i < aCount; i++)
+			{
+				const float* lhs = &aLhs[i](1).x;
+				const float* rhs = &aRhs[i](1).x;
+
+				const __m512 lhsRows = _mm512_loadu_ps(lhs);
+				const __m512 rhsRows = _mm512_loadu_ps(rhs);
+
+				__m512 rows = _mm512_mul_ps(_mm512_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(0, 0, 0, 0)), _mm512_shuffle_f32x4(rhsRows, rhsRows, _MM_SHUFFLE(0, 0, 0, 0)));
+				rows = _mm512_fmadd_ps(_mm512_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(1, 1, 1, 1)), _mm512_shuffle_f32x4(rhsRows, rhsRows, _MM_SHUFFLE(1, 1, 1, 1)), rows);
+				rows = _mm512_fmadd_ps(_mm512_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(2, 2, 2, 2)), _mm512_shuffle_f32x4(rhsRows, rhsRows, _MM_SHUFFLE(2, 2, 2, 2)), rows);
+				rows = _mm512_fmadd_ps(_mm512_shuffle_ps(lhsRows, lhsRows, _MM_SHUFFLE(3, 3, 3, 3)), _mm512_shuffle_f32x4(rhsRows, rhsRows, _MM_SHUFFLE(3, 3, 3, 3)), rows);
+
+				_mm512_storeu_ps(&aOut[i](1).x, rows);
+			}
+		}
+
+		OHM_TARGET_AVX512 inline void NormalizeVector3(const float* aX, const float* aY, const float* aZ, float* aOutX, float* aOutY, float* aOutZ, size_t aCount)
+		{
+			size_t i = 0;
+			for (; i + 16 <= aCount; i += 16)
+			{
+				const __m512 x = _mm512_loadu_ps(aX + i);
+				const __m512 y = _mm512_loadu_ps(aY + i);
+				const __m512 z = _mm512_loadu_ps(aZ + i);
+				const __m512 length = _mm512_sqrt_ps(_mm512_fmadd_ps(z, z, _mm512_fmadd_ps(y, y, _mm512_mul_ps(x, x))));
+
+				_mm512_storeu_ps(aOutX + i, _mm512_div_ps(x, length));
+				_mm512_storeu_ps(aOutY + i, _mm512_div_ps(y, length));
+				_mm512_storeu_ps(aOutZ + i, _mm512_div_ps(z, length));
+			}
+
+			AVX2::NormalizeVector3(aX + i, aY + i, aZ + i, aOutX + i, aOutY + i, aOutZ + i, aCount - i);
+		}
+
+		constexpr KernelTable Kernels =
+		{
+			&MultiplyMatrices,
+			&AVX2::TransformVector3<Ohm::Simd::TransformMode::Point>,
+			&AVX2::TransformVector3<Ohm::Simd::TransformMode::Direction>,
+			&AVX2::TransformVector3<Ohm::Simd::TransformMode::ProjectivePoint>,
+			&NormalizeVector3
+		};
+	}
+#if defined(__GNUC__) && !defined(__clang__)
+	#pragma GCC diagnostic pop
+#endif
+#endif
+
+	// Does not check aInstructionSet against the CPU, see Ohm::IsSupported.
+	inline const KernelTable& GetKernels(InstructionSet aInstructionSet)
+	{
+#if defined(OHM_SIMD_SSE2)
+		switch (aInstructionSet)
+		{
+			case InstructionSet::SSE2:
+			case InstructionSet::SSE4_1: return SSE::Kernels;
+			case InstructionSet::AVX2: return AVX2::Kernels;
+			case InstructionSet::AVX512: return AVX512::Kernels;
+			default: break;
+		}
+#else
+		(void)aInstructionSet;
+#endif
+		return Scalar::Kernels;
+	}
+
+	inline const KernelTable& GetKernels()
+	{
+		return GetKernels(GetInstructionSet());
+	}
+
+	inline void MultiplyMatrices(const Matrix4x4<float>* aLhs, const Matrix4x4<float>* aRhs, Matrix4x4<float>* aOut, size_t aCount)
+	{
+		GetKernels().MultiplyMatrices(aLhs, aRhs, aOut, aCount);
+	}
+
+	inline void TransformPoints(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+	{
+		GetKernels().TransformPoints(aMatrix, aPoints, aOut, aCount);
+	}
+
+	inline void TransformDirections(const Matrix4x4<float>& aMatrix, const Vector3<float>* aDirections, Vector3<float>* aOut, size_t aCount)
+	{
+		GetKernels().TransformDirections(aMatrix, aDirections, aOut, aCount);
+	}
+
+	inline void TransformPointsProjective(const Matrix4x4<float>& aMatrix, const Vector3<float>* aPoints, Vector3<float>* aOut, size_t aCount)
+	{
+		GetKernels().TransformPointsProjective(aMatrix, aPoints, aOut, aCount);
+	}
+
+	// aOut is resized to match and may be aVectors.
+	inline void Normalize(const Vector3SoA<float>& aVectors, Vector3SoA<float>& aOut)
+	{
+		aOut.Resize(aVectors.Size());
+		GetKernels().NormalizeVector3(aVectors.X(), aVectors.Y(), aVectors.Z(), aOut.X(), aOut.Y(), aOut.Z(), aVectors.Size());
+	}
+}
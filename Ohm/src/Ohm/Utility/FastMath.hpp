@@ -0,0 +1,329 @@
+#pragma once
+
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Accuracy tiers of the math functions below and of the builders that take them (NormalizeWith, LengthWith,
+// CreateRotationAround*With, SlerpWith, ...). Errors are relative for InvSqrt/Sqrt and absolute (radians or unit values) otherwise.
+enum class MathAccuracy
+{
+	// <cmath>, the same results as without tiers.
+	Exact,
+	// Within about 1e-6 (2e-7 for rsqrt), polynomial or Newton refined estimates.
+	Fast,
+	// Within about 1e-3, the raw hardware estimates and short polynomials.
+	Approximate
+};
+
+// The tier of the plain builders (Normalize, Length, ...), e.g. -DOHM_MATH_ACCURACY=Fast.
+#if !defined(OHM_MATH_ACCURACY)
+	#define OHM_MATH_ACCURACY Exact
+#endif
+
+// Only float and double have approximations, other types (integers, Fixed) always take the exact path.
+// During constant evaluation InvSqrt, Sqrt and Acos fall back to exact values, SinCos and Atan2 give the same values as at run time
+// (except SinCos beyond Detail::ReductionLimit, which is exact in both cases).
+namespace Ohm::Math
+{
+	constexpr MathAccuracy DefaultAccuracy = MathAccuracy::OHM_MATH_ACCURACY;
+
+	template<MathAccuracy Accuracy, typename T>
+	constexpr bool IsApproximate = Accuracy != MathAccuracy::Exact && (std::is_same_v<T, float> || std::is_same_v<T, double>);
+
+	namespace Detail
+	{
+		// Magic constant estimate, 1.75e-3 relative error after one Newton step.
+		inline float InvSqrtEstimate(float aValue)
+		{
+			uint32_t bits;
+			std::memcpy(&bits, &aValue, sizeof(bits));
+			bits = 0x5F375A86u - (bits >> 1);
+			float estimate;
+			std::memcpy(&estimate, &bits, sizeof(estimate));
+			return estimate;
+		}
+
+		inline double InvSqrtEstimate(double aValue)
+		{
+			uint64_t bits;
+			std::memcpy(&bits, &aValue, sizeof(bits));
+			bits = 0x5FE6EB50C7B537A9ull - (bits >> 1);
+			double estimate;
+			std::memcpy(&estimate, &bits, sizeof(estimate));
+			return estimate;
+		}
+
+		// One step squares the relative error: 3.7e-4 -> 2e-7 -> 6e-14.
+		template<typename T>
+		inline T InvSqrtNewton(T aValue, T aEstimate)
+		{
+			return aEstimate * (static_cast<T>(1.5) - (static_cast<T>(0.5) * aValue) * (aEstimate * aEstimate));
+		}
+
+		// Largest |angle| ReduceQuarterTurns takes, beyond it the quadrant would not fit an int and float loses accuracy.
+		constexpr double ReductionLimit = 16384.0;
+
+		// Cody-Waite reduction to [-pi / 4, pi / 4] around the nearest multiple of pi / 2, returns the quadrant.
+		// The three part constant keeps float accurate for |aAngle| up to ReductionLimit, callers handle larger and non finite angles.
+		template<typename T>
+		constexpr int ReduceQuarterTurns(T aAngle, T& aOutReduced)
+		{
+			// Adding and removing 1.5 * 2^mantissa rounds to nearest without a branch on the sign.
+			const T round = std::is_same_v<T, float> ? static_cast<T>(12582912.0) : static_cast<T>(6755399441055744.0);
+			const T multiple = (aAngle * static_cast<T>(0.63661977236758134308) + round) - round;
+			const int quadrant = static_cast<int>(multiple);
+			aOutReduced = ((aAngle - multiple * static_cast<T>(1.5703125)) - multiple * static_cast<T>(4.837512969970703125e-4)) - multiple * static_cast<T>(7.54978995489188216e-8);
+			return quadrant;
+		}
+	}
+
+	// 1 / sqrt(aValue) for aValue > 0. Fast and Approximate refine the SSE estimate (or a magic constant estimate without SSE).
+	template<MathAccuracy Accuracy = DefaultAccuracy, typename T>
+	constexpr T InvSqrt(T aValue)
+	{
+		if constexpr (!IsApproximate<Accuracy, T>)
+		{
+			return static_cast<T>(1) / Sqrt(aValue);
+		}
+		else
+		{
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<T>(1) / Sqrt(aValue);
+			}
+
+#if defined(OHM_SIMD_SSE2)
+			if constexpr (std::is_same_v<T, float>)
+			{
+				const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(aValue)));
+				return Accuracy == MathAccuracy::Fast ? Detail::InvSqrtNewton(aValue, estimate) : estimate;
+			}
+			else
+			{
+				// The float estimate only covers the float range.
+				if (aValue < static_cast<double>(std::numeric_limits<float>::min()) || aValue > static_cast<double>(std::numeric_limits<float>::max()))
+				{
+					return 1.0 / std::sqrt(aValue);
+				}
+				const double estimate = static_cast<double>(_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(static_cast<float>(aValue)))));
+				return Accuracy == MathAccuracy::Fast ? Detail::InvSqrtNewton(aValue, Detail::InvSqrtNewton(aValue, estimate)) : estimate;
+			}
+#else
+			const T estimate = Detail::InvSqrtNewton(aValue, Detail::InvSqrtNewton(aValue, Detail::InvSqrtEstimate(aValue)));
+			return Accuracy == MathAccuracy::Fast ? Detail::InvSqrtNewton(aValue, estimate) : estimate;
+#endif
+		}
+	}
+
+	// Tiered square root, aValue * InvSqrt(aValue). The tier has no default so Sqrt(aValue) stays the exact one above.
+	template<MathAccuracy Accuracy, typename T>
+	constexpr T Sqrt(T aValue)
+	{
+		if constexpr (!IsApproximate<Accuracy, T>)
+		{
+			return Sqrt(aValue);
+		}
+		else
+		{
+			return aValue > static_cast<T>(0) ? aValue * InvSqrt<Accuracy>(aValue) : static_cast<T>(0);
+		}
+	}
+
+	// Sine and cosine of one angle with a shared range reduction.
+	template<MathAccuracy Accuracy = DefaultAccuracy, typename T>
+	constexpr void SinCos(T aAngle, T& aOutSin, T& aOutCos)
+	{
+		if constexpr (!IsApproximate<Accuracy, T>)
+		{
+			aOutSin = Sin(aAngle);
+			aOutCos = Cos(aAngle);
+		}
+		else
+		{
+			// Huge, infinite and NaN angles take the exact path, which also keeps the quadrant cast defined.
+			if (!(Abs(aAngle) <= static_cast<T>(Detail::ReductionLimit)))
+			{
+				aOutSin = Sin(aAngle);
+				aOutCos = Cos(aAngle);
+				return;
+			}
+
+			T reduced = 0;
+			const int quadrant = Detail::ReduceQuarterTurns(aAngle, reduced);
+			const T squared = reduced * reduced;
+
+			T sin = 0;
+			T cos = 0;
+			if constexpr (Accuracy == MathAccuracy::Fast)
+			{
+				// Cephes sinf/cosf minimax polynomials on [-pi / 4, pi / 4].
+				sin = reduced + reduced * squared * (static_cast<T>(-1.6666654611e-1) + squared * (static_cast<T>(8.3321608736e-3) + squared * static_cast<T>(-1.9515295891e-4)));
+				cos = static_cast<T>(1) - static_cast<T>(0.5) * squared + squared * squared * (static_cast<T>(4.166664568298827e-2) + squared * (static_cast<T>(-1.388731625493765e-3) + squared * static_cast<T>(2.443315711809948e-5)));
+			}
+			else
+			{
+				// Taylor series to x^5 and x^4, at most 3.3e-4 off.
+				sin = reduced + reduced * squared * (static_cast<T>(-1.0 / 6.0) + squared * static_cast<T>(1.0 / 120.0));
+				cos = static_cast<T>(1) - static_cast<T>(0.5) * squared + squared * squared * static_cast<T>(1.0 / 24.0);
+			}
+
+			// Branchless quadrant fix up, a switch on random angles mispredicts about half of the time.
+			// The blend swaps sine and cosine on odd quadrants at the cost of at most one rounding.
+			constexpr T factors[4] = { static_cast<T>(0), static_cast<T>(1), static_cast<T>(1), static_cast<T>(-1) };
+			const T swap = factors[quadrant & 1];
+			aOutSin = (sin + (cos - sin) * swap) * factors[2 + ((quadrant >> 1) & 1)];
+			aOutCos = (cos + (sin - cos) * swap) * factors[2 + (((quadrant + 1) >> 1) & 1)];
+		}
+	}
+
+	// Arc cosine, inputs outside [-1, 1] are clamped by the approximations.
+	// Abramowitz and Stegun 4.4.46 (2e-8) and 4.4.45 (6.7e-5) on top of the tier's square root.
+	template<MathAccuracy Accuracy = DefaultAccuracy, typename T>
+	constexpr T Acos(T aValue)
+	{
+		if constexpr (!IsApproximate<Accuracy, T>)
+		{
+			return static_cast<T>(std::acos(aValue));
+		}
+		else
+		{
+			const T x = Abs(aValue);
+			T polynomial = 0;
+			if constexpr (Accuracy == MathAccuracy::Fast)
+			{
+				polynomial = static_cast<T>(-0.0012624911);
+				polynomial = polynomial * x + static_cast<T>(0.0066700901);
+				polynomial = polynomial * x + static_cast<T>(-0.0170881256);
+				polynomial = polynomial * x + static_cast<T>(0.0308918810);
+				polynomial = polynomial * x + static_cast<T>(-0.0501743046);
+				polynomial = polynomial * x + static_cast<T>(0.0889789874);
+				polynomial = polynomial * x + static_cast<T>(-0.2145988016);
+				polynomial = polynomial * x + static_cast<T>(1.5707963050);
+			}
+			else
+			{
+				polynomial = static_cast<T>(-0.0187293);
+				polynomial = polynomial * x + static_cast<T>(0.0742610);
+				polynomial = polynomial * x + static_cast<T>(-0.2121144);
+				polynomial = polynomial * x + static_cast<T>(1.5707288);
+			}
+
+			const T result = Sqrt<Accuracy>(Max(static_cast<T>(1) - x, static_cast<T>(0))) * polynomial;
+			return aValue < static_cast<T>(0) ? static_cast<T>(Pi) - result : result;
+		}
+	}
+
+	// Angle of (aX, aY) in [-pi, pi]. The approximations return 0 for (0, 0) and ignore the sign of zero.
+	// Abramowitz and Stegun 4.4.49 (2e-8) and 4.4.47 (1e-5) for the arc tangent on [0, 1].
+	template<MathAccuracy Accuracy = DefaultAccuracy, typename T>
+	constexpr T Atan2(T aY, T aX)
+	{
+		if constexpr (!IsApproximate<Accuracy, T>)
+		{
+			return static_cast<T>(std::atan2(aY, aX));
+		}
+		else
+		{
+			const T absX = Abs(aX);
+			const T absY = Abs(aY);
+			const T maximum = Max(absX, absY);
+			if (maximum == static_cast<T>(0))
+			{
+				return static_cast<T>(0);
+			}
+
+			const T ratio = Min(absX, absY) / maximum;
+			const T squared = ratio * ratio;
+			T polynomial = 0;
+			if constexpr (Accuracy == MathAccuracy::Fast)
+			{
+				polynomial = static_cast<T>(0.0028662257);
+				polynomial = polynomial * squared + static_cast<T>(-0.0161657367);
+				polynomial = polynomial * squared + static_cast<T>(0.0429096138);
+				polynomial = polynomial * squared + static_cast<T>(-0.0752896400);
+				polynomial = polynomial * squared + static_cast<T>(0.1065626393);
+				polynomial = polynomial * squared + static_cast<T>(-0.1420889944);
+				polynomial = polynomial * squared + static_cast<T>(0.1999355085);
+				polynomial = polynomial * squared + static_cast<T>(-0.3333314528);
+				polynomial = polynomial * squared + static_cast<T>(1);
+			}
+			else
+			{
+				polynomial = static_cast<T>(0.0208351);
+				polynomial = polynomial * squared + static_cast<T>(-0.0851330);
+				polynomial = polynomial * squared + static_cast<T>(0.1801410);
+				polynomial = polynomial * squared + static_cast<T>(-0.3302995);
+				polynomial = polynomial * squared + static_cast<T>(0.9998660);
+			}
+
+			T angle = ratio * polynomial;
+			if (absY > absX)
+			{
+				angle = static_cast<T>(Pi / 2.0) - angle;
+			}
+			if (aX < static_cast<T>(0))
+			{
+				angle = static_cast<T>(Pi) - angle;
+			}
+			return aY < static_cast<T>(0) ? -angle : angle;
+		}
+	}
+}
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	// InvSqrt on every lane with the same estimate and refinement as Ohm::Math::InvSqrt<Accuracy, float>.
+	template<MathAccuracy Accuracy = Ohm::Math::DefaultAccuracy>
+	inline __m128 InvSqrt(__m128 aValue)
+	{
+		if constexpr (Accuracy == MathAccuracy::Exact)
+		{
+			return _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(aValue));
+		}
+		else
+		{
+			const __m128 estimate = _mm_rsqrt_ps(aValue);
+			if constexpr (Accuracy == MathAccuracy::Approximate)
+			{
+				return estimate;
+			}
+			else
+			{
+				const __m128 halfValue = _mm_mul_ps(aValue, _mm_set1_ps(0.5f));
+				return _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValue, _mm_mul_ps(estimate, estimate))));
+			}
+		}
+	}
+
+#if defined(OHM_SIMD_AVX)
+	template<MathAccuracy Accuracy = Ohm::Math::DefaultAccuracy>
+	inline __m256 InvSqrt(__m256 aValue)
+	{
+		if constexpr (Accuracy == MathAccuracy::Exact)
+		{
+			return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(aValue));
+		}
+		else
+		{
+			const __m256 estimate = _mm256_rsqrt_ps(aValue);
+			if constexpr (Accuracy == MathAccuracy::Approximate)
+			{
+				return estimate;
+			}
+			else
+			{
+				const __m256 halfValue = _mm256_mul_ps(aValue, _mm256_set1_ps(0.5f));
+				return _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfValue, _mm256_mul_ps(estimate, estimate))));
+			}
+		}
+	}
+#endif
+}
+#endif
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// IEEE 754 binary16 conversion.
+// Float to half rounds to nearest even like F16C, so the scalar, SSE2 and F16C paths produce the same bits.
+// The relative error is at most 2^-11 for magnitudes in [2^-14, 65504] and the absolute error at most 2^-25 below that.
+// Magnitudes from 65520 upward become infinity. NaN keeps its sign and top 9 payload bits and is quieted, as F16C does.
+// Half to float is exact.
+namespace Ohm::Math
+{
+	inline uint16_t FloatToHalf(float aValue)
+	{
+		constexpr uint32_t halfMax = (127 + 16) << 23;
+		constexpr uint32_t minNormal = (127 - 14) << 23;
+		constexpr uint32_t subnormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+		uint32_t bits;
+		std::memcpy(&bits, &aValue, sizeof(bits));
+		const uint32_t sign = bits & 0x80000000u;
+		bits ^= sign;
+
+		uint32_t half;
+		if (bits >= halfMax)
+		{
+			half = bits > 0x7F800000u ? 0x7E00u | ((bits >> 13) & 0x1FFu) : 0x7C00u;
+		}
+		else if (bits < minNormal)
+		{
+			// Adding the magic number lets the FPU do the subnormal rounding.
+			float magic;
+			std::memcpy(&magic, &subnormalMagic, sizeof(magic));
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			value += magic;
+			std::memcpy(&half, &value, sizeof(half));
+			half -= subnormalMagic;
+		}
+		else
+		{
+			// Rebias the exponent and round the 13 dropped mantissa bits to nearest even.
+			const uint32_t mantissaOdd = (bits >> 13) & 1u;
+			half = (bits + ((15u - 127u) << 23) + 0xFFFu + mantissaOdd) >> 13;
+		}
+		return static_cast<uint16_t>(half | (sign >> 16));
+	}
+
+	inline float HalfToFloat(uint16_t aHalf)
+	{
+		constexpr uint32_t shiftedExponent = 0x7C00u << 13;
+		constexpr uint32_t magicBits = 113u << 23;
+
+		uint32_t bits = (aHalf & 0x7FFFu) << 13;
+		const uint32_t exponent = bits & shiftedExponent;
+		bits += (127u - 15u) << 23;
+
+		if (exponent == shiftedExponent)
+		{
+			bits += (128u - 16u) << 23;
+		}
+		else if (exponent == 0)
+		{
+			// Subnormal, renormalize through the FPU.
+			bits += 1u << 23;
+			float value;
+			std::memcpy(&value, &bits, sizeof(value));
+			float magic;
+			std::memcpy(&magic, &magicBits, sizeof(magic));
+			value -= magic;
+			std::memcpy(&bits, &value, sizeof(bits));
+		}
+
+		bits |= static_cast<uint32_t>(aHalf & 0x8000u) << 16;
+		float result;
+		std::memcpy(&result, &bits, sizeof(result));
+		return result;
+	}
+}
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	// Four floats to four halves in the low 64 bits.
+	inline __m128i FloatToHalf4(__m128 aValue)
+	{
+#if defined(OHM_SIMD_F16C)
+		return _mm_cvtps_ph(aValue, _MM_FROUND_TO_NEAREST_INT);
+#else
+		// The same steps as Ohm::Math::FloatToHalf, with the branches turned into masks.
+		const __m128i halfMax = _mm_set1_epi32((127 + 16) << 23);
+		const __m128i minNormal = _mm_set1_epi32((127 - 14) << 23);
+		const __m128i subnormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i normalBias = _mm_set1_epi32(0xFFF - ((127 - 15) << 23));
+
+		const __m128 sign = _mm_and_ps(aValue, _mm_set1_ps(-0.f));
+		const __m128 magnitude = _mm_xor_ps(aValue, sign);
+		const __m128i bits = _mm_castps_si128(magnitude);
+
+		const __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(magnitude, magnitude));
+		const __m128i isRegular = _mm_cmpgt_epi32(halfMax, bits);
+		const __m128i nanPayload = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(bits, 13), _mm_set1_epi32(0x1FF)), _mm_set1_epi32(0x200));
+		const __m128i infinityOrNan = _mm_or_si128(_mm_and_si128(isNan, nanPayload), _mm_set1_epi32(0x7C00));
+
+		const __m128i isSubnormal = _mm_cmpgt_epi32(minNormal, bits);
+		const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(magnitude, _mm_castsi128_ps(subnormalMagic))), subnormalMagic);
+
+		const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(bits, 31 - 13), 31);
+		const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(bits, normalBias), mantissaOdd), 13);
+
+		const __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+		__m128i half = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infinityOrNan));
+		half = _mm_or_si128(half, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+
+		// Sign extend so the saturating pack keeps the top bit.
+		half = _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+		return _mm_packs_epi32(half, half);
+#endif
+	}
+
+	// Four halves from the low 64 bits to four floats.
+	inline __m128 HalfToFloat4(__m128i aHalf)
+	{
+#if defined(OHM_SIMD_F16C)
+		return _mm_cvtph_ps(aHalf);
+#else
+		const __m128i shiftedExponent = _mm_set1_epi32(0x7C00 << 13);
+
+		const __m128i halves = _mm_unpacklo_epi16(aHalf, _mm_setzero_si128());
+		const __m128i magnitude = _mm_and_si128(halves, _mm_set1_epi32(0x7FFF));
+
+		__m128i bits = _mm_slli_epi32(magnitude, 13);
+		const __m128i exponent = _mm_and_si128(bits, shiftedExponent);
+		bits = _mm_add_epi32(bits, _mm_set1_epi32((127 - 15) << 23));
+
+		const __m128i isInfinityOrNan = _mm_cmpeq_epi32(exponent, shiftedExponent);
+		bits = _mm_add_epi32(bits, _mm_and_si128(isInfinityOrNan, _mm_set1_epi32((128 - 16) << 23)));
+
+		const __m128i isSubnormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+		const __m128 subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(1 << 23))), _mm_castsi128_ps(_mm_set1_epi32(113 << 23)));
+		bits = _mm_or_si128(_mm_and_si128(isSubnormal, _mm_castps_si128(subnormal)), _mm_andnot_si128(isSubnormal, bits));
+
+		const __m128i sign = _mm_slli_epi32(_mm_xor_si128(halves, magnitude), 16);
+		return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+#endif
+	}
+}
+#endif
+
+// Converts aCount floats to halves, four (eight with AVX and F16C) at a time.
+inline void PackHalves(const float* aValues, uint16_t* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_F16C) && defined(OHM_SIMD_AVX)
+	for (; i + 8 <= aCount; i += 8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i), _mm256_cvtps_ph(_mm256_loadu_ps(aValues + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+#endif
+#if defined(OHM_SIMD_SSE2)
+	for (; i + 4 <= aCount; i += 4)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(aOut + i), Ohm::Simd::FloatToHalf4(_mm_loadu_ps(aValues + i)));
+	}
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = Ohm::Math::FloatToHalf(aValues[i]);
+	}
+}
+
+inline void UnpackHalves(const uint16_t* aHalves, float* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_F16C) && defined(OHM_SIMD_AVX)
+	for (; i + 8 <= aCount; i += 8)
+	{
+		_mm256_storeu_ps(aOut + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(aHalves + i))));
+	}
+#endif
+#if defined(OHM_SIMD_SSE2)
+	for (; i + 4 <= aCount; i += 4)
+	{
+		_mm_storeu_ps(aOut + i, Ohm::Simd::HalfToFloat4(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(aHalves + i))));
+	}
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = Ohm::Math::HalfToFloat(aHalves[i]);
+	}
+}
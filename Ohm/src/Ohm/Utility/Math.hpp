@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// OHM_IS_CONSTANT_EVALUATED() is true while a constexpr function runs at compile time,
+// which lets the SIMD and <cmath> paths fall back to plain C++ there.
+#if defined(__has_builtin)
+	#if __has_builtin(__builtin_is_constant_evaluated)
+		#define OHM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+	#endif
+#endif
+
+#if !defined(OHM_IS_CONSTANT_EVALUATED)
+	#if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+		#define OHM_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+	#else
+		#define OHM_IS_CONSTANT_EVALUATED() false
+	#endif
+#endif
+
+// Scalar math used by the vector, matrix and quaternion templates.
+// At run time these forward to <cmath>. At compile time they use the series below, which are accurate to
+// a few ULP in double, so baked values can differ from the run time ones in the last bit.
+// Integers get an exact integer square root, other scalar types (Fixed) provide static Sqrt/Sin/Cos/Tan members.
+namespace Ohm::Math
+{
+	constexpr double Pi = 3.14159265358979323846;
+
+	namespace Detail
+	{
+		// Newton iteration from above, stops once the estimate no longer decreases.
+		constexpr double SqrtNewton(double aValue)
+		{
+			if (!(aValue > 0.0))
+			{
+				return aValue == 0.0 ? 0.0 : std::numeric_limits<double>::quiet_NaN();
+			}
+
+			double current = aValue > 1.0 ? aValue : 1.0;
+			while (true)
+			{
+				const double next = 0.5 * (current + aValue / current);
+				if (next >= current)
+				{
+					return current;
+				}
+				current = next;
+			}
+		}
+
+		// Floor of the square root, digit by digit so it is exact for every unsigned width.
+		template<typename W>
+		constexpr W IntegerSqrt(W aValue)
+		{
+			W remainder = aValue;
+			W root = 0;
+			W bit = W(1) << (sizeof(W) * 8 - 2);
+
+			while (bit > remainder)
+			{
+				bit = bit >> 2;
+			}
+
+			while (bit != W(0))
+			{
+				if (remainder >= root + bit)
+				{
+					remainder = remainder - (root + bit);
+					root = (root >> 1) + bit;
+				}
+				else
+				{
+					root = root >> 1;
+				}
+				bit = bit >> 2;
+			}
+			return root;
+		}
+
+		// Taylor series, aValue is expected in [-pi / 2, pi / 2].
+		constexpr double SinSeries(double aValue)
+		{
+			const double squared = aValue * aValue;
+			double term = aValue;
+			double sum = aValue;
+			for (int i = 1; i < 12; i++)
+			{
+				term *= -squared / static_cast<double>((2 * i) * (2 * i + 1));
+				sum += term;
+			}
+			return sum;
+		}
+
+		constexpr double SinConstexpr(double aValue)
+		{
+			// Reduce to [-pi, pi] and then mirror around +-pi / 2.
+			const double turns = aValue / (2.0 * Pi);
+			const double rounded = static_cast<double>(static_cast<int64_t>(turns + (turns < 0.0 ? -0.5 : 0.5)));
+			double reduced = aValue - rounded * 2.0 * Pi;
+
+			if (reduced > Pi / 2.0)
+			{
+				reduced = Pi - reduced;
+			}
+			else if (reduced < -Pi / 2.0)
+			{
+				reduced = -Pi - reduced;
+			}
+			return SinSeries(reduced);
+		}
+	}
+
+	template<typename T>
+	constexpr T Abs(T aValue)
+	{
+		return aValue < static_cast<T>(0) ? -aValue : aValue;
+	}
+
+	// Same operand order as _mm_min_ps/_mm_max_ps, so scalar and SIMD paths agree.
+	template<typename T>
+	constexpr T Min(T aA, T aB)
+	{
+		return aA < aB ? aA : aB;
+	}
+
+	template<typename T>
+	constexpr T Max(T aA, T aB)
+	{
+		return aA > aB ? aA : aB;
+	}
+
+	template<typename T>
+	constexpr T Sqrt(T aValue)
+	{
+		if constexpr (std::is_integral_v<T>)
+		{
+			assert(aValue >= 0 && "Square root of a negative value!");
+			return aValue > 0 ? static_cast<T>(Detail::IntegerSqrt(static_cast<uint64_t>(aValue))) : T(0);
+		}
+		else if constexpr (!std::is_arithmetic_v<T>)
+		{
+			return T::Sqrt(aValue);
+		}
+		else
+		{
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<T>(Detail::SqrtNewton(static_cast<double>(aValue)));
+			}
+			return static_cast<T>(std::sqrt(aValue));
+		}
+	}
+
+	template<typename T>
+	constexpr T Sin(T aValue)
+	{
+		if constexpr (!std::is_arithmetic_v<T>)
+		{
+			return T::Sin(aValue);
+		}
+		else
+		{
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<T>(Detail::SinConstexpr(static_cast<double>(aValue)));
+			}
+			return static_cast<T>(std::sin(aValue));
+		}
+	}
+
+	template<typename T>
+	constexpr T Cos(T aValue)
+	{
+		if constexpr (!std::is_arithmetic_v<T>)
+		{
+			return T::Cos(aValue);
+		}
+		else
+		{
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				return static_cast<T>(Detail::SinConstexpr(static_cast<double>(aValue) + Pi / 2.0));
+			}
+			return static_cast<T>(std::cos(aValue));
+		}
+	}
+
+	template<typename T>
+	constexpr T Tan(T aValue)
+	{
+		if constexpr (!std::is_arithmetic_v<T>)
+		{
+			return T::Tan(aValue);
+		}
+		else
+		{
+			if (OHM_IS_CONSTANT_EVALUATED())
+			{
+				const double value = static_cast<double>(aValue);
+				return static_cast<T>(Detail::SinConstexpr(value) / Detail::SinConstexpr(value + Pi / 2.0));
+			}
+			return static_cast<T>(std::tan(aValue));
+		}
+	}
+
+	// aA * aB + aC with a single rounding when the target has FMA, otherwise a plain multiply and add.
+	template<typename T>
+	OHM_FORCE_INLINE constexpr T MultiplyAdd(T aA, T aB, T aC)
+	{
+#if defined(OHM_SIMD_FMA)
+		// The intrinsics stay inline in Debug builds where std::fma is a library call.
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!OHM_IS_CONSTANT_EVALUATED())
+			{
+				return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(aA), _mm_set_ss(aB), _mm_set_ss(aC)));
+			}
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			if (!OHM_IS_CONSTANT_EVALUATED())
+			{
+				return _mm_cvtsd_f64(_mm_fmadd_sd(_mm_set_sd(aA), _mm_set_sd(aB), _mm_set_sd(aC)));
+			}
+		}
+#endif
+		return aA * aB + aC;
+	}
+}
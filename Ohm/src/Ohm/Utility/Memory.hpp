@@ -0,0 +1,466 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Aligned heap memory for SIMD friendly arrays.
+// Every block Ohm allocates for its containers (SoA streams, AlignedArray, FrameArena) goes through AllocateAligned,
+// which keeps process wide counters so steady state code can be checked for heap allocations.
+namespace Ohm::Memory
+{
+	struct AllocationStats
+	{
+		uint64_t allocationCount = 0;
+		uint64_t freeCount = 0;
+		uint64_t bytesAllocated = 0;
+		size_t bytesInUse = 0;
+		size_t peakBytesInUse = 0;
+	};
+
+	namespace Detail
+	{
+		struct AllocationCounters
+		{
+			std::atomic<uint64_t> allocationCount{ 0 };
+			std::atomic<uint64_t> freeCount{ 0 };
+			std::atomic<uint64_t> bytesAllocated{ 0 };
+			std::atomic<size_t> bytesInUse{ 0 };
+			std::atomic<size_t> peakBytesInUse{ 0 };
+		};
+
+		inline AllocationCounters ourCounters;
+	}
+
+	// Counters are updated with relaxed atomics, a snapshot taken while other threads allocate may be slightly inconsistent.
+	inline AllocationStats GetAllocationStats()
+	{
+		const Detail::AllocationCounters& counters = Detail::ourCounters;
+
+		AllocationStats stats;
+		stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+		stats.freeCount = counters.freeCount.load(std::memory_order_relaxed);
+		stats.bytesAllocated = counters.bytesAllocated.load(std::memory_order_relaxed);
+		stats.bytesInUse = counters.bytesInUse.load(std::memory_order_relaxed);
+		stats.peakBytesInUse = counters.peakBytesInUse.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	// Restarts the totals and the peak, the bytes in use are kept since those blocks are still alive.
+	inline void ResetAllocationStats()
+	{
+		Detail::AllocationCounters& counters = Detail::ourCounters;
+		counters.allocationCount.store(0, std::memory_order_relaxed);
+		counters.freeCount.store(0, std::memory_order_relaxed);
+		counters.bytesAllocated.store(0, std::memory_order_relaxed);
+		counters.peakBytesInUse.store(counters.bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	}
+
+	// aAlignment must be a power of two. Blocks have to be freed with the same size and alignment.
+	inline void* AllocateAligned(size_t aSize, size_t aAlignment = Ohm::Simd::Alignment)
+	{
+		assert(aAlignment > 0 && (aAlignment & (aAlignment - 1)) == 0 && "Alignment must be a power of two!");
+		void* pointer = ::operator new(aSize, std::align_val_t(aAlignment));
+
+		Detail::AllocationCounters& counters = Detail::ourCounters;
+		counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+		counters.bytesAllocated.fetch_add(aSize, std::memory_order_relaxed);
+		const size_t inUse = counters.bytesInUse.fetch_add(aSize, std::memory_order_relaxed) + aSize;
+		size_t peak = counters.peakBytesInUse.load(std::memory_order_relaxed);
+		while (inUse > peak && !counters.peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed))
+		{
+		}
+		return pointer;
+	}
+
+	inline void FreeAligned(void* aPointer, size_t aSize, size_t aAlignment = Ohm::Simd::Alignment)
+	{
+		if (!aPointer)
+		{
+			return;
+		}
+
+		::operator delete(aPointer, std::align_val_t(aAlignment));
+
+		Detail::AllocationCounters& counters = Detail::ourCounters;
+		counters.freeCount.fetch_add(1, std::memory_order_relaxed);
+		counters.bytesInUse.fetch_sub(aSize, std::memory_order_relaxed);
+	}
+
+	constexpr size_t AlignUp(size_t aValue, size_t aAlignment)
+	{
+		return (aValue + aAlignment - 1) & ~(aAlignment - 1);
+	}
+}
+
+// Standard allocator on top of Ohm::Memory::AllocateAligned, e.g. std::vector<Vector4<float>, AlignedAllocator<Vector4<float>>>.
+template<typename T, size_t Alignment = Ohm::Simd::Alignment>
+class AlignedAllocator
+{
+public:
+	static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two!");
+
+	using value_type = T;
+
+	template<typename U>
+	struct rebind
+	{
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	AlignedAllocator() = default;
+
+	template<typename U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+	{
+	}
+
+	T* allocate(size_t aCount)
+	{
+		return static_cast<T*>(Ohm::Memory::AllocateAligned(aCount * sizeof(T), BlockAlignment));
+	}
+
+	void deallocate(T* aPointer, size_t aCount) noexcept
+	{
+		Ohm::Memory::FreeAligned(aPointer, aCount * sizeof(T), BlockAlignment);
+	}
+
+	template<typename U>
+	bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept { return false; }
+
+private:
+	static constexpr size_t BlockAlignment = Alignment > alignof(T) ? Alignment : alignof(T);
+};
+
+// Bump allocator for per-frame scratch memory. Allocations are never freed individually, Reset() releases all of them at once.
+// Requests that do not fit go to separate overflow blocks, the next Reset() replaces those and the main block with one block
+// large enough for the whole frame. After the first frames of a steady workload the arena no longer touches the heap.
+// Not thread safe, use one arena per thread.
+class FrameArena
+{
+public:
+	explicit FrameArena(size_t aCapacity = 0);
+	~FrameArena();
+
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	// aAlignment must be a power of two, at most Ohm::Simd::Alignment. The memory is uninitialized.
+	void* Allocate(size_t aSize, size_t aAlignment = Ohm::Simd::Alignment);
+
+	// Room for aCount elements, padded to whole cache lines so SIMD kernels can run over the padding.
+	template<typename T>
+	T* Allocate(size_t aCount);
+
+	// Invalidates everything allocated since the last Reset().
+	void Reset();
+
+	// Bytes handed out this frame, including padding and overflow blocks.
+	size_t GetUsed() const { return myUsed + myOverflowBytes; }
+	size_t GetCapacity() const { return myCapacity; }
+	// Largest GetUsed() seen at any point since construction.
+	size_t GetPeak() const { return myPeak; }
+	// Overflow blocks allocated since construction, zero in steady state once the arena has grown.
+	uint64_t GetOverflowCount() const { return myOverflowCount; }
+
+private:
+	struct Overflow
+	{
+		Overflow* next;
+		size_t size;
+	};
+
+	static constexpr size_t OverflowHeader = Ohm::Memory::AlignUp(sizeof(Overflow), Ohm::Simd::Alignment);
+
+	void* AllocateOverflow(size_t aSize);
+	void ReleaseOverflow();
+
+	char* myBlock = nullptr;
+	size_t myCapacity = 0;
+	size_t myUsed = 0;
+	size_t myPeak = 0;
+
+	Overflow* myOverflow = nullptr;
+	size_t myOverflowBytes = 0;
+	uint64_t myOverflowCount = 0;
+};
+
+inline FrameArena::FrameArena(size_t aCapacity)
+{
+	if (aCapacity > 0)
+	{
+		myCapacity = Ohm::Memory::AlignUp(aCapacity, Ohm::Simd::Alignment);
+		myBlock = static_cast<char*>(Ohm::Memory::AllocateAligned(myCapacity));
+	}
+}
+
+inline FrameArena::~FrameArena()
+{
+	ReleaseOverflow();
+	Ohm::Memory::FreeAligned(myBlock, myCapacity);
+}
+
+inline void* FrameArena::Allocate(size_t aSize, size_t aAlignment)
+{
+	assert(aAlignment > 0 && aAlignment <= Ohm::Simd::Alignment && (aAlignment & (aAlignment - 1)) == 0 && "Unsupported alignment!");
+
+	void* pointer = nullptr;
+	const size_t begin = Ohm::Memory::AlignUp(myUsed, aAlignment);
+	if (begin + aSize <= myCapacity)
+	{
+		pointer = myBlock + begin;
+		myUsed = begin + aSize;
+	}
+	else
+	{
+		pointer = AllocateOverflow(aSize);
+	}
+
+	myPeak = std::max(myPeak, GetUsed());
+	return pointer;
+}
+
+template<typename T>
+inline T* FrameArena::Allocate(size_t aCount)
+{
+	static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "Arena memory is never destructed!");
+	static_assert(alignof(T) <= Ohm::Simd::Alignment, "Unsupported alignment!");
+
+	return static_cast<T*>(Allocate(Ohm::Simd::PaddedCount<T>(aCount) * sizeof(T), Ohm::Simd::Alignment));
+}
+
+inline void FrameArena::Reset()
+{
+	if (myOverflow)
+	{
+		// Grow to the whole frame in one block, so the same workload fits without overflow next time.
+		const size_t capacity = Ohm::Memory::AlignUp(myPeak, Ohm::Simd::Alignment);
+		ReleaseOverflow();
+		Ohm::Memory::FreeAligned(myBlock, myCapacity);
+		myBlock = static_cast<char*>(Ohm::Memory::AllocateAligned(capacity));
+		myCapacity = capacity;
+	}
+
+	myUsed = 0;
+}
+
+inline void* FrameArena::AllocateOverflow(size_t aSize)
+{
+	const size_t size = OverflowHeader + Ohm::Memory::AlignUp(aSize, Ohm::Simd::Alignment);
+	char* block = static_cast<char*>(Ohm::Memory::AllocateAligned(size));
+
+	// The list lives in the blocks themselves, so tracking them does not allocate.
+	Overflow* overflow = reinterpret_cast<Overflow*>(block);
+	overflow->next = myOverflow;
+	overflow->size = size;
+	myOverflow = overflow;
+
+	myOverflowBytes += size - OverflowHeader;
+	myOverflowCount++;
+	return block + OverflowHeader;
+}
+
+inline void FrameArena::ReleaseOverflow()
+{
+	while (myOverflow)
+	{
+		Overflow* next = myOverflow->next;
+		Ohm::Memory::FreeAligned(myOverflow, myOverflow->size);
+		myOverflow = next;
+	}
+	myOverflowBytes = 0;
+}
+
+// Contiguous array of trivially copyable T, Ohm::Simd::Alignment aligned and padded to whole cache lines like the SoA
+// containers, so batch kernels can use it directly for outputs and temporaries. Storage is zeroed when allocated.
+// Arrays constructed with a FrameArena take their storage from it (growing allocates again from the arena) and must not
+// be used after the arena is reset. Copies always own heap storage.
+template<typename T>
+class AlignedArray
+{
+public:
+	static_assert(std::is_trivially_copyable_v<T>, "AlignedArray copies its elements as bytes!");
+
+	AlignedArray<T>() = default;
+	explicit AlignedArray<T>(size_t aSize);
+	AlignedArray<T>(const T* aData, size_t aCount);
+	AlignedArray<T>(size_t aSize, FrameArena& aArena);
+
+	AlignedArray<T>(const AlignedArray<T>& aOther);
+	AlignedArray<T>(AlignedArray<T>&& aOther) noexcept;
+	AlignedArray<T>& operator=(AlignedArray<T> aOther);
+	~AlignedArray<T>();
+
+	T& operator[](size_t aIndex);
+	const T& operator[](size_t aIndex) const;
+
+	// New elements are value initialized. Only growing past Capacity() reallocates.
+	void Resize(size_t aSize);
+	void Reserve(size_t aCapacity);
+	void PushBack(const T& aValue);
+	void Clear() { mySize = 0; }
+
+	size_t Size() const { return mySize; }
+	size_t Capacity() const { return myCapacity; }
+	size_t PaddedSize() const { return Ohm::Simd::PaddedCount<T>(mySize); }
+	bool Empty() const { return mySize == 0; }
+
+	T* Data() { return myData; }
+	const T* Data() const { return myData; }
+	T* begin() { return myData; }
+	T* end() { return myData + mySize; }
+	const T* begin() const { return myData; }
+	const T* end() const { return myData + mySize; }
+
+private:
+	void Reallocate(size_t aCapacity);
+	void Release();
+
+	T* myData = nullptr;
+	size_t mySize = 0;
+	size_t myCapacity = 0;
+	FrameArena* myArena = nullptr;
+};
+
+template<typename T>
+inline AlignedArray<T>::AlignedArray(size_t aSize)
+{
+	Resize(aSize);
+}
+
+template<typename T>
+inline AlignedArray<T>::AlignedArray(const T* aData, size_t aCount)
+{
+	Reallocate(Ohm::Simd::PaddedCount<T>(aCount));
+	std::copy(aData, aData + aCount, myData);
+	mySize = aCount;
+}
+
+template<typename T>
+inline AlignedArray<T>::AlignedArray(size_t aSize, FrameArena& aArena)
+	: myArena(&aArena)
+{
+	Resize(aSize);
+}
+
+template<typename T>
+inline AlignedArray<T>::AlignedArray(const AlignedArray<T>& aOther)
+	: AlignedArray<T>(aOther.myData, aOther.mySize)
+{
+}
+
+template<typename T>
+inline AlignedArray<T>::AlignedArray(AlignedArray<T>&& aOther) noexcept
+	: myData(std::exchange(aOther.myData, nullptr)), mySize(std::exchange(aOther.mySize, 0)), myCapacity(std::exchange(aOther.myCapacity, 0)),
+	myArena(std::exchange(aOther.myArena, nullptr))
+{
+}
+
+template<typename T>
+inline AlignedArray<T>& AlignedArray<T>::operator=(AlignedArray<T> aOther)
+{
+	std::swap(myData, aOther.myData);
+	std::swap(mySize, aOther.mySize);
+	std::swap(myCapacity, aOther.myCapacity);
+	std::swap(myArena, aOther.myArena);
+
+	return *this;
+}
+
+template<typename T>
+inline AlignedArray<T>::~AlignedArray()
+{
+	Release();
+}
+
+template<typename T>
+inline T& AlignedArray<T>::operator[](size_t aIndex)
+{
+	assert(aIndex < mySize && "Index out of bounds!");
+	return myData[aIndex];
+}
+
+template<typename T>
+inline const T& AlignedArray<T>::operator[](size_t aIndex) const
+{
+	assert(aIndex < mySize && "Index out of bounds!");
+	return myData[aIndex];
+}
+
+template<typename T>
+inline void AlignedArray<T>::Resize(size_t aSize)
+{
+	Reserve(aSize);
+	if (aSize > mySize)
+	{
+		std::fill(myData + mySize, myData + aSize, T{});
+	}
+	mySize = aSize;
+}
+
+template<typename T>
+inline void AlignedArray<T>::Reserve(size_t aCapacity)
+{
+	if (aCapacity > myCapacity)
+	{
+		// Geometric growth keeps PushBack amortized constant.
+		Reallocate(Ohm::Simd::PaddedCount<T>(std::max(aCapacity, myCapacity + myCapacity / 2)));
+	}
+}
+
+template<typename T>
+inline void AlignedArray<T>::PushBack(const T& aValue)
+{
+	if (mySize == myCapacity)
+	{
+		// aValue may point into the array, so it is copied before the storage moves.
+		const T value = aValue;
+		Reserve(mySize + 1);
+		myData[mySize++] = value;
+	}
+	else
+	{
+		myData[mySize++] = aValue;
+	}
+}
+
+template<typename T>
+inline void AlignedArray<T>::Reallocate(size_t aCapacity)
+{
+	T* data = myArena ? myArena->Allocate<T>(aCapacity) : static_cast<T*>(Ohm::Memory::AllocateAligned(aCapacity * sizeof(T)));
+	if (mySize > 0)
+	{
+		std::memcpy(static_cast<void*>(data), myData, mySize * sizeof(T));
+	}
+	std::memset(static_cast<void*>(data + mySize), 0, (aCapacity - mySize) * sizeof(T));
+
+	FrameArena* arena = myArena;
+	const size_t size = mySize;
+	Release();
+	myData = data;
+	mySize = size;
+	myCapacity = aCapacity;
+	myArena = arena;
+}
+
+template<typename T>
+inline void AlignedArray<T>::Release()
+{
+	if (!myArena)
+	{
+		Ohm::Memory::FreeAligned(myData, myCapacity * sizeof(T));
+	}
+
+	myData = nullptr;
+	mySize = myCapacity = 0;
+}
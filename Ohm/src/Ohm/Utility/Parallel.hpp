@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace Ohm::Detail
+{
+	// The worker threads and queues, defined in Ohm/Utility/ThreadPool.hpp.
+	class ThreadPoolWorkers;
+}
+
+// Handle to a work stealing thread pool for the array level APIs that take a ThreadPool*.
+// This header is all the kernels need and pulls in no threading headers. Pools are created through
+// Ohm/Utility/ThreadPool.hpp, which holds the workers, so nothing runs on other threads unless that header is used.
+// ParallelFor splits [0, aCount) in halves down to aGrain elements, idle threads steal the largest ranges first.
+// Chunk boundaries are multiples of aGrain no matter which thread runs them, every element is written by exactly
+// one chunk and results therefore do not depend on the worker count or scheduling.
+// The calling thread works on its own ParallelFor while it waits, which also makes nested ParallelFor calls safe.
+// Chunks must not throw.
+class ThreadPool
+{
+public:
+	// aWorkerCount threads are started next to the threads calling ParallelFor. Workers is only a template parameter
+	// so that creating a pool without Ohm/Utility/ThreadPool.hpp fails to compile, leave it at the default.
+	template<typename Workers = Ohm::Detail::ThreadPoolWorkers>
+	explicit ThreadPool(size_t aWorkerCount = Workers::DefaultWorkerCount());
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	// One worker per hardware thread besides the caller.
+	template<typename Workers = Ohm::Detail::ThreadPoolWorkers>
+	static size_t DefaultWorkerCount() { return Workers::DefaultWorkerCount(); }
+
+	size_t GetWorkerCount() const { return myWorkerCount; }
+	// Workers plus the calling thread.
+	size_t GetThreadCount() const { return myWorkerCount + 1; }
+
+	// Runs aChunk(begin, end) over [0, aCount) in chunks of aGrain elements (the last one may be shorter) and
+	// returns once all of them are done.
+	template<typename F>
+	void ParallelFor(size_t aCount, size_t aGrain, F&& aChunk);
+
+private:
+	using ChunkFunction = void (*)(const void* aChunk, size_t aBegin, size_t aEnd);
+
+	Ohm::Detail::ThreadPoolWorkers* myWorkers = nullptr;
+	size_t myWorkerCount = 0;
+	void (*myRun)(Ohm::Detail::ThreadPoolWorkers& aWorkers, size_t aCount, size_t aGrain, ChunkFunction aRun, const void* aChunk) = nullptr;
+	void (*myDestroy)(Ohm::Detail::ThreadPoolWorkers* aWorkers) = nullptr;
+};
+
+template<typename Workers>
+inline ThreadPool::ThreadPool(size_t aWorkerCount)
+	: myWorkers(new Workers(aWorkerCount)), myWorkerCount(aWorkerCount), myRun(&Workers::Run), myDestroy(&Workers::Destroy)
+{
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	if (myWorkers)
+	{
+		myDestroy(myWorkers);
+	}
+}
+
+template<typename F>
+inline void ThreadPool::ParallelFor(size_t aCount, size_t aGrain, F&& aChunk)
+{
+	const size_t grain = aGrain > 0 ? aGrain : 1;
+	if (myWorkerCount == 0 || aCount <= grain)
+	{
+		if (aCount > 0)
+		{
+			aChunk(size_t(0), aCount);
+		}
+		return;
+	}
+
+	using Chunk = std::remove_reference_t<F>;
+	const ChunkFunction run = [](const void* aChunk, size_t aBegin, size_t aEnd) { (*static_cast<Chunk*>(const_cast<void*>(aChunk)))(aBegin, aEnd); };
+	myRun(*myWorkers, aCount, grain, run, &aChunk);
+}
+
+namespace Ohm::Detail
+{
+	// ParallelFor on aPool, or a single aChunk(0, aCount) call without one.
+	template<typename F>
+	inline void ParallelFor(ThreadPool* aPool, size_t aCount, size_t aGrain, F&& aChunk)
+	{
+		if (aPool)
+		{
+			aPool->ParallelFor(aCount, aGrain, aChunk);
+		}
+		else if (aCount > 0)
+		{
+			aChunk(size_t(0), aCount);
+		}
+	}
+
+	// Elements per chunk for kernels touching aBytesPerElement bytes per element, about 32 KB (L1 sized) per chunk.
+	// The grain is a multiple of 64 elements, which always ends on a cache line boundary of arrays and SoA streams,
+	// so chunks never share a line and SIMD kernels see the same pack boundaries as a single call.
+	constexpr size_t ParallelGrain(size_t aBytesPerElement)
+	{
+		constexpr size_t ChunkBytes = 32 * 1024;
+		constexpr size_t Step = 64;
+		const size_t elements = aBytesPerElement > 0 ? ChunkBytes / aBytesPerElement : ChunkBytes;
+		return elements > Step ? elements / Step * Step : Step;
+	}
+}
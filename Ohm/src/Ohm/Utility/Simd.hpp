@@ -0,0 +1,416 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Compile-time instruction set selection.
+// The OHM_SIMD_* defines follow the flags the translation unit is compiled with (-msse4.1, -mavx2, /arch:AVX2 ...).
+// Define OHM_NO_SIMD to force the scalar paths everywhere.
+#if !defined(OHM_NO_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define OHM_SIMD_SSE2
+	#endif
+
+	#if defined(__SSE4_1__) || defined(__AVX__)
+		#define OHM_SIMD_SSE4_1
+	#endif
+
+	#if defined(__AVX__)
+		#define OHM_SIMD_AVX
+	#endif
+
+	#if defined(__AVX2__)
+		#define OHM_SIMD_AVX2
+	#endif
+
+	#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+		#define OHM_SIMD_FMA
+	#endif
+
+	#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+		#define OHM_SIMD_F16C
+	#endif
+
+	#if defined(__AVX512F__)
+		#define OHM_SIMD_AVX512
+	#endif
+#endif
+
+#if defined(OHM_SIMD_SSE2)
+	#include <immintrin.h>
+#endif
+
+// Inlines even in unoptimized GCC/Clang builds, for small wrappers whose call overhead would dominate Debug builds.
+#if defined(_MSC_VER)
+	#define OHM_FORCE_INLINE __forceinline
+#else
+	#define OHM_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+namespace Ohm::Simd
+{
+	// Alignment used for SIMD friendly arrays, one cache line covers every register width up to AVX-512.
+	constexpr size_t Alignment = 64;
+
+	// Rounds aCount up to a whole number of cache lines worth of T.
+	template<typename T>
+	constexpr size_t PaddedCount(size_t aCount)
+	{
+		constexpr size_t perLine = Alignment / sizeof(T) > 0 ? Alignment / sizeof(T) : 1;
+		return (aCount + perLine - 1) / perLine * perLine;
+	}
+
+#if defined(OHM_SIMD_SSE2)
+	// Returns the four component dot product of aA and aB broadcast to all lanes.
+	inline __m128 Dot4(__m128 aA, __m128 aB)
+	{
+#if defined(OHM_SIMD_SSE4_1)
+		return _mm_dp_ps(aA, aB, 0xFF);
+#else
+		__m128 product = _mm_mul_ps(aA, aB);
+		product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 0, 3, 2)));
+#endif
+	}
+
+	// Returns aA * aB + aC, fused when FMA is available.
+	inline __m128 MultiplyAdd(__m128 aA, __m128 aB, __m128 aC)
+	{
+#if defined(OHM_SIMD_FMA)
+		return _mm_fmadd_ps(aA, aB, aC);
+#else
+		return _mm_add_ps(_mm_mul_ps(aA, aB), aC);
+#endif
+	}
+
+#if defined(OHM_SIMD_AVX)
+	inline __m256 MultiplyAdd(__m256 aA, __m256 aB, __m256 aC)
+	{
+#if defined(OHM_SIMD_FMA)
+		return _mm256_fmadd_ps(aA, aB, aC);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(aA, aB), aC);
+#endif
+	}
+#endif
+
+	// Loads four packed Vector3<float> (12 floats) and transposes them to x/y/z registers.
+	inline void LoadVector3x4(const float* aSource, __m128& aX, __m128& aY, __m128& aZ)
+	{
+		const __m128 a = _mm_loadu_ps(aSource + 0);
+		const __m128 b = _mm_loadu_ps(aSource + 4);
+		const __m128 c = _mm_loadu_ps(aSource + 8);
+
+		const __m128 bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+		aX = _mm_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+		aY = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), bc, _MM_SHUFFLE(3, 1, 2, 0));
+		aZ = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	// Transposes x/y/z registers back to four packed Vector3<float>.
+	inline void StoreVector3x4(float* aDestination, __m128 aX, __m128 aY, __m128 aZ)
+	{
+		const __m128 xyLow = _mm_unpacklo_ps(aX, aY);
+		const __m128 xyHigh = _mm_unpackhi_ps(aX, aY);
+		const __m128 yzLow = _mm_unpacklo_ps(aY, aZ);
+		const __m128 yzHigh = _mm_unpackhi_ps(aY, aZ);
+		const __m128 zxLow = _mm_unpacklo_ps(aZ, aX);
+		const __m128 zxHigh = _mm_unpackhi_ps(aZ, aX);
+
+		_mm_storeu_ps(aDestination + 0, _mm_shuffle_ps(xyLow, zxLow, _MM_SHUFFLE(3, 0, 1, 0)));
+		_mm_storeu_ps(aDestination + 4, _mm_shuffle_ps(yzLow, xyHigh, _MM_SHUFFLE(1, 0, 3, 2)));
+		_mm_storeu_ps(aDestination + 8, _mm_shuffle_ps(zxHigh, yzHigh, _MM_SHUFFLE(3, 2, 3, 0)));
+	}
+
+#if defined(OHM_SIMD_AVX)
+	inline void LoadVector3x8(const float* aSource, __m256& aX, __m256& aY, __m256& aZ)
+	{
+		// Points 0-3 go to the low lanes and points 4-7 to the high lanes, the in-lane shuffles then match the SSE version.
+		const __m256 a = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 0)), _mm_loadu_ps(aSource + 12), 1);
+		const __m256 b = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 4)), _mm_loadu_ps(aSource + 16), 1);
+		const __m256 c = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 8)), _mm_loadu_ps(aSource + 20), 1);
+
+		const __m256 bc = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+		aX = _mm256_shuffle_ps(a, bc, _MM_SHUFFLE(2, 0, 3, 0));
+		aY = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), bc, _MM_SHUFFLE(3, 1, 2, 0));
+		aZ = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+
+	inline void StoreVector3x8(float* aDestination, __m256 aX, __m256 aY, __m256 aZ)
+	{
+		const __m256 xyLow = _mm256_unpacklo_ps(aX, aY);
+		const __m256 xyHigh = _mm256_unpackhi_ps(aX, aY);
+		const __m256 yzLow = _mm256_unpacklo_ps(aY, aZ);
+		const __m256 yzHigh = _mm256_unpackhi_ps(aY, aZ);
+		const __m256 zxLow = _mm256_unpacklo_ps(aZ, aX);
+		const __m256 zxHigh = _mm256_unpackhi_ps(aZ, aX);
+
+		const __m256 a = _mm256_shuffle_ps(xyLow, zxLow, _MM_SHUFFLE(3, 0, 1, 0));
+		const __m256 b = _mm256_shuffle_ps(yzLow, xyHigh, _MM_SHUFFLE(1, 0, 3, 2));
+		const __m256 c = _mm256_shuffle_ps(zxHigh, yzHigh, _MM_SHUFFLE(3, 2, 3, 0));
+
+		_mm_storeu_ps(aDestination + 0, _mm256_castps256_ps128(a));
+		_mm_storeu_ps(aDestination + 4, _mm256_castps256_ps128(b));
+		_mm_storeu_ps(aDestination + 8, _mm256_castps256_ps128(c));
+		_mm_storeu_ps(aDestination + 12, _mm256_extractf128_ps(a, 1));
+		_mm_storeu_ps(aDestination + 16, _mm256_extractf128_ps(b, 1));
+		_mm_storeu_ps(aDestination + 20, _mm256_extractf128_ps(c, 1));
+	}
+#endif
+
+	// Four floats per step, also used where the element count is fixed at four.
+	struct Float4Lane
+	{
+		using Type = __m128;
+		static constexpr size_t Width = 4;
+
+		static __m128 Load(const float* aSource) { return _mm_loadu_ps(aSource); }
+		static void Store(float* aDestination, __m128 aValue) { _mm_storeu_ps(aDestination, aValue); }
+		static __m128 Set(float aValue) { return _mm_set1_ps(aValue); }
+		static __m128 Add(__m128 aA, __m128 aB) { return _mm_add_ps(aA, aB); }
+		static __m128 Subtract(__m128 aA, __m128 aB) { return _mm_sub_ps(aA, aB); }
+		static __m128 Multiply(__m128 aA, __m128 aB) { return _mm_mul_ps(aA, aB); }
+		static __m128 Divide(__m128 aA, __m128 aB) { return _mm_div_ps(aA, aB); }
+		static __m128 Sqrt(__m128 aValue) { return _mm_sqrt_ps(aValue); }
+		static __m128 Min(__m128 aA, __m128 aB) { return _mm_min_ps(aA, aB); }
+		static __m128 Max(__m128 aA, __m128 aB) { return _mm_max_ps(aA, aB); }
+		static __m128 Abs(__m128 aValue) { return _mm_andnot_ps(_mm_set1_ps(-0.f), aValue); }
+		static __m128 FlipSign(__m128 aValue, __m128 aSign) { return _mm_xor_ps(aValue, _mm_and_ps(aSign, _mm_set1_ps(-0.f))); }
+		static unsigned NonNegativeMask(__m128 aValue) { return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpge_ps(aValue, _mm_setzero_ps()))); }
+		static __m128 SelectNonNegative(__m128 aCondition, __m128 aA, __m128 aB)
+		{
+			const __m128 mask = _mm_cmpge_ps(aCondition, _mm_setzero_ps());
+			return _mm_or_ps(_mm_and_ps(mask, aA), _mm_andnot_ps(mask, aB));
+		}
+
+		// Loads four 4 component elements aStride floats apart and transposes them to one register per component.
+		static void LoadTransposed4(const float* aSource, __m128& aX, __m128& aY, __m128& aZ, __m128& aW, size_t aStride = 4)
+		{
+			aX = _mm_loadu_ps(aSource + 0 * aStride);
+			aY = _mm_loadu_ps(aSource + 1 * aStride);
+			aZ = _mm_loadu_ps(aSource + 2 * aStride);
+			aW = _mm_loadu_ps(aSource + 3 * aStride);
+			_MM_TRANSPOSE4_PS(aX, aY, aZ, aW);
+		}
+
+		static void StoreTransposed4(float* aDestination, __m128 aX, __m128 aY, __m128 aZ, __m128 aW, size_t aStride = 4)
+		{
+			_MM_TRANSPOSE4_PS(aX, aY, aZ, aW);
+			_mm_storeu_ps(aDestination + 0 * aStride, aX);
+			_mm_storeu_ps(aDestination + 1 * aStride, aY);
+			_mm_storeu_ps(aDestination + 2 * aStride, aZ);
+			_mm_storeu_ps(aDestination + 3 * aStride, aW);
+		}
+
+		// Packed Vector3<float> data.
+		static void LoadTransposed3(const float* aSource, __m128& aX, __m128& aY, __m128& aZ) { LoadVector3x4(aSource, aX, aY, aZ); }
+		static void StoreTransposed3(float* aDestination, __m128 aX, __m128 aY, __m128 aZ) { StoreVector3x4(aDestination, aX, aY, aZ); }
+		static __m128 MultiplyAdd(__m128 aA, __m128 aB, __m128 aC) { return Ohm::Simd::MultiplyAdd(aA, aB, aC); }
+	};
+
+#if defined(OHM_SIMD_AVX)
+	struct Float8Lane
+	{
+		using Type = __m256;
+		static constexpr size_t Width = 8;
+
+		static __m256 Load(const float* aSource) { return _mm256_loadu_ps(aSource); }
+		static void Store(float* aDestination, __m256 aValue) { _mm256_storeu_ps(aDestination, aValue); }
+		static __m256 Set(float aValue) { return _mm256_set1_ps(aValue); }
+		static __m256 Add(__m256 aA, __m256 aB) { return _mm256_add_ps(aA, aB); }
+		static __m256 Subtract(__m256 aA, __m256 aB) { return _mm256_sub_ps(aA, aB); }
+		static __m256 Multiply(__m256 aA, __m256 aB) { return _mm256_mul_ps(aA, aB); }
+		static __m256 Divide(__m256 aA, __m256 aB) { return _mm256_div_ps(aA, aB); }
+		static __m256 Sqrt(__m256 aValue) { return _mm256_sqrt_ps(aValue); }
+		static __m256 Min(__m256 aA, __m256 aB) { return _mm256_min_ps(aA, aB); }
+		static __m256 Max(__m256 aA, __m256 aB) { return _mm256_max_ps(aA, aB); }
+		static __m256 Abs(__m256 aValue) { return _mm256_andnot_ps(_mm256_set1_ps(-0.f), aValue); }
+		static __m256 FlipSign(__m256 aValue, __m256 aSign) { return _mm256_xor_ps(aValue, _mm256_and_ps(aSign, _mm256_set1_ps(-0.f))); }
+		static unsigned NonNegativeMask(__m256 aValue) { return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(aValue, _mm256_setzero_ps(), _CMP_GE_OQ))); }
+		static __m256 SelectNonNegative(__m256 aCondition, __m256 aA, __m256 aB) { return _mm256_blendv_ps(aB, aA, _mm256_cmp_ps(aCondition, _mm256_setzero_ps(), _CMP_GE_OQ)); }
+
+		// Loads eight 4 component elements aStride floats apart and transposes them to one register per component.
+		static void LoadTransposed4(const float* aSource, __m256& aX, __m256& aY, __m256& aZ, __m256& aW, size_t aStride = 4)
+		{
+			aX = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 0 * aStride)), _mm_loadu_ps(aSource + 4 * aStride), 1);
+			aY = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 1 * aStride)), _mm_loadu_ps(aSource + 5 * aStride), 1);
+			aZ = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 2 * aStride)), _mm_loadu_ps(aSource + 6 * aStride), 1);
+			aW = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(aSource + 3 * aStride)), _mm_loadu_ps(aSource + 7 * aStride), 1);
+			Transpose(aX, aY, aZ, aW);
+		}
+
+		static void StoreTransposed4(float* aDestination, __m256 aX, __m256 aY, __m256 aZ, __m256 aW, size_t aStride = 4)
+		{
+			Transpose(aX, aY, aZ, aW);
+			_mm_storeu_ps(aDestination + 0 * aStride, _mm256_castps256_ps128(aX));
+			_mm_storeu_ps(aDestination + 1 * aStride, _mm256_castps256_ps128(aY));
+			_mm_storeu_ps(aDestination + 2 * aStride, _mm256_castps256_ps128(aZ));
+			_mm_storeu_ps(aDestination + 3 * aStride, _mm256_castps256_ps128(aW));
+			_mm_storeu_ps(aDestination + 4 * aStride, _mm256_extractf128_ps(aX, 1));
+			_mm_storeu_ps(aDestination + 5 * aStride, _mm256_extractf128_ps(aY, 1));
+			_mm_storeu_ps(aDestination + 6 * aStride, _mm256_extractf128_ps(aZ, 1));
+			_mm_storeu_ps(aDestination + 7 * aStride, _mm256_extractf128_ps(aW, 1));
+		}
+
+		// Packed Vector3<float> data.
+		static void LoadTransposed3(const float* aSource, __m256& aX, __m256& aY, __m256& aZ) { LoadVector3x8(aSource, aX, aY, aZ); }
+		static void StoreTransposed3(float* aDestination, __m256 aX, __m256 aY, __m256 aZ) { StoreVector3x8(aDestination, aX, aY, aZ); }
+
+		// 4x4 transpose within each 128 bit lane.
+		static void Transpose(__m256& aRow0, __m256& aRow1, __m256& aRow2, __m256& aRow3)
+		{
+			const __m256 t0 = _mm256_unpacklo_ps(aRow0, aRow1);
+			const __m256 t1 = _mm256_unpacklo_ps(aRow2, aRow3);
+			const __m256 t2 = _mm256_unpackhi_ps(aRow0, aRow1);
+			const __m256 t3 = _mm256_unpackhi_ps(aRow2, aRow3);
+			aRow0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+			aRow1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+			aRow2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+			aRow3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+		static __m256 MultiplyAdd(__m256 aA, __m256 aB, __m256 aC) { return Ohm::Simd::MultiplyAdd(aA, aB, aC); }
+	};
+#endif
+
+	// Widest float register the translation unit is compiled for, used by the array kernels.
+#if defined(OHM_SIMD_AVX)
+	using FloatPackLane = Float8Lane;
+#else
+	using FloatPackLane = Float4Lane;
+#endif
+	using FloatPack = FloatPackLane::Type;
+	constexpr size_t FloatPackWidth = FloatPackLane::Width;
+#endif
+
+	// Scalar stand-in for FloatPackLane so array kernels can be written once for both paths.
+	template<typename T>
+	struct ScalarLane
+	{
+		using Type = T;
+		static constexpr size_t Width = 1;
+
+		static T Load(const T* aSource) { return *aSource; }
+		static void Store(T* aDestination, T aValue) { *aDestination = aValue; }
+		static T Set(T aValue) { return aValue; }
+		static T Add(T aA, T aB) { return aA + aB; }
+		static T Subtract(T aA, T aB) { return aA - aB; }
+		static T Multiply(T aA, T aB) { return aA * aB; }
+		static T Divide(T aA, T aB) { return aA / aB; }
+		static T Sqrt(T aValue) { return static_cast<T>(std::sqrt(aValue)); }
+		static T Min(T aA, T aB) { return aB < aA ? aB : aA; }
+		static T Max(T aA, T aB) { return aA < aB ? aB : aA; }
+		static T MultiplyAdd(T aA, T aB, T aC) { return aA * aB + aC; }
+		static T Abs(T aValue) { return aValue < static_cast<T>(0) ? -aValue : aValue; }
+		static T FlipSign(T aValue, T aSign) { return aSign < static_cast<T>(0) ? -aValue : aValue; }
+		// Bit per lane, set where the value is >= 0. False for NaN.
+		static unsigned NonNegativeMask(T aValue) { return aValue >= static_cast<T>(0) ? 1u : 0u; }
+		// aA where aCondition >= 0, aB elsewhere and for NaN.
+		static T SelectNonNegative(T aCondition, T aA, T aB) { return aCondition >= static_cast<T>(0) ? aA : aB; }
+
+		static void LoadTransposed4(const T* aSource, T& aX, T& aY, T& aZ, T& aW, size_t = 4)
+		{
+			aX = aSource[0];
+			aY = aSource[1];
+			aZ = aSource[2];
+			aW = aSource[3];
+		}
+
+		static void StoreTransposed4(T* aDestination, T aX, T aY, T aZ, T aW, size_t = 4)
+		{
+			aDestination[0] = aX;
+			aDestination[1] = aY;
+			aDestination[2] = aZ;
+			aDestination[3] = aW;
+		}
+
+		static void LoadTransposed3(const T* aSource, T& aX, T& aY, T& aZ)
+		{
+			aX = aSource[0];
+			aY = aSource[1];
+			aZ = aSource[2];
+		}
+
+		static void StoreTransposed3(T* aDestination, T aX, T aY, T aZ)
+		{
+			aDestination[0] = aX;
+			aDestination[1] = aY;
+			aDestination[2] = aZ;
+		}
+	};
+
+	// Lane for kernels over a fixed group of four elements, such as the slots of a 4 wide tree node:
+	// one Float4Lane step for float, four ScalarLane steps for everything else.
+	template<typename T>
+	struct FourWideLane
+	{
+		using Type = ScalarLane<T>;
+	};
+
+#if defined(OHM_SIMD_SSE2)
+	template<>
+	struct FourWideLane<float>
+	{
+		using Type = Float4Lane;
+	};
+#endif
+
+	// Calls aKernel(lane, index) over [0, aCount). For float, full FloatPackLane steps run first
+	// and the remainder goes through ScalarLane, every other T only uses ScalarLane.
+	template<typename T, typename F>
+	inline void ForEachLane(size_t aCount, F&& aKernel)
+	{
+		size_t i = 0;
+#if defined(OHM_SIMD_SSE2)
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (; i + FloatPackWidth <= aCount; i += FloatPackWidth)
+			{
+				aKernel(FloatPackLane{}, i);
+			}
+		}
+#endif
+		for (; i < aCount; i++)
+		{
+			aKernel(ScalarLane<T>{}, i);
+		}
+	}
+
+	// Three component dot and cross products of packs held as x/y/z arrays, for kernels written against the lane interface.
+	template<typename Lane, typename Pack>
+	inline Pack LaneDot(const Pack aA[3], const Pack aB[3])
+	{
+		return Lane::MultiplyAdd(aA[2], aB[2], Lane::MultiplyAdd(aA[1], aB[1], Lane::Multiply(aA[0], aB[0])));
+	}
+
+	template<typename Lane, typename Pack>
+	inline void LaneCross(const Pack aA[3], const Pack aB[3], Pack aOut[3])
+	{
+		aOut[0] = Lane::Subtract(Lane::Multiply(aA[1], aB[2]), Lane::Multiply(aA[2], aB[1]));
+		aOut[1] = Lane::Subtract(Lane::Multiply(aA[2], aB[0]), Lane::Multiply(aA[0], aB[2]));
+		aOut[2] = Lane::Subtract(Lane::Multiply(aA[0], aB[1]), Lane::Multiply(aA[1], aB[0]));
+	}
+
+	// Number of uint64_t words holding one bit per element.
+	constexpr size_t MaskWordCount(size_t aCount)
+	{
+		return (aCount + 63) / 64;
+	}
+
+	// ForEachLane for kernels that return one bit per lane (NonNegativeMask), the bits are gathered into
+	// aOutMask with bit i % 64 of word i / 64 belonging to element i. Unused bits of the last word are cleared.
+	// Pack widths divide 64, so a step never straddles two words.
+	template<typename T, typename F>
+	inline void ForEachLaneMask(size_t aCount, uint64_t* aOutMask, F&& aKernel)
+	{
+		std::fill(aOutMask, aOutMask + MaskWordCount(aCount), uint64_t(0));
+
+		ForEachLane<T>(aCount, [&](auto aLane, size_t i)
+		{
+			const uint64_t bits = aKernel(aLane, i);
+			aOutMask[i / 64] |= bits << (i % 64);
+		});
+	}
+}
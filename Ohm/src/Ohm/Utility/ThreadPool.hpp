@@ -0,0 +1,262 @@
+#pragma once
+
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The threads behind a ThreadPool. Include this header wherever pools are created, the kernels only need Parallel.hpp.
+namespace Ohm::Detail
+{
+	class ThreadPoolWorkers
+	{
+	public:
+		using ChunkFunction = void (*)(const void* aChunk, size_t aBegin, size_t aEnd);
+
+		explicit ThreadPoolWorkers(size_t aWorkerCount);
+		~ThreadPoolWorkers();
+
+		ThreadPoolWorkers(const ThreadPoolWorkers&) = delete;
+		ThreadPoolWorkers& operator=(const ThreadPoolWorkers&) = delete;
+
+		static size_t DefaultWorkerCount();
+
+		// Entry points stored in ThreadPool.
+		static void Run(ThreadPoolWorkers& aWorkers, size_t aCount, size_t aGrain, ChunkFunction aRun, const void* aChunk);
+		static void Destroy(ThreadPoolWorkers* aWorkers) { delete aWorkers; }
+
+	private:
+		struct Job
+		{
+			ChunkFunction run = nullptr;
+			const void* chunk = nullptr;
+			size_t grain = 1;
+			std::atomic<size_t> remaining{ 0 };
+		};
+
+		struct Task
+		{
+			Job* job = nullptr;
+			size_t begin = 0;
+			size_t end = 0;
+		};
+
+		// The owner pushes and pops at the back, thieves take from the front. Storage is only reset once the queue
+		// runs empty, so steady state use does not allocate.
+		struct alignas(Ohm::Simd::Alignment) Queue
+		{
+			std::mutex mutex;
+			std::vector<Task> tasks;
+			size_t front = 0;
+		};
+
+		void WorkerLoop(size_t aIndex);
+		size_t GetQueueIndex() const;
+		void Push(size_t aQueue, const Task& aTask);
+		bool Pop(size_t aQueue, Task& aOutTask);
+		bool Steal(size_t aQueue, Task& aOutTask);
+		bool FindTask(size_t aQueue, Task& aOutTask);
+		void Execute(size_t aQueue, Task aTask);
+
+		// The workers and queue of the thread running this, external threads share the last queue.
+		inline static thread_local const ThreadPoolWorkers* ourCurrentWorkers = nullptr;
+		inline static thread_local size_t ourCurrentQueue = 0;
+
+		std::vector<std::thread> myThreads;
+		std::vector<Queue> myQueues;
+
+		// Sleeping workers are woken whenever tasks are queued, myQueuedCount and mySleepingCount are checked in
+		// opposite orders by pushers and sleepers, so a push never goes unnoticed.
+		std::atomic<size_t> myQueuedCount{ 0 };
+		std::atomic<size_t> mySleepingCount{ 0 };
+		std::atomic<bool> myStopping{ false };
+		std::mutex mySleepMutex;
+		std::condition_variable mySleepCondition;
+	};
+
+	inline ThreadPoolWorkers::ThreadPoolWorkers(size_t aWorkerCount)
+		: myQueues(aWorkerCount + 1)
+	{
+		myThreads.reserve(aWorkerCount);
+		for (size_t i = 0; i < aWorkerCount; i++)
+		{
+			myThreads.emplace_back([this, i]() { WorkerLoop(i); });
+		}
+	}
+
+	inline ThreadPoolWorkers::~ThreadPoolWorkers()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mySleepMutex);
+			myStopping = true;
+		}
+		mySleepCondition.notify_all();
+
+		for (std::thread& thread : myThreads)
+		{
+			thread.join();
+		}
+	}
+
+	inline size_t ThreadPoolWorkers::DefaultWorkerCount()
+	{
+		const size_t hardwareThreads = std::thread::hardware_concurrency();
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+
+	inline void ThreadPoolWorkers::Run(ThreadPoolWorkers& aWorkers, size_t aCount, size_t aGrain, ChunkFunction aRun, const void* aChunk)
+	{
+		Job job;
+		job.run = aRun;
+		job.chunk = aChunk;
+		job.grain = aGrain;
+		job.remaining = aCount;
+
+		const size_t queue = aWorkers.GetQueueIndex();
+		aWorkers.Execute(queue, Task{ &job, 0, aCount });
+
+		// Help with whatever is queued until the last chunk of this job is done, possibly on another thread.
+		Task task;
+		while (job.remaining.load(std::memory_order_acquire) != 0)
+		{
+			if (aWorkers.FindTask(queue, task))
+			{
+				aWorkers.Execute(queue, task);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	inline void ThreadPoolWorkers::WorkerLoop(size_t aIndex)
+	{
+		ourCurrentWorkers = this;
+		ourCurrentQueue = aIndex;
+
+		Task task;
+		while (true)
+		{
+			if (FindTask(aIndex, task))
+			{
+				Execute(aIndex, task);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mySleepMutex);
+			mySleepingCount.fetch_add(1);
+			mySleepCondition.wait(lock, [this]() { return myStopping || myQueuedCount.load() > 0; });
+			mySleepingCount.fetch_sub(1);
+			if (myStopping && myQueuedCount.load() == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	inline size_t ThreadPoolWorkers::GetQueueIndex() const
+	{
+		return ourCurrentWorkers == this ? ourCurrentQueue : myThreads.size();
+	}
+
+	inline void ThreadPoolWorkers::Push(size_t aQueue, const Task& aTask)
+	{
+		{
+			std::lock_guard<std::mutex> lock(myQueues[aQueue].mutex);
+			myQueues[aQueue].tasks.push_back(aTask);
+			myQueuedCount.fetch_add(1);
+		}
+
+		if (mySleepingCount.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mySleepMutex);
+			}
+			mySleepCondition.notify_one();
+		}
+	}
+
+	inline bool ThreadPoolWorkers::Pop(size_t aQueue, Task& aOutTask)
+	{
+		Queue& queue = myQueues[aQueue];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.front == queue.tasks.size())
+		{
+			return false;
+		}
+
+		aOutTask = queue.tasks.back();
+		queue.tasks.pop_back();
+		if (queue.front == queue.tasks.size())
+		{
+			queue.tasks.clear();
+			queue.front = 0;
+		}
+		myQueuedCount.fetch_sub(1);
+		return true;
+	}
+
+	inline bool ThreadPoolWorkers::Steal(size_t aQueue, Task& aOutTask)
+	{
+		Queue& queue = myQueues[aQueue];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.front == queue.tasks.size())
+		{
+			return false;
+		}
+
+		aOutTask = queue.tasks[queue.front++];
+		if (queue.front == queue.tasks.size())
+		{
+			queue.tasks.clear();
+			queue.front = 0;
+		}
+		myQueuedCount.fetch_sub(1);
+		return true;
+	}
+
+	inline bool ThreadPoolWorkers::FindTask(size_t aQueue, Task& aOutTask)
+	{
+		if (myQueuedCount.load(std::memory_order_relaxed) == 0)
+		{
+			return false;
+		}
+		if (Pop(aQueue, aOutTask))
+		{
+			return true;
+		}
+
+		// Victims in a fixed order starting after the own queue, which spreads thieves over the queues.
+		for (size_t i = 1; i < myQueues.size(); i++)
+		{
+			if (Steal((aQueue + i) % myQueues.size(), aOutTask))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	inline void ThreadPoolWorkers::Execute(size_t aQueue, Task aTask)
+	{
+		Job& job = *aTask.job;
+
+		// Keep the lower half and offer the upper one, split points stay on multiples of the grain.
+		while (aTask.end - aTask.begin > job.grain)
+		{
+			const size_t chunkCount = (aTask.end - aTask.begin + job.grain - 1) / job.grain;
+			const size_t middle = aTask.begin + chunkCount / 2 * job.grain;
+			Push(aQueue, Task{ aTask.job, middle, aTask.end });
+			aTask.end = middle;
+		}
+
+		job.run(job.chunk, aTask.begin, aTask.end);
+		job.remaining.fetch_sub(aTask.end - aTask.begin, std::memory_order_acq_rel);
+	}
+}
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define OHM_X86
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+// Runtime instruction set selection.
+// The CPU is queried once, the active instruction set starts as the best supported one and can be lowered
+// through the OHM_INSTRUCTION_SET environment variable (scalar, sse2, sse4.1, avx2, avx512) or SetInstructionSet.
+namespace Ohm
+{
+	enum class InstructionSet : uint8_t
+	{
+		Scalar,
+		SSE2,
+		SSE4_1,
+		AVX2,
+		AVX512
+	};
+
+	struct CpuFeatures
+	{
+		bool sse2 = false;
+		bool sse4_1 = false;
+		bool avx = false;
+		bool avx2 = false;
+		bool fma = false;
+		bool avx512f = false;
+	};
+
+	namespace Detail
+	{
+#if defined(OHM_X86)
+		inline void Cpuid(uint32_t aLeaf, uint32_t aSubLeaf, uint32_t aOut[4])
+		{
+#if defined(_MSC_VER)
+			int registers[4];
+			__cpuidex(registers, static_cast<int>(aLeaf), static_cast<int>(aSubLeaf));
+			std::memcpy(aOut, registers, sizeof(registers));
+#else
+			__cpuid_count(aLeaf, aSubLeaf, aOut[0], aOut[1], aOut[2], aOut[3]);
+#endif
+		}
+
+		// Register state the OS saves on context switches (XCR0).
+		inline uint64_t GetEnabledStateMask()
+		{
+#if defined(_MSC_VER)
+			return _xgetbv(0);
+#else
+			uint32_t low, high;
+			__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+			return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+		}
+#endif
+
+		inline CpuFeatures DetectCpuFeatures()
+		{
+			CpuFeatures features;
+#if defined(OHM_X86)
+			uint32_t registers[4];
+			Cpuid(0, 0, registers);
+			const uint32_t maxLeaf = registers[0];
+
+			Cpuid(1, 0, registers);
+			features.sse2 = (registers[3] & (1u << 26)) != 0;
+			features.sse4_1 = (registers[2] & (1u << 19)) != 0;
+
+			// AVX state (XMM and YMM) must be enabled by the OS, AVX-512 additionally needs opmask and ZMM state.
+			const bool osxsave = (registers[2] & (1u << 27)) != 0;
+			const uint64_t stateMask = osxsave ? GetEnabledStateMask() : 0;
+			const bool avxState = (stateMask & 0x6) == 0x6;
+			const bool avx512State = (stateMask & 0xE6) == 0xE6;
+
+			features.avx = avxState && (registers[2] & (1u << 28)) != 0;
+			features.fma = features.avx && (registers[2] & (1u << 12)) != 0;
+
+			if (maxLeaf >= 7)
+			{
+				Cpuid(7, 0, registers);
+				features.avx2 = features.avx && (registers[1] & (1u << 5)) != 0;
+				features.avx512f = avx512State && (registers[1] & (1u << 16)) != 0;
+			}
+#endif
+			return features;
+		}
+
+		inline bool EqualsIgnoreCase(const char* aA, const char* aB)
+		{
+			for (; *aA && *aB; aA++, aB++)
+			{
+				const char a = *aA >= 'A' && *aA <= 'Z' ? static_cast<char>(*aA - 'A' + 'a') : *aA;
+				const char b = *aB >= 'A' && *aB <= 'Z' ? static_cast<char>(*aB - 'A' + 'a') : *aB;
+				if (a != b)
+				{
+					return false;
+				}
+			}
+			return *aA == *aB;
+		}
+	}
+
+	inline const CpuFeatures& GetCpuFeatures()
+	{
+		static const CpuFeatures features = Detail::DetectCpuFeatures();
+		return features;
+	}
+
+	inline bool IsSupported(InstructionSet aInstructionSet)
+	{
+		const CpuFeatures& features = GetCpuFeatures();
+		switch (aInstructionSet)
+		{
+			case InstructionSet::Scalar: return true;
+			case InstructionSet::SSE2: return features.sse2;
+			case InstructionSet::SSE4_1: return features.sse2 && features.sse4_1;
+			case InstructionSet::AVX2: return features.avx2 && features.fma;
+			case InstructionSet::AVX512: return features.avx2 && features.fma && features.avx512f;
+		}
+		return false;
+	}
+
+	inline InstructionSet GetBestInstructionSet()
+	{
+		for (InstructionSet set : { InstructionSet::AVX512, InstructionSet::AVX2, InstructionSet::SSE4_1, InstructionSet::SSE2 })
+		{
+			if (IsSupported(set))
+			{
+				return set;
+			}
+		}
+		return InstructionSet::Scalar;
+	}
+
+	inline const char* ToString(InstructionSet aInstructionSet)
+	{
+		switch (aInstructionSet)
+		{
+			case InstructionSet::Scalar: return "scalar";
+			case InstructionSet::SSE2: return "sse2";
+			case InstructionSet::SSE4_1: return "sse4.1";
+			case InstructionSet::AVX2: return "avx2";
+			case InstructionSet::AVX512: return "avx512";
+		}
+		return "unknown";
+	}
+
+	inline bool ParseInstructionSet(const char* aName, InstructionSet& aOutInstructionSet)
+	{
+		for (InstructionSet set : { InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::SSE4_1, InstructionSet::AVX2, InstructionSet::AVX512 })
+		{
+			if (Detail::EqualsIgnoreCase(aName, ToString(set)))
+			{
+				aOutInstructionSet = set;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	namespace Detail
+	{
+		inline InstructionSet GetStartupInstructionSet()
+		{
+			InstructionSet requested;
+			const char* name = std::getenv("OHM_INSTRUCTION_SET");
+			if (name && ParseInstructionSet(name, requested) && IsSupported(requested))
+			{
+				return requested;
+			}
+			return GetBestInstructionSet();
+		}
+
+		inline std::atomic<InstructionSet>& GetActiveInstructionSet()
+		{
+			static std::atomic<InstructionSet> active{ GetStartupInstructionSet() };
+			return active;
+		}
+	}
+
+	inline InstructionSet GetInstructionSet()
+	{
+		return Detail::GetActiveInstructionSet().load(std::memory_order_relaxed);
+	}
+
+	// Forces the kernels used by Ohm::Dispatch, returns false and keeps the current set if the CPU does not support aInstructionSet.
+	inline bool SetInstructionSet(InstructionSet aInstructionSet)
+	{
+		if (!IsSupported(aInstructionSet))
+		{
+			return false;
+		}
+
+		Detail::GetActiveInstructionSet().store(aInstructionSet, std::memory_order_relaxed);
+		return true;
+	}
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Ohm/Utility/Simd.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// Unit vector in 32 bits: the direction is projected onto the octahedron |x| + |y| + |z| = 1, the lower half is
+// folded over the upper one and the resulting square is stored as two 16 bit snorm values.
+// The decoded direction is within 7e-5 radians (0.004 degrees) of a unit input and is unit length to float precision.
+// A zero vector decodes to (0, 0, 1).
+class OctahedralNormal
+{
+public:
+	OctahedralNormal() = default;
+	explicit OctahedralNormal(const Vector3<float>& aNormal);
+
+	Vector3<float> ToVector3() const;
+
+	int16_t x;
+	int16_t y;
+};
+
+namespace Ohm::Detail
+{
+	constexpr float OctahedralScale = 32767.f;
+	constexpr float OctahedralInverseScale = 1.f / 32767.f;
+}
+
+inline OctahedralNormal::OctahedralNormal(const Vector3<float>& aNormal)
+{
+	const float length = std::abs(aNormal.x) + std::abs(aNormal.y) + std::abs(aNormal.z);
+	const float inverseLength = 1.f / std::max(length, std::numeric_limits<float>::min());
+
+	float u = aNormal.x * inverseLength;
+	float v = aNormal.y * inverseLength;
+	if (aNormal.z < 0.f)
+	{
+		const float foldedU = std::copysign(1.f - std::abs(v), u);
+		const float foldedV = std::copysign(1.f - std::abs(u), v);
+		u = foldedU;
+		v = foldedV;
+	}
+
+	// lrint rounds to nearest even like the SIMD conversion.
+	x = static_cast<int16_t>(std::lrint(u * Ohm::Detail::OctahedralScale));
+	y = static_cast<int16_t>(std::lrint(v * Ohm::Detail::OctahedralScale));
+}
+
+inline Vector3<float> OctahedralNormal::ToVector3() const
+{
+	float u = std::max(static_cast<float>(x) * Ohm::Detail::OctahedralInverseScale, -1.f);
+	float v = std::max(static_cast<float>(y) * Ohm::Detail::OctahedralInverseScale, -1.f);
+	const float z = 1.f - std::abs(u) - std::abs(v);
+
+	// Unfold the lower half, t is zero on the upper one.
+	const float t = std::max(-z, 0.f);
+	u -= std::copysign(t, u);
+	v -= std::copysign(t, v);
+
+	const float inverseLength = 1.f / std::sqrt(u * u + v * v + z * z);
+	return Vector3<float>(u * inverseLength, v * inverseLength, z * inverseLength);
+}
+
+#if defined(OHM_SIMD_SSE2)
+namespace Ohm::Simd
+{
+	inline __m128 CopySign(__m128 aMagnitude, __m128 aSign)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		return _mm_or_ps(_mm_andnot_ps(signMask, aMagnitude), _mm_and_ps(signMask, aSign));
+	}
+
+	// Encodes floor(aCount / 4) * 4 normals and returns how many were processed.
+	inline size_t EncodeOctahedralSSE(const float* aNormals, int16_t* aOut, size_t aCount)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		const __m128 one = _mm_set1_ps(1.f);
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			__m128 x, y, z;
+			LoadVector3x4(aNormals + i * 3, x, y, z);
+
+			const __m128 absX = _mm_andnot_ps(signMask, x);
+			const __m128 absY = _mm_andnot_ps(signMask, y);
+			const __m128 absZ = _mm_andnot_ps(signMask, z);
+			const __m128 length = _mm_max_ps(_mm_add_ps(_mm_add_ps(absX, absY), absZ), _mm_set1_ps(std::numeric_limits<float>::min()));
+			const __m128 inverseLength = _mm_div_ps(one, length);
+
+			__m128 u = _mm_mul_ps(x, inverseLength);
+			__m128 v = _mm_mul_ps(y, inverseLength);
+
+			const __m128 foldedU = CopySign(_mm_sub_ps(one, _mm_andnot_ps(signMask, v)), u);
+			const __m128 foldedV = CopySign(_mm_sub_ps(one, _mm_andnot_ps(signMask, u)), v);
+			const __m128 lower = _mm_cmplt_ps(z, _mm_setzero_ps());
+			u = _mm_or_ps(_mm_and_ps(lower, foldedU), _mm_andnot_ps(lower, u));
+			v = _mm_or_ps(_mm_and_ps(lower, foldedV), _mm_andnot_ps(lower, v));
+
+			const __m128 scale = _mm_set1_ps(Ohm::Detail::OctahedralScale);
+			const __m128i quantizedU = _mm_cvtps_epi32(_mm_mul_ps(u, scale));
+			const __m128i quantizedV = _mm_cvtps_epi32(_mm_mul_ps(v, scale));
+
+			// Interleave to x0 y0 x1 y1 ...
+			const __m128i packedU = _mm_packs_epi32(quantizedU, quantizedU);
+			const __m128i packedV = _mm_packs_epi32(quantizedV, quantizedV);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(aOut + i * 2), _mm_unpacklo_epi16(packedU, packedV));
+		}
+		return i;
+	}
+
+	// Decodes floor(aCount / 4) * 4 normals and returns how many were processed.
+	inline size_t DecodeOctahedralSSE(const int16_t* aEncoded, float* aOut, size_t aCount)
+	{
+		const __m128 signMask = _mm_set1_ps(-0.f);
+		const __m128 one = _mm_set1_ps(1.f);
+
+		size_t i = 0;
+		for (; i + 4 <= aCount; i += 4)
+		{
+			// Every 32 bit lane holds one normal, x in the low half.
+			const __m128i encoded = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aEncoded + i * 2));
+			const __m128i quantizedU = _mm_srai_epi32(_mm_slli_epi32(encoded, 16), 16);
+			const __m128i quantizedV = _mm_srai_epi32(encoded, 16);
+
+			const __m128 inverseScale = _mm_set1_ps(Ohm::Detail::OctahedralInverseScale);
+			__m128 u = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantizedU), inverseScale), _mm_set1_ps(-1.f));
+			__m128 v = _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(quantizedV), inverseScale), _mm_set1_ps(-1.f));
+			const __m128 z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(signMask, u)), _mm_andnot_ps(signMask, v));
+
+			const __m128 t = _mm_max_ps(_mm_sub_ps(_mm_setzero_ps(), z), _mm_setzero_ps());
+			u = _mm_sub_ps(u, CopySign(t, u));
+			v = _mm_sub_ps(v, CopySign(t, v));
+
+			const __m128 lengthSqr = _mm_add_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(v, v)), _mm_mul_ps(z, z));
+			const __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSqr));
+			StoreVector3x4(aOut + i * 3, _mm_mul_ps(u, inverseLength), _mm_mul_ps(v, inverseLength), _mm_mul_ps(z, inverseLength));
+		}
+		return i;
+	}
+}
+#endif
+
+inline void EncodeNormals(const Vector3<float>* aNormals, OctahedralNormal* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_SSE2)
+	i = Ohm::Simd::EncodeOctahedralSSE(reinterpret_cast<const float*>(aNormals), reinterpret_cast<int16_t*>(aOut), aCount);
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = OctahedralNormal(aNormals[i]);
+	}
+}
+
+inline void DecodeNormals(const OctahedralNormal* aNormals, Vector3<float>* aOut, size_t aCount)
+{
+	size_t i = 0;
+#if defined(OHM_SIMD_SSE2)
+	i = Ohm::Simd::DecodeOctahedralSSE(reinterpret_cast<const int16_t*>(aNormals), reinterpret_cast<float*>(aOut), aCount);
+#endif
+	for (; i < aCount; i++)
+	{
+		aOut[i] = aNormals[i].ToVector3();
+	}
+}
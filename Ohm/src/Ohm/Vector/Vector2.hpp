@@ -1,37 +1,49 @@
 #pragma once
 
+#include "Ohm/Utility/FastMath.hpp"
+#include "Ohm/Utility/Math.hpp"
+
 #include <cassert>
+#include <cmath>
+#include <type_traits>
 
 template <class T>
 class Vector2
 {
 public:
-	Vector2<T>();
-	Vector2<T>(const T& aScalar);
+	constexpr Vector2<T>();
+	constexpr Vector2<T>(const T& aScalar);
 
 	template<typename U>
-	Vector2<T>(const U& aScalar);
+	constexpr Vector2<T>(const U& aScalar);
 
 	template<typename U>
-	Vector2<T>(const U& aX, const U& aY);
+	constexpr Vector2<T>(const U& aX, const U& aY);
 
-	Vector2<T>(const T& aX, const T& aY);
+	constexpr Vector2<T>(const T& aX, const T& aY);
 	Vector2<T>(const Vector2<T>& aVector) = default;
 	Vector2<T>& operator=(const Vector2<T>& aVector) = default;
 	~Vector2<T>() = default;
 
-	T LengthSqr() const;
-	T Length() const;
-	Vector2<T> GetNormalized() const;
-	void Normalize();
-	T Dot(const Vector2<T>& aVector) const;
+	constexpr T LengthSqr() const;
+	// The With versions take the tier of the square root (see MathAccuracy), the plain ones use Ohm::Math::DefaultAccuracy.
+	constexpr T Length() const;
+	template<MathAccuracy Accuracy>
+	constexpr T LengthWith() const;
+	constexpr Vector2<T> GetNormalized() const;
+	template<MathAccuracy Accuracy>
+	constexpr Vector2<T> GetNormalizedWith() const;
+	constexpr void Normalize();
+	template<MathAccuracy Accuracy>
+	constexpr void NormalizeWith();
+	constexpr T Dot(const Vector2<T>& aVector) const;
 
 	T x;
 	T y;
 };
 
 template <class T>
-Vector2<T> operator+(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
+constexpr Vector2<T> operator+(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector0.x + aVector1.x;
@@ -40,7 +52,7 @@ Vector2<T> operator+(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
 }
 
 template <class T>
-Vector2<T> operator-(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
+constexpr Vector2<T> operator-(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector0.x - aVector1.x;
@@ -49,7 +61,7 @@ Vector2<T> operator-(const Vector2<T>& aVector0, const Vector2<T>& aVector1)
 }
 
 template <class T>
-Vector2<T> operator*(const Vector2<T>& aVector, const T& aScalar)
+constexpr Vector2<T> operator*(const Vector2<T>& aVector, const T& aScalar)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -59,7 +71,7 @@ Vector2<T> operator*(const Vector2<T>& aVector, const T& aScalar)
 }
 
 template <class T>
-Vector2<T> operator*(const T& aScalar, const Vector2<T>& aVector)
+constexpr Vector2<T> operator*(const T& aScalar, const Vector2<T>& aVector)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -69,7 +81,7 @@ Vector2<T> operator*(const T& aScalar, const Vector2<T>& aVector)
 }
 
 template <class T, typename U>
-Vector2<T> operator*(const Vector2<T>& aVector, const U& aScalar)
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector2<T>> operator*(const Vector2<T>& aVector, const U& aScalar)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -79,7 +91,7 @@ Vector2<T> operator*(const Vector2<T>& aVector, const U& aScalar)
 }
 
 template <class T, typename U>
-Vector2<T> operator*(const U& aScalar, const Vector2<T>& aVector)
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector2<T>> operator*(const U& aScalar, const Vector2<T>& aVector)
 {
 	Vector2<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -89,7 +101,7 @@ Vector2<T> operator*(const U& aScalar, const Vector2<T>& aVector)
 }
 
 template <class T>
-Vector2<T> operator/(const Vector2<T>& aVector, const T& aScalar)
+constexpr Vector2<T> operator/(const Vector2<T>& aVector, const T& aScalar)
 {
 	assert(aScalar > static_cast<T>(0) || aScalar < static_cast<T>(0) && "Scalar needs to be non-zero!");
 
@@ -100,7 +112,7 @@ Vector2<T> operator/(const Vector2<T>& aVector, const T& aScalar)
 }
 
 template <class T, typename U>
-Vector2<T> operator/(const Vector2<T>& aVector, const U& aScalar)
+constexpr Vector2<T> operator/(const Vector2<T>& aVector, const U& aScalar)
 {
 	assert(aScalar > static_cast<U>(0) || aScalar < static_cast<U>(0) && "Scalar needs to be non-zero!");
 
@@ -111,106 +123,144 @@ Vector2<T> operator/(const Vector2<T>& aVector, const U& aScalar)
 }
 
 template <class T>
-void operator+=(Vector2<T>& aVector0, const Vector2<T>& aVector1)
+constexpr void operator+=(Vector2<T>& aVector0, const Vector2<T>& aVector1)
 {
 	aVector0 = aVector0 + aVector1;
 }
 
 template <class T>
-void operator-=(Vector2<T>& aVector0, const Vector2<T>& aVector1)
+constexpr void operator-=(Vector2<T>& aVector0, const Vector2<T>& aVector1)
 {
 	aVector0 = aVector0 - aVector1;
 }
 
 template <class T>
-void operator*=(Vector2<T>& aVector, const T& aScalar)
+constexpr void operator*=(Vector2<T>& aVector, const T& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
 template <class T, typename U>
-void operator*=(Vector2<T>& aVector, const U& aScalar)
+constexpr void operator*=(Vector2<T>& aVector, const U& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
 template <class T>
-void operator/=(Vector2<T>& aVector, const T& aScalar)
+constexpr void operator/=(Vector2<T>& aVector, const T& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
 template <class T, typename U>
-void operator/=(Vector2<T>& aVector, const U& aScalar)
+constexpr void operator/=(Vector2<T>& aVector, const U& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
 template<class T>
-inline T Vector2<T>::LengthSqr() const
+constexpr T Vector2<T>::LengthSqr() const
 {
 	return (x * x) + (y * y);
 }
 
 template<class T>
-inline T Vector2<T>::Length() const
+constexpr T Vector2<T>::Length() const
 {
-	return sqrt(LengthSqr());
+	return LengthWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline Vector2<T> Vector2<T>::GetNormalized() const
+template<MathAccuracy Accuracy>
+constexpr T Vector2<T>::LengthWith() const
 {
-	T length = Length();
+	return Ohm::Math::Sqrt<Accuracy>(LengthSqr());
+}
 
-	assert(length > static_cast<T>(0) && "Length must be non zero!");
-	return *this / Length();
+template<class T>
+constexpr Vector2<T> Vector2<T>::GetNormalized() const
+{
+	return GetNormalizedWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline void Vector2<T>::Normalize()
+template<MathAccuracy Accuracy>
+constexpr Vector2<T> Vector2<T>::GetNormalizedWith() const
 {
-	T lenght = Length();
-	//assert(length > static_cast<T>(0) && "Length must be non zero!");
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		assert(LengthSqr() > static_cast<T>(0) && "Length must be non zero!");
+		return *this * Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+	}
+	else
+	{
+		T length = LengthWith<Accuracy>();
+
+		assert(length > static_cast<T>(0) && "Length must be non zero!");
+		return *this / length;
+	}
+}
 
-	x = x / lenght;
-	y = y / lenght;
+template<class T>
+constexpr void Vector2<T>::Normalize()
+{
+	NormalizeWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<class T>
+template<MathAccuracy Accuracy>
+constexpr void Vector2<T>::NormalizeWith()
+{
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		const T invLength = Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+		x = x * invLength;
+		y = y * invLength;
+	}
+	else
+	{
+		T lenght = LengthWith<Accuracy>();
+		//assert(length > static_cast<T>(0) && "Length must be non zero!");
+
+		x = x / lenght;
+		y = y / lenght;
+	}
 }
 
 template<class T>
-inline T Vector2<T>::Dot(const Vector2<T>& aVector) const
+constexpr T Vector2<T>::Dot(const Vector2<T>& aVector) const
 {
 	return (x * aVector.x) + (y * aVector.y);
 }
 
 template<class T>
-inline Vector2<T>::Vector2()
+constexpr Vector2<T>::Vector2()
 	: x(0), y(0)
 {
 }
 
 template<class T>
-inline Vector2<T>::Vector2(const T& aScalar)
+constexpr Vector2<T>::Vector2(const T& aScalar)
 	: x(aScalar), y(aScalar)
 {
 }
 
 template<class T>
 template<typename U>
-inline Vector2<T>::Vector2(const U& aScalar)
+constexpr Vector2<T>::Vector2(const U& aScalar)
 	: x(static_cast<T>(aScalar)), y(static_cast<T>(aScalar))
 {
 }
 
 template<class T>
 template<typename U>
-inline Vector2<T>::Vector2(const U& aX, const U& aY)
+constexpr Vector2<T>::Vector2(const U& aX, const U& aY)
 	: x(static_cast<T>(aX)), y(static_cast<T>(aY))
 {
 }
 
 template<class T>
-inline Vector2<T>::Vector2(const T& aX, const T& aY)
+constexpr Vector2<T>::Vector2(const T& aX, const T& aY)
 	: x(aX), y(aY)
 {
 }
\ No newline at end of file
@@ -3,44 +3,53 @@
 #include "Ohm/Vector/Vector2.hpp"
 
 #include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <type_traits>
 
 template <class T>
 class Vector3
 {
 public:
-	Vector3<T>();
-	Vector3<T>(const T& aScalar);
-	Vector3<T>(const Vector2<T>& aVector, const T& aZ);
+	constexpr Vector3<T>();
+	constexpr Vector3<T>(const T& aScalar);
+	constexpr Vector3<T>(const Vector2<T>& aVector, const T& aZ);
 
 	template<typename U>
-	Vector3<T>(U aScalar);
+	constexpr Vector3<T>(U aScalar);
 
 	template<typename U>
-	Vector3<T>(const U& aX, const U& aY, const U& aZ);
+	constexpr Vector3<T>(const U& aX, const U& aY, const U& aZ);
 
-	Vector3<T>(const T& aX, const T& aY, const T& aZ);
+	constexpr Vector3<T>(const T& aX, const T& aY, const T& aZ);
 	Vector3<T>(const Vector3<T>& aVector) = default;
 	Vector3<T>& operator=(const Vector3<T>& aVector3) = default;
 	~Vector3<T>() = default;
 
-	T& operator[](int index);
-	const T& operator[](int index) const;
-	T& At(int index);
-
-	T LengthSqr() const;
-	T Length() const;
-	Vector3<T> GetNormalized() const;
-	void Normalize();
-	T Dot(const Vector3<T>& aVector) const;
-	Vector3<T> Cross(const Vector3<T>& aVector) const;
+	constexpr T& operator[](int index);
+	constexpr const T& operator[](int index) const;
+	constexpr T& At(int index);
+
+	constexpr T LengthSqr() const;
+	// The With versions take the tier of the square root (see MathAccuracy), the plain ones use Ohm::Math::DefaultAccuracy.
+	constexpr T Length() const;
+	template<MathAccuracy Accuracy>
+	constexpr T LengthWith() const;
+	constexpr Vector3<T> GetNormalized() const;
+	template<MathAccuracy Accuracy>
+	constexpr Vector3<T> GetNormalizedWith() const;
+	constexpr void Normalize();
+	template<MathAccuracy Accuracy>
+	constexpr void NormalizeWith();
+	constexpr T Dot(const Vector3<T>& aVector) const;
+	constexpr Vector3<T> Cross(const Vector3<T>& aVector) const;
 
 	T x;
 	T y;
 	T z;
 };
 
-template <class T> Vector3<T> operator+(const Vector3<T>& aVector0, const Vector3<T>& aVector1)
+template <class T> constexpr Vector3<T> operator+(const Vector3<T>& aVector0, const Vector3<T>& aVector1)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector0.x + aVector1.x;
@@ -49,7 +58,7 @@ template <class T> Vector3<T> operator+(const Vector3<T>& aVector0, const Vector
 	return newVector;
 }
 
-template <class T> T& Vector3<T>::operator[](int index)
+template <class T> constexpr T& Vector3<T>::operator[](int index)
 {
 	assert(index >= 0 && index < 3 && "Index out of bounds!");
 
@@ -63,7 +72,7 @@ template <class T> T& Vector3<T>::operator[](int index)
 	return x;
 }
 
-template<class T> inline const T& Vector3<T>::operator[](int index) const
+template<class T> constexpr const T& Vector3<T>::operator[](int index) const
 {
 	assert(index >= 0 && index < 3 && "Index out of bounds!");
 
@@ -78,7 +87,7 @@ template<class T> inline const T& Vector3<T>::operator[](int index) const
 }
 
 template<class T>
-inline T& Vector3<T>::At(int index)
+constexpr T& Vector3<T>::At(int index)
 {
 	assert(index >= 0 && index < 3 && "Index out of bounds!");
 
@@ -92,7 +101,7 @@ inline T& Vector3<T>::At(int index)
 	return x;
 }
 
-template <class T> Vector3<T> operator-(const Vector3<T>& aVector0, const Vector3<T>& aVector1)
+template <class T> constexpr Vector3<T> operator-(const Vector3<T>& aVector0, const Vector3<T>& aVector1)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector0.x - aVector1.x;
@@ -101,7 +110,7 @@ template <class T> Vector3<T> operator-(const Vector3<T>& aVector0, const Vector
 	return newVector;
 }
 
-template <class T> Vector3<T> operator*(const Vector3<T>& aVector, const T& aScalar)
+template <class T> constexpr Vector3<T> operator*(const Vector3<T>& aVector, const T& aScalar)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -111,7 +120,7 @@ template <class T> Vector3<T> operator*(const Vector3<T>& aVector, const T& aSca
 	return newVector;
 }
 
-template <class T> Vector3<T> operator*(const Vector3<T>& aVector, const Vector3<T>& aSecond)
+template <class T> constexpr Vector3<T> operator*(const Vector3<T>& aVector, const Vector3<T>& aSecond)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector.x * aSecond.x;
@@ -122,7 +131,7 @@ template <class T> Vector3<T> operator*(const Vector3<T>& aVector, const Vector3
 }
 
 
-template <class T> Vector3<T> operator*(const T& aScalar, const Vector3<T>& aVector)
+template <class T> constexpr Vector3<T> operator*(const T& aScalar, const Vector3<T>& aVector)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -132,7 +141,7 @@ template <class T> Vector3<T> operator*(const T& aScalar, const Vector3<T>& aVec
 	return newVector;
 }
 
-template <class T, typename U> Vector3<T> operator*(const Vector3<T>& aVector, const U& aScalar)
+template <class T, typename U> constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector3<T>> operator*(const Vector3<T>& aVector, const U& aScalar)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -142,7 +151,7 @@ template <class T, typename U> Vector3<T> operator*(const Vector3<T>& aVector, c
 	return newVector;
 }
 
-template <class T, typename U> Vector3<T> operator*(const U& aScalar, const Vector3<T>& aVector)
+template <class T, typename U> constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector3<T>> operator*(const U& aScalar, const Vector3<T>& aVector)
 {
 	Vector3<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -152,7 +161,7 @@ template <class T, typename U> Vector3<T> operator*(const U& aScalar, const Vect
 	return newVector;
 }
 
-template <class T> Vector3<T> operator/(const Vector3<T>& aVector, const T& aScalar)
+template <class T> constexpr Vector3<T> operator/(const Vector3<T>& aVector, const T& aScalar)
 {
 	assert(aScalar > static_cast<T>(0) || aScalar < static_cast<T>(0) && "Scalar needs to be non-zero!");
 
@@ -163,7 +172,7 @@ template <class T> Vector3<T> operator/(const Vector3<T>& aVector, const T& aSca
 	return newVector;
 }
 
-template <class T, typename U> Vector3<T> operator/(const Vector3<T>& aVector, const U& aScalar)
+template <class T, typename U> constexpr Vector3<T> operator/(const Vector3<T>& aVector, const U& aScalar)
 {
 	assert(aScalar > static_cast<U>(0) || aScalar < static_cast<U>(0) && "Scalar needs to be non-zero!");
 
@@ -174,81 +183,120 @@ template <class T, typename U> Vector3<T> operator/(const Vector3<T>& aVector, c
 	return newVector;
 }
 
-template <class T> void operator+=(Vector3<T>& aVector0, const Vector3<T>& aVector1)
+template <class T> constexpr void operator+=(Vector3<T>& aVector0, const Vector3<T>& aVector1)
 {
 	aVector0 = aVector0 + aVector1;
 }
 
-template <class T> void operator-=(Vector3<T>& aVector0, const Vector3<T>& aVector1)
+template <class T> constexpr void operator-=(Vector3<T>& aVector0, const Vector3<T>& aVector1)
 {
 	aVector0 = aVector0 - aVector1;
 }
 
-template <class T> void operator*=(Vector3<T>& aVector, const T& aScalar)
+template <class T> constexpr void operator*=(Vector3<T>& aVector, const T& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
-template <class T, typename U> void operator*=(Vector3<T>& aVector, const U& aScalar)
+template <class T, typename U> constexpr void operator*=(Vector3<T>& aVector, const U& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
-template <class T> void operator/=(Vector3<T>& aVector, const T& aScalar)
+template <class T> constexpr void operator/=(Vector3<T>& aVector, const T& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
-template <class T, typename U> void operator/=(Vector3<T>& aVector, const U& aScalar)
+template <class T, typename U> constexpr void operator/=(Vector3<T>& aVector, const U& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
-template <class T> bool operator==(const Vector3<T>& aVector, const Vector3<T>& aVector1)
+template <class T> constexpr bool operator==(const Vector3<T>& aVector, const Vector3<T>& aVector1)
 {
 	return aVector.x == aVector1.x && aVector.y == aVector1.y && aVector.z == aVector1.z;
 }
 
 template<class T>
-inline T Vector3<T>::LengthSqr() const
+constexpr T Vector3<T>::LengthSqr() const
 {
 	return (x * x) + (y * y) + (z * z);
 }
 
 template<class T>
-inline T Vector3<T>::Length() const
+constexpr T Vector3<T>::Length() const
 {
-	return sqrt(LengthSqr());
+	return LengthWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline Vector3<T> Vector3<T>::GetNormalized() const
+template<MathAccuracy Accuracy>
+constexpr T Vector3<T>::LengthWith() const
 {
-	T length = Length();
+	return Ohm::Math::Sqrt<Accuracy>(LengthSqr());
+}
 
-	assert(length > static_cast<T>(0) && "Length must be non zero!");
-	return *this / Length();
+template<class T>
+constexpr Vector3<T> Vector3<T>::GetNormalized() const
+{
+	return GetNormalizedWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline void Vector3<T>::Normalize()
+template<MathAccuracy Accuracy>
+constexpr Vector3<T> Vector3<T>::GetNormalizedWith() const
 {
-	T lenght = Length();
-	//assert(length > static_cast<T>(0) && "Length must be non zero!");
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		assert(LengthSqr() > static_cast<T>(0) && "Length must be non zero!");
+		return *this * Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+	}
+	else
+	{
+		T length = LengthWith<Accuracy>();
 
-	x = x / lenght;
-	y = y / lenght;
-	z = z / lenght;
+		assert(length > static_cast<T>(0) && "Length must be non zero!");
+		return *this / length;
+	}
+}
+
+template<class T>
+constexpr void Vector3<T>::Normalize()
+{
+	NormalizeWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<class T>
+template<MathAccuracy Accuracy>
+constexpr void Vector3<T>::NormalizeWith()
+{
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		const T invLength = Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+		x = x * invLength;
+		y = y * invLength;
+		z = z * invLength;
+	}
+	else
+	{
+		T lenght = LengthWith<Accuracy>();
+		//assert(length > static_cast<T>(0) && "Length must be non zero!");
+
+		x = x / lenght;
+		y = y / lenght;
+		z = z / lenght;
+	}
 }
 
 template<class T>
-inline T Vector3<T>::Dot(const Vector3<T>& aVector) const
+constexpr T Vector3<T>::Dot(const Vector3<T>& aVector) const
 {
 	return (x * aVector.x) + (y * aVector.y) + (z * aVector.z);
 }
 
 template<class T>
-inline Vector3<T> Vector3<T>::Cross(const Vector3<T>& aVector) const
+constexpr Vector3<T> Vector3<T>::Cross(const Vector3<T>& aVector) const
 {
 	Vector3<T> newVector;
 	newVector.x = y * aVector.z - z * aVector.y;
@@ -259,41 +307,39 @@ inline Vector3<T> Vector3<T>::Cross(const Vector3<T>& aVector) const
 }
 
 template<class T>
-inline Vector3<T>::Vector3()
+constexpr Vector3<T>::Vector3()
 	: x(0), y(0), z(0)
 {
 }
 
 template<class T>
-inline Vector3<T>::Vector3(const T& aScalar)
+constexpr Vector3<T>::Vector3(const T& aScalar)
 	: x(aScalar), y(aScalar), z(aScalar)
 {
 }
 
 template<class T>
-inline Vector3<T>::Vector3(const Vector2<T>& aVector, const T& aZ)
+constexpr Vector3<T>::Vector3(const Vector2<T>& aVector, const T& aZ)
+	: x(aVector.x), y(aVector.y), z(aZ)
 {
-	x = aVector.x;
-	y = aVector.y;
-	z = z;
 }
 
 template<class T>
 template<typename U>
-inline Vector3<T>::Vector3(U aScalar)
+constexpr Vector3<T>::Vector3(U aScalar)
 	: x(static_cast<T>(aScalar)), y(static_cast<T>(aScalar)), z(static_cast<T>(aScalar))
 {
 }
 
 template<class T>
 template<typename U>
-inline Vector3<T>::Vector3(const U& aX, const U& aY, const U& aZ)
+constexpr Vector3<T>::Vector3(const U& aX, const U& aY, const U& aZ)
 	: x(static_cast<T>(aX)), y(static_cast<T>(aY)), z(static_cast<T>(aZ))
 {
 }
 
 template<class T>
-inline Vector3<T>::Vector3(const T& aX, const T& aY, const T& aZ)
+constexpr Vector3<T>::Vector3(const T& aX, const T& aY, const T& aZ)
 	: x(aX), y(aY), z(aZ)
 {
 }
\ No newline at end of file
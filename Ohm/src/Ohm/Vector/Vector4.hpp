@@ -3,38 +3,47 @@
 #include "Ohm/Vector/Vector3.hpp"
 
 #include <cassert>
+#include <cmath>
 #include <cstdint>
+#include <type_traits>
 
 template <class T>
 class Vector4
 {
 public:
-	Vector4<T>();
-	Vector4<T>(const T& aScalar);
-	Vector4<T>(const Vector3<T>& aVector, const T& aW);
-	Vector4<T>(const Vector2<T>& aVectorOne, const Vector2<T>& aVectorTwo);
-	Vector4<T>(const Vector2<T>& aVector, const T& aZ, const T& aW);
+	constexpr Vector4<T>();
+	constexpr Vector4<T>(const T& aScalar);
+	constexpr Vector4<T>(const Vector3<T>& aVector, const T& aW);
+	constexpr Vector4<T>(const Vector2<T>& aVectorOne, const Vector2<T>& aVectorTwo);
+	constexpr Vector4<T>(const Vector2<T>& aVector, const T& aZ, const T& aW);
 
 	template<typename U>
-	Vector4<T>(const U& aScalar);
+	constexpr Vector4<T>(const U& aScalar);
 
 	template<typename U>
-	Vector4<T>(const U& aX, const U& aY, const U& aZ, const U& aW);
-	Vector4<T>(const T& aX, const T& aY, const T& aZ, const T& aW);
+	constexpr Vector4<T>(const U& aX, const U& aY, const U& aZ, const U& aW);
+	constexpr Vector4<T>(const T& aX, const T& aY, const T& aZ, const T& aW);
 
 	Vector4<T>(const Vector4<T>& aVector) = default;
 	Vector4<T>& operator=(const Vector4<T>& aVector3) = default;
 	~Vector4<T>() = default;
 
-	T& operator[](int index);
-	const T& operator[](int index) const;
-
-	T& At(int index);
-	T LengthSqr() const;
-	T Length() const;
-	Vector4<T> GetNormalized() const;
-	void Normalize();
-	T Dot(const Vector4<T>& aVector) const;
+	constexpr T& operator[](int index);
+	constexpr const T& operator[](int index) const;
+
+	constexpr T& At(int index);
+	constexpr T LengthSqr() const;
+	// The With versions take the tier of the square root (see MathAccuracy), the plain ones use Ohm::Math::DefaultAccuracy.
+	constexpr T Length() const;
+	template<MathAccuracy Accuracy>
+	constexpr T LengthWith() const;
+	constexpr Vector4<T> GetNormalized() const;
+	template<MathAccuracy Accuracy>
+	constexpr Vector4<T> GetNormalizedWith() const;
+	constexpr void Normalize();
+	template<MathAccuracy Accuracy>
+	constexpr void NormalizeWith();
+	constexpr T Dot(const Vector4<T>& aVector) const;
 
 	T x;
 	T y;
@@ -43,7 +52,7 @@ public:
 };
 
 template<class T>
-T& Vector4<T>::operator[](int index)
+constexpr T& Vector4<T>::operator[](int index)
 {
 	assert(index >= 0 && index < 4 && "Index out of bounds!");
 
@@ -58,7 +67,7 @@ T& Vector4<T>::operator[](int index)
 	return x;
 }
 
-template<class T> inline const T& Vector4<T>::operator[](int index) const
+template<class T> constexpr const T& Vector4<T>::operator[](int index) const
 {
 	assert(index >= 0 && index < 4 && "Index out of bounds!");
 
@@ -74,7 +83,7 @@ template<class T> inline const T& Vector4<T>::operator[](int index) const
 }
 
 template <class T>
-Vector4<T> operator+(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr Vector4<T> operator+(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector0.x + aVector1.x;
@@ -85,7 +94,7 @@ Vector4<T> operator+(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 }
 
 template <class T>
-Vector4<T> operator-(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr Vector4<T> operator-(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector0.x - aVector1.x;
@@ -96,7 +105,7 @@ Vector4<T> operator-(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 }
 
 template <class T>
-Vector4<T> operator*(const Vector4<T>& aVector, const T& aScalar)
+constexpr Vector4<T> operator*(const Vector4<T>& aVector, const T& aScalar)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -108,7 +117,7 @@ Vector4<T> operator*(const Vector4<T>& aVector, const T& aScalar)
 }
 
 template <class T>
-Vector4<T> operator*(const T& aScalar, const Vector4<T>& aVector)
+constexpr Vector4<T> operator*(const T& aScalar, const Vector4<T>& aVector)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector.x * aScalar;
@@ -120,7 +129,7 @@ Vector4<T> operator*(const T& aScalar, const Vector4<T>& aVector)
 }
 
 template <class T, typename U>
-Vector4<T> operator*(const Vector4<T>& aVector, const U& aScalar)
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector4<T>> operator*(const Vector4<T>& aVector, const U& aScalar)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -132,7 +141,7 @@ Vector4<T> operator*(const Vector4<T>& aVector, const U& aScalar)
 }
 
 template <class T, typename U>
-Vector4<T> operator*(const U& aScalar, const Vector4<T>& aVector)
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector4<T>> operator*(const U& aScalar, const Vector4<T>& aVector)
 {
 	Vector4<T> newVector;
 	newVector.x = aVector.x * static_cast<T>(aScalar);
@@ -144,7 +153,7 @@ Vector4<T> operator*(const U& aScalar, const Vector4<T>& aVector)
 }
 
 template<class T>
-Vector4<T> operator*(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr Vector4<T> operator*(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	Vector4<T> newVec;
 	newVec.x = aVector0.x * aVector1.x;
@@ -155,7 +164,7 @@ Vector4<T> operator*(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 	return newVec;
 }
 
-template <class T> Vector4<T> operator/(const Vector4<T>& aVector, const T& aScalar)
+template <class T> constexpr Vector4<T> operator/(const Vector4<T>& aVector, const T& aScalar)
 {
 	assert(aScalar > static_cast<T>(0) || aScalar < static_cast<T>(0) && "Scalar needs to be non-zero!");
 
@@ -167,7 +176,7 @@ template <class T> Vector4<T> operator/(const Vector4<T>& aVector, const T& aSca
 	return newVector;
 }
 
-template <class T, typename U> Vector4<T> operator/(const Vector4<T>& aVector, const U& aScalar)
+template <class T, typename U> constexpr Vector4<T> operator/(const Vector4<T>& aVector, const U& aScalar)
 {
 	assert(aScalar > static_cast<U>(0) || aScalar < static_cast<U>(0) && "Scalar needs to be non-zero!");
 
@@ -180,43 +189,43 @@ template <class T, typename U> Vector4<T> operator/(const Vector4<T>& aVector, c
 }
 
 template <class T>
-void operator+=(Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr void operator+=(Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	aVector0 = aVector0 + aVector1;
 }
 
 template <class T>
-void operator-=(Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr void operator-=(Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	aVector0 = aVector0 - aVector1;
 }
 
 template <class T>
-void operator*=(Vector4<T>& aVector, const T& aScalar)
+constexpr void operator*=(Vector4<T>& aVector, const T& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
 template <class T, typename U>
-void operator*=(Vector4<T>& aVector, const U& aScalar)
+constexpr void operator*=(Vector4<T>& aVector, const U& aScalar)
 {
 	aVector = aVector * aScalar;
 }
 
 template <class T>
-void operator/=(Vector4<T>& aVector, const T& aScalar)
+constexpr void operator/=(Vector4<T>& aVector, const T& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
 template <class T, typename U>
-void operator/=(Vector4<T>& aVector, const U& aScalar)
+constexpr void operator/=(Vector4<T>& aVector, const U& aScalar)
 {
 	aVector = aVector / aScalar;
 }
 
 template<typename T>
-bool operator==(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
+constexpr bool operator==(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 {
 	return aVector0.x == aVector1.x &&
 		aVector0.y == aVector1.y &&
@@ -225,7 +234,7 @@ bool operator==(const Vector4<T>& aVector0, const Vector4<T>& aVector1)
 }
 
 template<class T>
-inline T& Vector4<T>::At(int index)
+constexpr T& Vector4<T>::At(int index)
 {
 	assert(index >= 0 && index < 4 && "Index out of bounds!");
 
@@ -241,102 +250,133 @@ inline T& Vector4<T>::At(int index)
 }
 
 template<class T>
-inline T Vector4<T>::LengthSqr() const
+constexpr T Vector4<T>::LengthSqr() const
 {
 	return (x * x) + (y * y) + (z * z) + (w * w);
 }
 
 template<class T>
-inline T Vector4<T>::Length() const
+constexpr T Vector4<T>::Length() const
 {
-	return sqrt(LengthSqr());
+	return LengthWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline Vector4<T> Vector4<T>::GetNormalized() const
+template<MathAccuracy Accuracy>
+constexpr T Vector4<T>::LengthWith() const
 {
-	T length = Length();
-	assert(length > static_cast<T>(0) && "Length must be non zero!");
+	return Ohm::Math::Sqrt<Accuracy>(LengthSqr());
+}
+
+template<class T>
+constexpr Vector4<T> Vector4<T>::GetNormalized() const
+{
+	return GetNormalizedWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<class T>
+template<MathAccuracy Accuracy>
+constexpr Vector4<T> Vector4<T>::GetNormalizedWith() const
+{
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		assert(LengthSqr() > static_cast<T>(0) && "Length must be non zero!");
+		return *this * Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+	}
+	else
+	{
+		T length = LengthWith<Accuracy>();
+		assert(length > static_cast<T>(0) && "Length must be non zero!");
+
+		return *this / length;
+	}
+}
 
-	return *this / length;
+template<class T>
+constexpr void Vector4<T>::Normalize()
+{
+	NormalizeWith<Ohm::Math::DefaultAccuracy>();
 }
 
 template<class T>
-inline void Vector4<T>::Normalize()
+template<MathAccuracy Accuracy>
+constexpr void Vector4<T>::NormalizeWith()
 {
-	T lenght = Length();
-	assert(Length() > static_cast<T>(0) && "Length must be non zero!");
+	if constexpr (Ohm::Math::IsApproximate<Accuracy, T>)
+	{
+		assert(LengthSqr() > static_cast<T>(0) && "Length must be non zero!");
+		const T invLength = Ohm::Math::InvSqrt<Accuracy>(LengthSqr());
+		x = x * invLength;
+		y = y * invLength;
+		z = z * invLength;
+		w = w * invLength;
+	}
+	else
+	{
+		T lenght = LengthWith<Accuracy>();
+		assert(Length() > static_cast<T>(0) && "Length must be non zero!");
 
-	x = x / lenght;
-	y = y / lenght;
-	z = z / lenght;
-	w = w / lenght;
+		x = x / lenght;
+		y = y / lenght;
+		z = z / lenght;
+		w = w / lenght;
+	}
 }
 
 template<class T>
-inline T Vector4<T>::Dot(const Vector4<T>& aVector) const
+constexpr T Vector4<T>::Dot(const Vector4<T>& aVector) const
 {
 	return (x * aVector.x) + (y * aVector.y) + (z * aVector.z) + (w * aVector.w);
 }
 
 template<class T>
-inline Vector4<T>::Vector4()
+constexpr Vector4<T>::Vector4()
 	: x(0), y(0), z(0), w(0)
 {
 }
 
 template<class T>
-inline Vector4<T>::Vector4(const T& aScalar)
+constexpr Vector4<T>::Vector4(const T& aScalar)
 	: x(aScalar), y(aScalar), z(aScalar), w(aScalar)
 {
 }
 
 template<class T>
-inline Vector4<T>::Vector4(const Vector3<T>& aVector, const T& aW)
+constexpr Vector4<T>::Vector4(const Vector3<T>& aVector, const T& aW)
+	: x(aVector.x), y(aVector.y), z(aVector.z), w(aW)
 {
-	x = aVector.x;
-	y = aVector.y;
-	z = aVector.z;
-
-	w = aW;
 }
 
 template<class T>
-inline Vector4<T>::Vector4(const Vector2<T>& aVectorOne, const Vector2<T>& aVectorTwo)
+constexpr Vector4<T>::Vector4(const Vector2<T>& aVectorOne, const Vector2<T>& aVectorTwo)
+	: x(aVectorOne.x), y(aVectorOne.y), z(aVectorTwo.x), w(aVectorTwo.y)
 {
-	x = aVectorOne.x;
-	y = aVectorOne.y;
-
-	z = aVectorTwo.x;
-	w = aVectorTwo.y;
 }
 
 template<class T>
-inline Vector4<T>::Vector4(const Vector2<T>& aVector, const T& aZ, const T& aW)
+constexpr Vector4<T>::Vector4(const Vector2<T>& aVector, const T& aZ, const T& aW)
+	: x(aVector.x), y(aVector.y), z(aZ), w(aW)
 {
-	x = aVector.x;
-	y = aVector.y;
-
-	z = aZ;
-	w = aW;
 }
 
 template<class T>
 template<typename U>
-inline Vector4<T>::Vector4(const U& aScalar)
+constexpr Vector4<T>::Vector4(const U& aScalar)
 	: x(static_cast<T>(aScalar)), y(static_cast<T>(aScalar)), z(static_cast<T>(aScalar)), w(static_cast<T>(aScalar))
 {
 }
 
 template<class T>
 template<typename U>
-inline Vector4<T>::Vector4(const U& aX, const U& aY, const U& aZ, const U& aW)
+constexpr Vector4<T>::Vector4(const U& aX, const U& aY, const U& aZ, const U& aW)
 	: x(static_cast<T>(aX)), y(static_cast<T>(aY)), z(static_cast<T>(aZ)), w(static_cast<T>(aW))
 {
 }
 
 template<class T>
-inline Vector4<T>::Vector4(const T& aX, const T& aY, const T& aZ, const T& aW)
+constexpr Vector4<T>::Vector4(const T& aX, const T& aY, const T& aZ, const T& aW)
 	: x(aX), y(aY), z(aZ), w(aW)
 {
-}
\ No newline at end of file
+}
+
+#include "Ohm/Vector/Vector4Simd.hpp"
\ No newline at end of file
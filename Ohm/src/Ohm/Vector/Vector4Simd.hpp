@@ -0,0 +1,335 @@
+#pragma once
+
+#include "Ohm/Utility/FastMath.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#if defined(OHM_SIMD_SSE2)
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+// SSE backed Vector4<float>.
+// Keeps the public API of the generic Vector4<T>, the components alias a single 16 byte aligned register.
+// During constant evaluation the register is never touched and the operators use the components instead.
+template<>
+class alignas(16) Vector4<float>
+{
+public:
+	constexpr Vector4<float>();
+	constexpr Vector4<float>(const float& aScalar);
+	constexpr Vector4<float>(const Vector3<float>& aVector, const float& aW);
+	constexpr Vector4<float>(const Vector2<float>& aVectorOne, const Vector2<float>& aVectorTwo);
+	constexpr Vector4<float>(const Vector2<float>& aVector, const float& aZ, const float& aW);
+	explicit constexpr Vector4<float>(__m128 aRegister);
+
+	template<typename U>
+	constexpr Vector4<float>(const U& aScalar);
+
+	template<typename U>
+	constexpr Vector4<float>(const U& aX, const U& aY, const U& aZ, const U& aW);
+	constexpr Vector4<float>(const float& aX, const float& aY, const float& aZ, const float& aW);
+
+	Vector4<float>(const Vector4<float>& aVector) = default;
+	Vector4<float>& operator=(const Vector4<float>& aVector) = default;
+	~Vector4<float>() = default;
+
+	constexpr float& operator[](int index);
+	constexpr const float& operator[](int index) const;
+
+	constexpr float& At(int index);
+	constexpr float LengthSqr() const;
+	// The With versions take the tier (see MathAccuracy), the approximate ones normalize with the SIMD InvSqrt.
+	constexpr float Length() const;
+	template<MathAccuracy Accuracy>
+	constexpr float LengthWith() const;
+	constexpr Vector4<float> GetNormalized() const;
+	template<MathAccuracy Accuracy>
+	constexpr Vector4<float> GetNormalizedWith() const;
+	constexpr void Normalize();
+	template<MathAccuracy Accuracy>
+	constexpr void NormalizeWith();
+	constexpr float Dot(const Vector4<float>& aVector) const;
+
+	union
+	{
+		__m128 myRegister;
+		struct
+		{
+			float x;
+			float y;
+			float z;
+			float w;
+		};
+	};
+};
+
+static_assert(sizeof(Vector4<float>) == 16, "Vector4<float> must map to exactly one SSE register!");
+
+constexpr Vector4<float> operator+(const Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Vector4<float>(aVector0.x + aVector1.x, aVector0.y + aVector1.y, aVector0.z + aVector1.z, aVector0.w + aVector1.w);
+	}
+	return Vector4<float>(_mm_add_ps(aVector0.myRegister, aVector1.myRegister));
+}
+
+constexpr Vector4<float> operator-(const Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Vector4<float>(aVector0.x - aVector1.x, aVector0.y - aVector1.y, aVector0.z - aVector1.z, aVector0.w - aVector1.w);
+	}
+	return Vector4<float>(_mm_sub_ps(aVector0.myRegister, aVector1.myRegister));
+}
+
+constexpr Vector4<float> operator*(const Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Vector4<float>(aVector0.x * aVector1.x, aVector0.y * aVector1.y, aVector0.z * aVector1.z, aVector0.w * aVector1.w);
+	}
+	return Vector4<float>(_mm_mul_ps(aVector0.myRegister, aVector1.myRegister));
+}
+
+constexpr Vector4<float> operator*(const Vector4<float>& aVector, const float& aScalar)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Vector4<float>(aVector.x * aScalar, aVector.y * aScalar, aVector.z * aScalar, aVector.w * aScalar);
+	}
+	return Vector4<float>(_mm_mul_ps(aVector.myRegister, _mm_set1_ps(aScalar)));
+}
+
+constexpr Vector4<float> operator*(const float& aScalar, const Vector4<float>& aVector)
+{
+	return aVector * aScalar;
+}
+
+template<typename U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector4<float>> operator*(const Vector4<float>& aVector, const U& aScalar)
+{
+	return aVector * static_cast<float>(aScalar);
+}
+
+template<typename U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector4<float>> operator*(const U& aScalar, const Vector4<float>& aVector)
+{
+	return aVector * static_cast<float>(aScalar);
+}
+
+constexpr Vector4<float> operator/(const Vector4<float>& aVector, const float& aScalar)
+{
+	assert((aScalar > 0.f || aScalar < 0.f) && "Scalar needs to be non-zero!");
+
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Vector4<float>(aVector.x / aScalar, aVector.y / aScalar, aVector.z / aScalar, aVector.w / aScalar);
+	}
+	return Vector4<float>(_mm_div_ps(aVector.myRegister, _mm_set1_ps(aScalar)));
+}
+
+template<typename U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>, Vector4<float>> operator/(const Vector4<float>& aVector, const U& aScalar)
+{
+	assert((aScalar > static_cast<U>(0) || aScalar < static_cast<U>(0)) && "Scalar needs to be non-zero!");
+
+	return aVector / static_cast<float>(aScalar);
+}
+
+constexpr void operator+=(Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	aVector0 = aVector0 + aVector1;
+}
+
+constexpr void operator-=(Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	aVector0 = aVector0 - aVector1;
+}
+
+constexpr void operator*=(Vector4<float>& aVector, const float& aScalar)
+{
+	aVector = aVector * aScalar;
+}
+
+template<typename U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>> operator*=(Vector4<float>& aVector, const U& aScalar)
+{
+	aVector *= static_cast<float>(aScalar);
+}
+
+constexpr void operator/=(Vector4<float>& aVector, const float& aScalar)
+{
+	aVector = aVector / aScalar;
+}
+
+template<typename U>
+constexpr std::enable_if_t<std::is_arithmetic_v<U>> operator/=(Vector4<float>& aVector, const U& aScalar)
+{
+	aVector = aVector / aScalar;
+}
+
+constexpr bool operator==(const Vector4<float>& aVector0, const Vector4<float>& aVector1)
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return aVector0.x == aVector1.x && aVector0.y == aVector1.y && aVector0.z == aVector1.z && aVector0.w == aVector1.w;
+	}
+	return _mm_movemask_ps(_mm_cmpeq_ps(aVector0.myRegister, aVector1.myRegister)) == 0xF;
+}
+
+constexpr float& Vector4<float>::operator[](int index)
+{
+	assert(index >= 0 && index < 4 && "Index out of bounds!");
+
+	switch (index)
+	{
+		case 0: return x;
+		case 1: return y;
+		case 2: return z;
+		case 3: return w;
+	}
+
+	return x;
+}
+
+constexpr const float& Vector4<float>::operator[](int index) const
+{
+	assert(index >= 0 && index < 4 && "Index out of bounds!");
+
+	switch (index)
+	{
+		case 0: return x;
+		case 1: return y;
+		case 2: return z;
+		case 3: return w;
+	}
+
+	return x;
+}
+
+constexpr float& Vector4<float>::At(int index)
+{
+	return (*this)[index];
+}
+
+constexpr float Vector4<float>::LengthSqr() const
+{
+	return Dot(*this);
+}
+
+constexpr float Vector4<float>::Length() const
+{
+	return LengthWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<MathAccuracy Accuracy>
+constexpr float Vector4<float>::LengthWith() const
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return Ohm::Math::Sqrt(Dot(*this));
+	}
+	if constexpr (Accuracy != MathAccuracy::Exact)
+	{
+		return Ohm::Math::Sqrt<Accuracy>(_mm_cvtss_f32(Ohm::Simd::Dot4(myRegister, myRegister)));
+	}
+	return _mm_cvtss_f32(_mm_sqrt_ss(Ohm::Simd::Dot4(myRegister, myRegister)));
+}
+
+constexpr Vector4<float> Vector4<float>::GetNormalized() const
+{
+	return GetNormalizedWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<MathAccuracy Accuracy>
+constexpr Vector4<float> Vector4<float>::GetNormalizedWith() const
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return *this / Length();
+	}
+
+	if constexpr (Accuracy != MathAccuracy::Exact)
+	{
+		const __m128 lengthSqr = Ohm::Simd::Dot4(myRegister, myRegister);
+		assert(_mm_cvtss_f32(lengthSqr) > 0.f && "Length must be non zero!");
+
+		return Vector4<float>(_mm_mul_ps(myRegister, Ohm::Simd::InvSqrt<Accuracy>(lengthSqr)));
+	}
+
+	const __m128 length = _mm_sqrt_ps(Ohm::Simd::Dot4(myRegister, myRegister));
+	assert(_mm_cvtss_f32(length) > 0.f && "Length must be non zero!");
+
+	return Vector4<float>(_mm_div_ps(myRegister, length));
+}
+
+constexpr void Vector4<float>::Normalize()
+{
+	NormalizeWith<Ohm::Math::DefaultAccuracy>();
+}
+
+template<MathAccuracy Accuracy>
+constexpr void Vector4<float>::NormalizeWith()
+{
+	*this = GetNormalizedWith<Accuracy>();
+}
+
+constexpr float Vector4<float>::Dot(const Vector4<float>& aVector) const
+{
+	if (OHM_IS_CONSTANT_EVALUATED())
+	{
+		return x * aVector.x + y * aVector.y + z * aVector.z + w * aVector.w;
+	}
+	return _mm_cvtss_f32(Ohm::Simd::Dot4(myRegister, aVector.myRegister));
+}
+
+constexpr Vector4<float>::Vector4()
+	: x(0.f), y(0.f), z(0.f), w(0.f)
+{
+}
+
+constexpr Vector4<float>::Vector4(const float& aScalar)
+	: x(aScalar), y(aScalar), z(aScalar), w(aScalar)
+{
+}
+
+constexpr Vector4<float>::Vector4(const Vector3<float>& aVector, const float& aW)
+	: x(aVector.x), y(aVector.y), z(aVector.z), w(aW)
+{
+}
+
+constexpr Vector4<float>::Vector4(const Vector2<float>& aVectorOne, const Vector2<float>& aVectorTwo)
+	: x(aVectorOne.x), y(aVectorOne.y), z(aVectorTwo.x), w(aVectorTwo.y)
+{
+}
+
+constexpr Vector4<float>::Vector4(const Vector2<float>& aVector, const float& aZ, const float& aW)
+	: x(aVector.x), y(aVector.y), z(aZ), w(aW)
+{
+}
+
+constexpr Vector4<float>::Vector4(__m128 aRegister)
+	: myRegister(aRegister)
+{
+}
+
+template<typename U>
+constexpr Vector4<float>::Vector4(const U& aScalar)
+	: x(static_cast<float>(aScalar)), y(static_cast<float>(aScalar)), z(static_cast<float>(aScalar)), w(static_cast<float>(aScalar))
+{
+}
+
+template<typename U>
+constexpr Vector4<float>::Vector4(const U& aX, const U& aY, const U& aZ, const U& aW)
+	: x(static_cast<float>(aX)), y(static_cast<float>(aY)), z(static_cast<float>(aZ)), w(static_cast<float>(aW))
+{
+}
+
+constexpr Vector4<float>::Vector4(const float& aX, const float& aY, const float& aZ, const float& aW)
+	: x(aX), y(aY), z(aZ), w(aW)
+{
+}
+
+#endif
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "Ohm/Vector/Vector4.hpp"
+#include "Ohm/Utility/Memory.hpp"
+#include "Ohm/Utility/Parallel.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// Non-owning view over four separate x/y/z/w streams.
+template<typename T>
+struct Vector4SoAView
+{
+	const T* x = nullptr;
+	const T* y = nullptr;
+	const T* z = nullptr;
+	const T* w = nullptr;
+	size_t size = 0;
+
+	Vector4<T> operator[](size_t aIndex) const
+	{
+		assert(aIndex < size && "Index out of bounds!");
+		return Vector4<T>(x[aIndex], y[aIndex], z[aIndex], w[aIndex]);
+	}
+};
+
+// Structure-of-arrays storage for Vector4<T>.
+// Each stream is Ohm::Simd::Alignment aligned and padded to a whole cache line, so the float kernels run
+// over full SIMD registers without a scalar tail. Padding elements are not part of the contents.
+template<typename T>
+class Vector4SoA
+{
+public:
+	Vector4SoA<T>() = default;
+	Vector4SoA<T>(size_t aSize);
+	Vector4SoA<T>(const Vector4<T>* aVectors, size_t aCount);
+
+	Vector4SoA<T>(const Vector4SoA<T>& aOther);
+	Vector4SoA<T>(Vector4SoA<T>&& aOther) noexcept;
+	Vector4SoA<T>& operator=(Vector4SoA<T> aOther);
+	~Vector4SoA<T>();
+
+	Vector4<T> operator[](size_t aIndex) const;
+	void Set(size_t aIndex, const Vector4<T>& aVector);
+
+	void Resize(size_t aSize);
+	size_t Size() const { return mySize; }
+	size_t PaddedSize() const { return Ohm::Simd::PaddedCount<T>(mySize); }
+
+	T* X() { return myX; }
+	T* Y() { return myY; }
+	T* Z() { return myZ; }
+	T* W() { return myW; }
+	const T* X() const { return myX; }
+	const T* Y() const { return myY; }
+	const T* Z() const { return myZ; }
+	const T* W() const { return myW; }
+
+	Vector4SoAView<T> GetView() const { return { myX, myY, myZ, myW, mySize }; }
+
+	// Element-wise kernels, aOut is resized to match and may be one of the inputs.
+	static void Add(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut);
+	static void Subtract(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut);
+	static void Multiply(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut);
+	static void Multiply(const Vector4SoA<T>& aA, T aScalar, Vector4SoA<T>& aOut);
+
+	// aOut = aA * aB + aC
+	static void MultiplyAdd(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, const Vector4SoA<T>& aC, Vector4SoA<T>& aOut);
+	// aPool splits the work into chunks on cache line boundaries, the result is the same without it.
+	static void Normalize(const Vector4SoA<T>& aA, Vector4SoA<T>& aOut, ThreadPool* aPool = nullptr);
+
+	// Writes Size() scalars to aOut.
+	static void Dot(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, T* aOut);
+	static void Length(const Vector4SoA<T>& aA, T* aOut);
+
+private:
+	void Allocate(size_t aCapacity);
+	void Release();
+
+	T* myX = nullptr;
+	T* myY = nullptr;
+	T* myZ = nullptr;
+	T* myW = nullptr;
+	size_t mySize = 0;
+	size_t myCapacity = 0;
+};
+
+template<typename T>
+inline Vector4SoA<T>::Vector4SoA(size_t aSize)
+{
+	Resize(aSize);
+}
+
+template<typename T>
+inline Vector4SoA<T>::Vector4SoA(const Vector4<T>* aVectors, size_t aCount)
+{
+	Resize(aCount);
+	for (size_t i = 0; i < aCount; i++)
+	{
+		Set(i, aVectors[i]);
+	}
+}
+
+template<typename T>
+inline Vector4SoA<T>::Vector4SoA(const Vector4SoA<T>& aOther)
+{
+	Resize(aOther.mySize);
+	std::copy(aOther.myX, aOther.myX + mySize, myX);
+	std::copy(aOther.myY, aOther.myY + mySize, myY);
+	std::copy(aOther.myZ, aOther.myZ + mySize, myZ);
+	std::copy(aOther.myW, aOther.myW + mySize, myW);
+}
+
+template<typename T>
+inline Vector4SoA<T>::Vector4SoA(Vector4SoA<T>&& aOther) noexcept
+	: myX(std::exchange(aOther.myX, nullptr)), myY(std::exchange(aOther.myY, nullptr)), myZ(std::exchange(aOther.myZ, nullptr)), myW(std::exchange(aOther.myW, nullptr)),
+	mySize(std::exchange(aOther.mySize, 0)), myCapacity(std::exchange(aOther.myCapacity, 0))
+{
+}
+
+template<typename T>
+inline Vector4SoA<T>& Vector4SoA<T>::operator=(Vector4SoA<T> aOther)
+{
+	std::swap(myX, aOther.myX);
+	std::swap(myY, aOther.myY);
+	std::swap(myZ, aOther.myZ);
+	std::swap(myW, aOther.myW);
+	std::swap(mySize, aOther.mySize);
+	std::swap(myCapacity, aOther.myCapacity);
+
+	return *this;
+}
+
+template<typename T>
+inline Vector4SoA<T>::~Vector4SoA()
+{
+	Release();
+}
+
+template<typename T>
+inline Vector4<T> Vector4SoA<T>::operator[](size_t aIndex) const
+{
+	assert(aIndex < mySize && "Index out of bounds!");
+	return Vector4<T>(myX[aIndex], myY[aIndex], myZ[aIndex], myW[aIndex]);
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Set(size_t aIndex, const Vector4<T>& aVector)
+{
+	assert(aIndex < mySize && "Index out of bounds!");
+
+	myX[aIndex] = aVector.x;
+	myY[aIndex] = aVector.y;
+	myZ[aIndex] = aVector.z;
+	myW[aIndex] = aVector.w;
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Resize(size_t aSize)
+{
+	const size_t padded = Ohm::Simd::PaddedCount<T>(aSize);
+	if (padded > myCapacity)
+	{
+		Vector4SoA<T> old(std::move(*this));
+		Allocate(padded);
+
+		std::copy(old.myX, old.myX + old.mySize, myX);
+		std::copy(old.myY, old.myY + old.mySize, myY);
+		std::copy(old.myZ, old.myZ + old.mySize, myZ);
+		std::copy(old.myW, old.myW + old.mySize, myW);
+		std::fill(myX + old.mySize, myX + myCapacity, static_cast<T>(0));
+		std::fill(myY + old.mySize, myY + myCapacity, static_cast<T>(0));
+		std::fill(myZ + old.mySize, myZ + myCapacity, static_cast<T>(0));
+		std::fill(myW + old.mySize, myW + myCapacity, static_cast<T>(0));
+	}
+	else if (aSize > mySize)
+	{
+		std::fill(myX + mySize, myX + aSize, static_cast<T>(0));
+		std::fill(myY + mySize, myY + aSize, static_cast<T>(0));
+		std::fill(myZ + mySize, myZ + aSize, static_cast<T>(0));
+		std::fill(myW + mySize, myW + aSize, static_cast<T>(0));
+	}
+
+	mySize = aSize;
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Allocate(size_t aCapacity)
+{
+	// One block holds all four streams, each starting on its own cache line.
+	T* block = static_cast<T*>(Ohm::Memory::AllocateAligned(aCapacity * 4 * sizeof(T)));
+	myX = block;
+	myY = block + aCapacity;
+	myZ = block + aCapacity * 2;
+	myW = block + aCapacity * 3;
+	myCapacity = aCapacity;
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Release()
+{
+	Ohm::Memory::FreeAligned(myX, myCapacity * 4 * sizeof(T));
+
+	myX = myY = myZ = myW = nullptr;
+	mySize = myCapacity = 0;
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Add(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut)
+{
+	assert(aA.mySize == aB.mySize && "Sizes must match!");
+	aOut.Resize(aA.mySize);
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		Lane::Store(aOut.myX + i, Lane::Add(Lane::Load(aA.myX + i), Lane::Load(aB.myX + i)));
+		Lane::Store(aOut.myY + i, Lane::Add(Lane::Load(aA.myY + i), Lane::Load(aB.myY + i)));
+		Lane::Store(aOut.myZ + i, Lane::Add(Lane::Load(aA.myZ + i), Lane::Load(aB.myZ + i)));
+		Lane::Store(aOut.myW + i, Lane::Add(Lane::Load(aA.myW + i), Lane::Load(aB.myW + i)));
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Subtract(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut)
+{
+	assert(aA.mySize == aB.mySize && "Sizes must match!");
+	aOut.Resize(aA.mySize);
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		Lane::Store(aOut.myX + i, Lane::Subtract(Lane::Load(aA.myX + i), Lane::Load(aB.myX + i)));
+		Lane::Store(aOut.myY + i, Lane::Subtract(Lane::Load(aA.myY + i), Lane::Load(aB.myY + i)));
+		Lane::Store(aOut.myZ + i, Lane::Subtract(Lane::Load(aA.myZ + i), Lane::Load(aB.myZ + i)));
+		Lane::Store(aOut.myW + i, Lane::Subtract(Lane::Load(aA.myW + i), Lane::Load(aB.myW + i)));
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Multiply(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, Vector4SoA<T>& aOut)
+{
+	assert(aA.mySize == aB.mySize && "Sizes must match!");
+	aOut.Resize(aA.mySize);
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		Lane::Store(aOut.myX + i, Lane::Multiply(Lane::Load(aA.myX + i), Lane::Load(aB.myX + i)));
+		Lane::Store(aOut.myY + i, Lane::Multiply(Lane::Load(aA.myY + i), Lane::Load(aB.myY + i)));
+		Lane::Store(aOut.myZ + i, Lane::Multiply(Lane::Load(aA.myZ + i), Lane::Load(aB.myZ + i)));
+		Lane::Store(aOut.myW + i, Lane::Multiply(Lane::Load(aA.myW + i), Lane::Load(aB.myW + i)));
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Multiply(const Vector4SoA<T>& aA, T aScalar, Vector4SoA<T>& aOut)
+{
+	aOut.Resize(aA.mySize);
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		const auto scalar = Lane::Set(aScalar);
+		Lane::Store(aOut.myX + i, Lane::Multiply(Lane::Load(aA.myX + i), scalar));
+		Lane::Store(aOut.myY + i, Lane::Multiply(Lane::Load(aA.myY + i), scalar));
+		Lane::Store(aOut.myZ + i, Lane::Multiply(Lane::Load(aA.myZ + i), scalar));
+		Lane::Store(aOut.myW + i, Lane::Multiply(Lane::Load(aA.myW + i), scalar));
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::MultiplyAdd(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, const Vector4SoA<T>& aC, Vector4SoA<T>& aOut)
+{
+	assert(aA.mySize == aB.mySize && aA.mySize == aC.mySize && "Sizes must match!");
+	aOut.Resize(aA.mySize);
+
+	Ohm::Simd::ForEachLane<T>(aA.PaddedSize(), [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		Lane::Store(aOut.myX + i, Lane::MultiplyAdd(Lane::Load(aA.myX + i), Lane::Load(aB.myX + i), Lane::Load(aC.myX + i)));
+		Lane::Store(aOut.myY + i, Lane::MultiplyAdd(Lane::Load(aA.myY + i), Lane::Load(aB.myY + i), Lane::Load(aC.myY + i)));
+		Lane::Store(aOut.myZ + i, Lane::MultiplyAdd(Lane::Load(aA.myZ + i), Lane::Load(aB.myZ + i), Lane::Load(aC.myZ + i)));
+		Lane::Store(aOut.myW + i, Lane::MultiplyAdd(Lane::Load(aA.myW + i), Lane::Load(aB.myW + i), Lane::Load(aC.myW + i)));
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Normalize(const Vector4SoA<T>& aA, Vector4SoA<T>& aOut, ThreadPool* aPool)
+{
+	aOut.Resize(aA.mySize);
+
+	// Only the real elements, normalizing the zeroed padding would fill it with NaN.
+	Ohm::Detail::ParallelFor(aPool, aA.mySize, Ohm::Detail::ParallelGrain(sizeof(T) * 8), [&](size_t aBegin, size_t aEnd)
+	{
+		Ohm::Simd::ForEachLane<T>(aEnd - aBegin, [&](auto aLane, size_t aOffset)
+		{
+			using Lane = decltype(aLane);
+			const size_t i = aBegin + aOffset;
+			const auto x = Lane::Load(aA.myX + i);
+			const auto y = Lane::Load(aA.myY + i);
+			const auto z = Lane::Load(aA.myZ + i);
+			const auto w = Lane::Load(aA.myW + i);
+			const auto length = Lane::Sqrt(Lane::MultiplyAdd(w, w, Lane::MultiplyAdd(z, z, Lane::MultiplyAdd(y, y, Lane::Multiply(x, x)))));
+
+			Lane::Store(aOut.myX + i, Lane::Divide(x, length));
+			Lane::Store(aOut.myY + i, Lane::Divide(y, length));
+			Lane::Store(aOut.myZ + i, Lane::Divide(z, length));
+			Lane::Store(aOut.myW + i, Lane::Divide(w, length));
+		});
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Dot(const Vector4SoA<T>& aA, const Vector4SoA<T>& aB, T* aOut)
+{
+	assert(aA.mySize == aB.mySize && "Sizes must match!");
+
+	Ohm::Simd::ForEachLane<T>(aA.mySize, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		auto dot = Lane::Multiply(Lane::Load(aA.myX + i), Lane::Load(aB.myX + i));
+		dot = Lane::MultiplyAdd(Lane::Load(aA.myY + i), Lane::Load(aB.myY + i), dot);
+		dot = Lane::MultiplyAdd(Lane::Load(aA.myZ + i), Lane::Load(aB.myZ + i), dot);
+		dot = Lane::MultiplyAdd(Lane::Load(aA.myW + i), Lane::Load(aB.myW + i), dot);
+		Lane::Store(aOut + i, dot);
+	});
+}
+
+template<typename T>
+inline void Vector4SoA<T>::Length(const Vector4SoA<T>& aA, T* aOut)
+{
+	Ohm::Simd::ForEachLane<T>(aA.mySize, [&](auto aLane, size_t i)
+	{
+		using Lane = decltype(aLane);
+		const auto x = Lane::Load(aA.myX + i);
+		const auto y = Lane::Load(aA.myY + i);
+		const auto z = Lane::Load(aA.myZ + i);
+		const auto w = Lane::Load(aA.myW + i);
+		Lane::Store(aOut + i, Lane::Sqrt(Lane::MultiplyAdd(w, w, Lane::MultiplyAdd(z, z, Lane::MultiplyAdd(y, y, Lane::Multiply(x, x))))));
+	});
+}
@@ -0,0 +1,421 @@
+#pragma once
+
+#include "Ohm/Vector/Vector4.hpp"
+#include "Ohm/Utility/Math.hpp"
+#include "Ohm/Utility/Simd.hpp"
+
+#include <type_traits>
+
+// Opt-in expression templates for Vector2, Vector3 and Vector4.
+// Ohm::Lazy(aVector) starts an expression. The operators on it only record their operands, and Evaluate()
+// computes the whole expression in one pass without intermediate vectors:
+//
+//   const Vector3<float> result = (Ohm::Lazy(a) * s + Ohm::Lazy(b) * t - c).Evaluate();
+//   accumulator += Ohm::Lazy(velocity) * deltaTime;
+//
+// x * y + z and x * y - z are fused into Ohm::Math::MultiplyAdd, a single FMA when OHM_SIMD_FMA is defined.
+// Vector4<float> expressions are evaluated in one SSE register per node.
+// Every node is force inlined so Debug builds also collapse an expression into straight line code.
+// Vectors are held by reference, so an expression must not outlive the vectors it was built from.
+namespace Ohm::Expression
+{
+	template<typename V>
+	struct VectorTraits
+	{
+		static constexpr bool IsVector = false;
+	};
+
+	template<typename T>
+	struct VectorTraits<Vector2<T>>
+	{
+		static constexpr bool IsVector = true;
+		static constexpr int Size = 2;
+		using Scalar = T;
+	};
+
+	template<typename T>
+	struct VectorTraits<Vector3<T>>
+	{
+		static constexpr bool IsVector = true;
+		static constexpr int Size = 3;
+		using Scalar = T;
+	};
+
+	template<typename T>
+	struct VectorTraits<Vector4<T>>
+	{
+		static constexpr bool IsVector = true;
+		static constexpr int Size = 4;
+		using Scalar = T;
+	};
+
+	template<int I, typename V>
+	OHM_FORCE_INLINE constexpr typename VectorTraits<V>::Scalar Component(const V& aVector)
+	{
+		if constexpr (I == 0)
+		{
+			return aVector.x;
+		}
+		else if constexpr (I == 1)
+		{
+			return aVector.y;
+		}
+		else if constexpr (I == 2)
+		{
+			return aVector.z;
+		}
+		else
+		{
+			return aVector.w;
+		}
+	}
+
+	// Base of every node that produces a vector, Derived provides VectorType, Scalar, Get<I>() and GetRegister().
+	template<typename Derived>
+	class VectorExpression
+	{
+	public:
+		OHM_FORCE_INLINE constexpr auto Evaluate() const;
+	};
+
+	template<typename E>
+	constexpr bool IsExpression = std::is_base_of_v<VectorExpression<E>, E>;
+
+	template<typename V>
+	class Reference : public VectorExpression<Reference<V>>
+	{
+	public:
+		using VectorType = V;
+		using Scalar = typename VectorTraits<V>::Scalar;
+
+		OHM_FORCE_INLINE constexpr explicit Reference(const V& aVector)
+			: myVector(aVector)
+		{
+		}
+
+		template<int I>
+		OHM_FORCE_INLINE constexpr Scalar Get() const
+		{
+			return Component<I>(myVector);
+		}
+
+#if defined(OHM_SIMD_SSE2)
+		OHM_FORCE_INLINE __m128 GetRegister() const
+		{
+			return myVector.myRegister;
+		}
+#endif
+
+	private:
+		const V& myVector;
+	};
+
+	// A scalar operand, broadcast to every component.
+	template<typename T>
+	class ScalarValue
+	{
+	public:
+		using VectorType = void;
+		using Scalar = T;
+
+		OHM_FORCE_INLINE constexpr explicit ScalarValue(T aValue)
+			: myValue(aValue)
+		{
+		}
+
+		template<int I>
+		OHM_FORCE_INLINE constexpr Scalar Get() const
+		{
+			return myValue;
+		}
+
+#if defined(OHM_SIMD_SSE2)
+		OHM_FORCE_INLINE __m128 GetRegister() const
+		{
+			return _mm_set1_ps(myValue);
+		}
+#endif
+
+	private:
+		T myValue;
+	};
+
+	struct Add
+	{
+		template<typename T>
+		static OHM_FORCE_INLINE constexpr T Apply(T aA, T aB) { return aA + aB; }
+
+#if defined(OHM_SIMD_SSE2)
+		static OHM_FORCE_INLINE __m128 ApplyRegister(__m128 aA, __m128 aB) { return _mm_add_ps(aA, aB); }
+#endif
+	};
+
+	struct Subtract
+	{
+		template<typename T>
+		static OHM_FORCE_INLINE constexpr T Apply(T aA, T aB) { return aA - aB; }
+
+#if defined(OHM_SIMD_SSE2)
+		static OHM_FORCE_INLINE __m128 ApplyRegister(__m128 aA, __m128 aB) { return _mm_sub_ps(aA, aB); }
+#endif
+	};
+
+	struct Multiply
+	{
+		template<typename T>
+		static OHM_FORCE_INLINE constexpr T Apply(T aA, T aB) { return aA * aB; }
+
+#if defined(OHM_SIMD_SSE2)
+		static OHM_FORCE_INLINE __m128 ApplyRegister(__m128 aA, __m128 aB) { return _mm_mul_ps(aA, aB); }
+#endif
+	};
+
+	struct Divide
+	{
+		template<typename T>
+		static OHM_FORCE_INLINE constexpr T Apply(T aA, T aB) { return aA / aB; }
+
+#if defined(OHM_SIMD_SSE2)
+		static OHM_FORCE_INLINE __m128 ApplyRegister(__m128 aA, __m128 aB) { return _mm_div_ps(aA, aB); }
+#endif
+	};
+
+	template<typename Operation, typename L, typename R>
+	class Binary;
+
+	template<typename E>
+	constexpr bool IsProduct = false;
+
+	template<typename L, typename R>
+	constexpr bool IsProduct<Binary<Multiply, L, R>> = true;
+
+	template<typename Operation, typename L, typename R>
+	class Binary : public VectorExpression<Binary<Operation, L, R>>
+	{
+	public:
+		using VectorType = std::conditional_t<std::is_void_v<typename L::VectorType>, typename R::VectorType, typename L::VectorType>;
+		using Scalar = typename L::Scalar;
+
+		static_assert(std::is_void_v<typename L::VectorType> || std::is_void_v<typename R::VectorType> ||
+			std::is_same_v<typename L::VectorType, typename R::VectorType>, "Both operands must be the same vector type!");
+
+		OHM_FORCE_INLINE constexpr Binary(const L& aLeft, const R& aRight)
+			: myLeft(aLeft), myRight(aRight)
+		{
+		}
+
+		OHM_FORCE_INLINE constexpr const L& GetLeft() const { return myLeft; }
+		OHM_FORCE_INLINE constexpr const R& GetRight() const { return myRight; }
+
+		template<int I>
+		OHM_FORCE_INLINE constexpr Scalar Get() const
+		{
+			if constexpr (std::is_same_v<Operation, Add> && IsProduct<L>)
+			{
+				return Ohm::Math::MultiplyAdd(myLeft.GetLeft().template Get<I>(), myLeft.GetRight().template Get<I>(), myRight.template Get<I>());
+			}
+			else if constexpr (std::is_same_v<Operation, Add> && IsProduct<R>)
+			{
+				return Ohm::Math::MultiplyAdd(myRight.GetLeft().template Get<I>(), myRight.GetRight().template Get<I>(), myLeft.template Get<I>());
+			}
+			else if constexpr (std::is_same_v<Operation, Subtract> && IsProduct<L>)
+			{
+				return Ohm::Math::MultiplyAdd(myLeft.GetLeft().template Get<I>(), myLeft.GetRight().template Get<I>(), -myRight.template Get<I>());
+			}
+			else if constexpr (std::is_same_v<Operation, Subtract> && IsProduct<R>)
+			{
+				return Ohm::Math::MultiplyAdd(-myRight.GetLeft().template Get<I>(), myRight.GetRight().template Get<I>(), myLeft.template Get<I>());
+			}
+			else
+			{
+				return Operation::Apply(myLeft.template Get<I>(), myRight.template Get<I>());
+			}
+		}
+
+#if defined(OHM_SIMD_SSE2)
+		OHM_FORCE_INLINE __m128 GetRegister() const
+		{
+			if constexpr (std::is_same_v<Operation, Add> && IsProduct<L>)
+			{
+				return Ohm::Simd::MultiplyAdd(myLeft.GetLeft().GetRegister(), myLeft.GetRight().GetRegister(), myRight.GetRegister());
+			}
+			else if constexpr (std::is_same_v<Operation, Add> && IsProduct<R>)
+			{
+				return Ohm::Simd::MultiplyAdd(myRight.GetLeft().GetRegister(), myRight.GetRight().GetRegister(), myLeft.GetRegister());
+			}
+			else if constexpr (std::is_same_v<Operation, Subtract> && IsProduct<L>)
+			{
+				return Ohm::Simd::MultiplyAdd(myLeft.GetLeft().GetRegister(), myLeft.GetRight().GetRegister(), _mm_xor_ps(myRight.GetRegister(), _mm_set1_ps(-0.f)));
+			}
+			else if constexpr (std::is_same_v<Operation, Subtract> && IsProduct<R>)
+			{
+				return Ohm::Simd::MultiplyAdd(_mm_xor_ps(myRight.GetLeft().GetRegister(), _mm_set1_ps(-0.f)), myRight.GetRight().GetRegister(), myLeft.GetRegister());
+			}
+			else
+			{
+				return Operation::ApplyRegister(myLeft.GetRegister(), myRight.GetRegister());
+			}
+		}
+#endif
+
+	private:
+		L myLeft;
+		R myRight;
+	};
+
+	template<typename E>
+	class Negate : public VectorExpression<Negate<E>>
+	{
+	public:
+		using VectorType = typename E::VectorType;
+		using Scalar = typename E::Scalar;
+
+		OHM_FORCE_INLINE constexpr explicit Negate(const E& aOperand)
+			: myOperand(aOperand)
+		{
+		}
+
+		template<int I>
+		OHM_FORCE_INLINE constexpr Scalar Get() const
+		{
+			return -myOperand.template Get<I>();
+		}
+
+#if defined(OHM_SIMD_SSE2)
+		OHM_FORCE_INLINE __m128 GetRegister() const
+		{
+			return _mm_xor_ps(myOperand.GetRegister(), _mm_set1_ps(-0.f));
+		}
+#endif
+
+	private:
+		E myOperand;
+	};
+
+	template<typename Derived>
+	OHM_FORCE_INLINE constexpr auto VectorExpression<Derived>::Evaluate() const
+	{
+		using V = typename Derived::VectorType;
+		const Derived& expression = static_cast<const Derived&>(*this);
+
+#if defined(OHM_SIMD_SSE2)
+		if constexpr (std::is_same_v<V, Vector4<float>>)
+		{
+			if (!OHM_IS_CONSTANT_EVALUATED())
+			{
+				return Vector4<float>(expression.GetRegister());
+			}
+		}
+#endif
+
+		if constexpr (VectorTraits<V>::Size == 2)
+		{
+			return V(expression.template Get<0>(), expression.template Get<1>());
+		}
+		else if constexpr (VectorTraits<V>::Size == 3)
+		{
+			return V(expression.template Get<0>(), expression.template Get<1>(), expression.template Get<2>());
+		}
+		else
+		{
+			return V(expression.template Get<0>(), expression.template Get<1>(), expression.template Get<2>(), expression.template Get<3>());
+		}
+	}
+
+	namespace Detail
+	{
+		template<typename X>
+		constexpr bool IsVectorOperand = IsExpression<X> || VectorTraits<X>::IsVector;
+
+		// Every operator needs at least one expression, plain vector arithmetic keeps using the eager operators.
+		template<typename L, typename R>
+		constexpr bool IsVectorPair = (IsExpression<L> && IsVectorOperand<R>) || (IsVectorOperand<L> && IsExpression<R>);
+
+		template<typename L, typename R>
+		constexpr bool IsScaledPair = (IsExpression<L> && std::is_arithmetic_v<R>) || (std::is_arithmetic_v<L> && IsExpression<R>);
+
+		template<typename X>
+		using ScalarOf = typename std::conditional_t<IsExpression<X>, X, VectorTraits<X>>::Scalar;
+
+		// Wraps plain vectors and scalars so every operand of a node is itself a node.
+		template<typename Scalar, typename X>
+		OHM_FORCE_INLINE constexpr auto ToNode(const X& aOperand)
+		{
+			if constexpr (IsExpression<X>)
+			{
+				return aOperand;
+			}
+			else if constexpr (VectorTraits<X>::IsVector)
+			{
+				return Reference<X>(aOperand);
+			}
+			else
+			{
+				return ScalarValue<Scalar>(static_cast<Scalar>(aOperand));
+			}
+		}
+
+		template<typename Operation, typename L, typename R>
+		OHM_FORCE_INLINE constexpr auto MakeBinary(const L& aLeft, const R& aRight)
+		{
+			using Scalar = ScalarOf<std::conditional_t<IsExpression<L>, L, R>>;
+			using LeftNode = decltype(ToNode<Scalar>(aLeft));
+			using RightNode = decltype(ToNode<Scalar>(aRight));
+
+			return Binary<Operation, LeftNode, RightNode>(ToNode<Scalar>(aLeft), ToNode<Scalar>(aRight));
+		}
+	}
+
+	template<typename L, typename R, typename = std::enable_if_t<Detail::IsVectorPair<L, R>>>
+	OHM_FORCE_INLINE constexpr auto operator+(const L& aLeft, const R& aRight)
+	{
+		return Detail::MakeBinary<Add>(aLeft, aRight);
+	}
+
+	template<typename L, typename R, typename = std::enable_if_t<Detail::IsVectorPair<L, R>>>
+	OHM_FORCE_INLINE constexpr auto operator-(const L& aLeft, const R& aRight)
+	{
+		return Detail::MakeBinary<Subtract>(aLeft, aRight);
+	}
+
+	// Component wise product of two vectors, or a vector scaled by a scalar.
+	template<typename L, typename R, typename = std::enable_if_t<Detail::IsVectorPair<L, R> || Detail::IsScaledPair<L, R>>>
+	OHM_FORCE_INLINE constexpr auto operator*(const L& aLeft, const R& aRight)
+	{
+		return Detail::MakeBinary<Multiply>(aLeft, aRight);
+	}
+
+	template<typename L, typename R, typename = std::enable_if_t<IsExpression<L> && std::is_arithmetic_v<R>>>
+	OHM_FORCE_INLINE constexpr auto operator/(const L& aLeft, const R& aRight)
+	{
+		return Detail::MakeBinary<Divide>(aLeft, aRight);
+	}
+
+	template<typename E, typename = std::enable_if_t<IsExpression<E>>>
+	OHM_FORCE_INLINE constexpr Negate<E> operator-(const E& aOperand)
+	{
+		return Negate<E>(aOperand);
+	}
+
+	template<typename V, typename E, typename = std::enable_if_t<VectorTraits<V>::IsVector && IsExpression<E>>>
+	OHM_FORCE_INLINE constexpr void operator+=(V& aVector, const E& aExpression)
+	{
+		aVector = (Reference<V>(aVector) + aExpression).Evaluate();
+	}
+
+	template<typename V, typename E, typename = std::enable_if_t<VectorTraits<V>::IsVector && IsExpression<E>>>
+	OHM_FORCE_INLINE constexpr void operator-=(V& aVector, const E& aExpression)
+	{
+		aVector = (Reference<V>(aVector) - aExpression).Evaluate();
+	}
+}
+
+namespace Ohm
+{
+	// Starts an expression over aVector, see Ohm/Vector/VectorExpression.hpp.
+	template<typename V, typename = std::enable_if_t<Expression::VectorTraits<V>::IsVector>>
+	OHM_FORCE_INLINE constexpr Expression::Reference<V> Lazy(const V& aVector)
+	{
+		return Expression::Reference<V>(aVector);
+	}
+}
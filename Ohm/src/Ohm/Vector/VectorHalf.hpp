@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Ohm/Utility/Half.hpp"
+#include "Ohm/Vector/Vector3.hpp"
+#include "Ohm/Vector/Vector4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Half precision storage for vertex and animation streams, half the size of the float vectors.
+// Components are IEEE binary16 bit patterns, see Ohm/Utility/Half.hpp for the error bounds.
+// Convert to Vector3<float>/Vector4<float> to do math, or use the array functions below for whole streams.
+class Vector3Half
+{
+public:
+	Vector3Half() = default;
+	explicit Vector3Half(const Vector3<float>& aVector);
+
+	Vector3<float> ToVector3() const;
+
+	uint16_t x;
+	uint16_t y;
+	uint16_t z;
+};
+
+class Vector4Half
+{
+public:
+	Vector4Half() = default;
+	explicit Vector4Half(const Vector4<float>& aVector);
+
+	Vector4<float> ToVector4() const;
+
+	uint16_t x;
+	uint16_t y;
+	uint16_t z;
+	uint16_t w;
+};
+
+inline Vector3Half::Vector3Half(const Vector3<float>& aVector)
+	: x(Ohm::Math::FloatToHalf(aVector.x)), y(Ohm::Math::FloatToHalf(aVector.y)), z(Ohm::Math::FloatToHalf(aVector.z))
+{
+}
+
+inline Vector3<float> Vector3Half::ToVector3() const
+{
+	return Vector3<float>(Ohm::Math::HalfToFloat(x), Ohm::Math::HalfToFloat(y), Ohm::Math::HalfToFloat(z));
+}
+
+inline Vector4Half::Vector4Half(const Vector4<float>& aVector)
+	: x(Ohm::Math::FloatToHalf(aVector.x)), y(Ohm::Math::FloatToHalf(aVector.y)), z(Ohm::Math::FloatToHalf(aVector.z)), w(Ohm::Math::FloatToHalf(aVector.w))
+{
+}
+
+inline Vector4<float> Vector4Half::ToVector4() const
+{
+	return Vector4<float>(Ohm::Math::HalfToFloat(x), Ohm::Math::HalfToFloat(y), Ohm::Math::HalfToFloat(z), Ohm::Math::HalfToFloat(w));
+}
+
+// Both layouts are plain runs of components, so whole arrays convert as one flat stream.
+static_assert(sizeof(Vector3Half) == 3 * sizeof(uint16_t) && sizeof(Vector3<float>) == 3 * sizeof(float));
+static_assert(sizeof(Vector4Half) == 4 * sizeof(uint16_t) && sizeof(Vector4<float>) == 4 * sizeof(float));
+
+inline void PackVectors(const Vector3<float>* aVectors, Vector3Half* aOut, size_t aCount)
+{
+	PackHalves(reinterpret_cast<const float*>(aVectors), reinterpret_cast<uint16_t*>(aOut), aCount * 3);
+}
+
+inline void UnpackVectors(const Vector3Half* aVectors, Vector3<float>* aOut, size_t aCount)
+{
+	UnpackHalves(reinterpret_cast<const uint16_t*>(aVectors), reinterpret_cast<float*>(aOut), aCount * 3);
+}
+
+inline void PackVectors(const Vector4<float>* aVectors, Vector4Half* aOut, size_t aCount)
+{
+	PackHalves(reinterpret_cast<const float*>(aVectors), reinterpret_cast<uint16_t*>(aOut), aCount * 4);
+}
+
+inline void UnpackVectors(const Vector4Half* aVectors, Vector4<float>* aOut, size_t aCount)
+{
+	UnpackHalves(reinterpret_cast<const uint16_t*>(aVectors), reinterpret_cast<float*>(aOut), aCount * 4);
+}
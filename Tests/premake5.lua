@@ -1,8 +1,8 @@
-outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
+outputdir = "%{cfg.buildcfg}-%{cfg.platform}-%{cfg.system}-%{cfg.architecture}"
 
 project "Tests"
 	location "."
-	kind "SharedLib"
+	kind "ConsoleApp"
 	language "C++"
 	cppdialect "C++17"
 
@@ -19,14 +19,12 @@ project "Tests"
 	includedirs
 	{
 		"../Ohm/src",
-		"src",
-		"$(VCInstallDir)UnitTest/include"
+		"src"
 	}
 
-	libdirs
-	{
-		"$(VCInstallDir)UnitTest/lib"
-	}
+	-- ThreadPool starts std::threads, glibc before 2.34 needs libpthread for them.
+	filter "system:linux"
+		links { "pthread" }
 
 	filter "system:windows"
 		systemversion "latest"
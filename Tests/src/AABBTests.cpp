@@ -0,0 +1,167 @@
+#include "Test.hpp"
+
+#include <Ohm/Geometry/AABBBatch.hpp>
+
+#include <random>
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_trivially_copyable_v<AABB<float>>);
+
+namespace
+{
+	std::vector<Vector3<float>> RandomPoints(size_t aCount, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+
+		std::vector<Vector3<float>> points(aCount);
+		for (Vector3<float>& point : points)
+		{
+			point = Vector3<float>(distribution(generator), distribution(generator), distribution(generator));
+		}
+		return points;
+	}
+
+	// Reference bounds from all eight transformed corners.
+	AABB<double> TransformCorners(const AABB<float>& aBox, const Matrix4x4<float>& aMatrix)
+	{
+		AABB<double> result;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			const Vector4<double> point((corner & 1) ? aBox.max.x : aBox.min.x, (corner & 2) ? aBox.max.y : aBox.min.y, (corner & 4) ? aBox.max.z : aBox.min.z, 1.0);
+			Vector3<double> transformed;
+			for (int column = 0; column < 3; column++)
+			{
+				transformed[column] = point.x * aMatrix(1, column + 1) + point.y * aMatrix(2, column + 1) + point.z * aMatrix(3, column + 1) + aMatrix(4, column + 1);
+			}
+			result.Merge(transformed);
+		}
+		return result;
+	}
+
+	bool Equal(const AABB<float>& aA, const AABB<float>& aB)
+	{
+		return aA.min.x == aB.min.x && aA.min.y == aB.min.y && aA.min.z == aB.min.z &&
+			aA.max.x == aB.max.x && aA.max.y == aB.max.y && aA.max.z == aB.max.z;
+	}
+
+	Matrix4x4<float> TestTransform()
+	{
+		Matrix4x4<float> transform = Matrix4x4<float>::CreateRotation(0.3f, -1.1f, 2.f);
+		transform(1) = transform(1) * 2.f;
+		transform(3) = transform(3) * -0.5f;
+		transform(4) = Vector4<float>(10.f, -20.f, 5.f, 1.f);
+		return transform;
+	}
+}
+
+OHM_TEST(AABB, Queries)
+{
+	AABB<float> box;
+	OHM_CHECK(box.IsEmpty());
+	OHM_CHECK(!box.Contains(Vector3<float>(0.f)));
+
+	box.Merge(Vector3<float>(1.f, 2.f, 3.f));
+	OHM_CHECK(!box.IsEmpty());
+	OHM_CHECK(box.Contains(Vector3<float>(1.f, 2.f, 3.f)));
+
+	box.Merge(Vector3<float>(-1.f, 4.f, 0.f));
+	OHM_CHECK(box.min.x == -1.f && box.min.y == 2.f && box.min.z == 0.f);
+	OHM_CHECK(box.max.x == 1.f && box.max.y == 4.f && box.max.z == 3.f);
+	OHM_CHECK(box.GetCenter().x == 0.f && box.GetCenter().y == 3.f && box.GetCenter().z == 1.5f);
+	OHM_CHECK(box.GetExtents().x == 1.f && box.GetExtents().y == 1.f && box.GetExtents().z == 1.5f);
+	OHM_CHECK(box.GetSurfaceArea() == 2.f * (2.f * 2.f + 2.f * 3.f + 3.f * 2.f));
+
+	const AABB<float> inner(Vector3<float>(0.f, 2.5f, 1.f), Vector3<float>(1.f, 3.f, 2.f));
+	const AABB<float> outside(Vector3<float>(1.5f, 0.f, 0.f), Vector3<float>(2.f, 1.f, 1.f));
+	const AABB<float> touching(Vector3<float>(1.f, 4.f, 3.f), Vector3<float>(2.f, 5.f, 4.f));
+	OHM_CHECK(box.Contains(inner) && !inner.Contains(box));
+	OHM_CHECK(box.Intersects(inner) && inner.Intersects(box));
+	OHM_CHECK(!box.Intersects(outside) && !outside.Intersects(box));
+	OHM_CHECK(box.Intersects(touching) && !box.Contains(touching));
+
+	const AABB<float> merged = AABB<float>::Merge(box, outside);
+	OHM_CHECK(merged.Contains(box) && merged.Contains(outside));
+	OHM_CHECK(Equal(AABB<float>::Merge(AABB<float>(), box), box));
+
+	constexpr AABB<double> unit(Vector3<double>(-1.0), Vector3<double>(1.0));
+	constexpr AABB<double> moved = unit.Transform(Matrix4x4<double>::CreateTranslation(Vector3<double>(2.0, 0.0, 0.0)));
+	static_assert(moved.min.x == 1.0 && moved.max.x == 3.0 && moved.min.y == -1.0);
+}
+
+OHM_TEST(AABB, Transform)
+{
+	const Matrix4x4<float> transform = TestTransform();
+	const std::vector<AABB<float>> boxes = Test::RandomBoxes<float>(Test::Count, 1);
+
+	for (const AABB<float>& box : boxes)
+	{
+		const AABB<float> result = box.Transform(transform);
+		const AABB<double> expected = TransformCorners(box, transform);
+
+		// Both are the exact bounds of the corners up to float rounding of the sums.
+		const float tolerance = 1e-4f;
+		OHM_CHECK_NEAR(result.min.x, static_cast<float>(expected.min.x), tolerance);
+		OHM_CHECK_NEAR(result.min.y, static_cast<float>(expected.min.y), tolerance);
+		OHM_CHECK_NEAR(result.min.z, static_cast<float>(expected.min.z), tolerance);
+		OHM_CHECK_NEAR(result.max.x, static_cast<float>(expected.max.x), tolerance);
+		OHM_CHECK_NEAR(result.max.y, static_cast<float>(expected.max.y), tolerance);
+		OHM_CHECK_NEAR(result.max.z, static_cast<float>(expected.max.z), tolerance);
+	}
+
+	OHM_CHECK(AABB<float>().Transform(transform).IsEmpty());
+}
+
+OHM_TEST(AABB, ComputeBounds)
+{
+	const std::vector<Vector3<float>> points = RandomPoints(Test::Count, 2);
+
+	for (size_t count : { size_t(0), size_t(3), size_t(4), size_t(13), Test::Count })
+	{
+		const AABB<float> bounds = ComputeBounds(points.data(), count);
+		const AABB<float> reference = ComputeBounds<float>(points.data(), count);
+		OHM_CHECK(Equal(bounds, reference));
+		OHM_CHECK(bounds.IsEmpty() == (count == 0));
+
+		for (size_t i = 0; i < count; i++)
+		{
+			OHM_CHECK(bounds.Contains(points[i]));
+		}
+	}
+	OHM_CHECK(ComputeBounds(static_cast<const Vector3<float>*>(nullptr), 0).IsEmpty());
+}
+
+OHM_TEST(AABB, SoA)
+{
+	const Matrix4x4<float> transform = TestTransform();
+	const std::vector<AABB<float>> boxes = Test::RandomBoxes<float>(Test::Count, 3);
+	const std::vector<AABB<float>> others = Test::RandomBoxes<float>(Test::Count, 5);
+
+	const AABBSoA<float> soa(boxes.data(), boxes.size());
+	const AABBSoA<float> otherSoa(others.data(), others.size());
+	OHM_CHECK(soa.Size() == Test::Count);
+
+	AABBSoA<float> transformed;
+	AABBSoA<float>::Transform(soa, transform, transformed);
+	AABBSoA<float> merged;
+	AABBSoA<float>::Merge(soa, otherSoa, merged);
+
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		OHM_CHECK(Equal(transformed[i], boxes[i].Transform(transform)));
+		OHM_CHECK(Equal(merged[i], AABB<float>::Merge(boxes[i], others[i])));
+	}
+
+	// In place.
+	AABBSoA<float> inPlace = soa;
+	AABBSoA<float>::Transform(inPlace, transform, inPlace);
+	OHM_CHECK(Equal(inPlace[Test::Count - 1], transformed[Test::Count - 1]));
+
+	AABBSoA<double> doubles(1);
+	doubles.Set(0, AABB<double>(Vector3<double>(-1.0), Vector3<double>(1.0)));
+	AABBSoA<double>::Transform(doubles, Matrix4x4<double>::CreateRotationAroundZ(Ohm::Math::Pi / 4.0), doubles);
+	OHM_CHECK_NEAR(doubles[0].max.x, std::sqrt(2.0), 1e-12);
+	OHM_CHECK_NEAR(doubles[0].min.y, -std::sqrt(2.0), 1e-12);
+	OHM_CHECK_NEAR(doubles[0].max.z, 1.0, 1e-12);
+}
@@ -0,0 +1,204 @@
+#include "Test.hpp"
+
+#include <Ohm/Animation/AnimationClip.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr size_t BoneCount = 57;
+
+	// Key times lie on the 16 bit grid of the clip, so only the value quantization differs from the reference.
+	template<typename T>
+	std::vector<T> RandomTimes(std::mt19937& aGenerator, T aDuration, size_t aCount, bool aEndsAtDuration)
+	{
+		std::uniform_int_distribution<int> tick(0, 65535);
+		std::vector<int> ticks(aCount);
+		for (int& value : ticks)
+		{
+			value = tick(aGenerator);
+		}
+		if (aEndsAtDuration && aCount > 0)
+		{
+			ticks[0] = 65535;
+		}
+		std::sort(ticks.begin(), ticks.end());
+		ticks.erase(std::unique(ticks.begin(), ticks.end()), ticks.end());
+
+		std::vector<T> times;
+		for (int value : ticks)
+		{
+			times.push_back(aDuration * static_cast<T>(value) / static_cast<T>(65535));
+		}
+		return times;
+	}
+
+	template<typename T>
+	std::vector<AnimationTrack<T>> RandomTracks(T aDuration)
+	{
+		std::mt19937 generator(7);
+		std::uniform_real_distribution<T> value(static_cast<T>(-5), static_cast<T>(5));
+		std::uniform_int_distribution<int> keyCount(0, 40);
+
+		std::vector<AnimationTrack<T>> tracks(BoneCount);
+		for (size_t bone = 0; bone < BoneCount; bone++)
+		{
+			// Every few bones have empty or single key channels.
+			AnimationTrack<T>& track = tracks[bone];
+			track.translationTimes = RandomTimes<T>(generator, aDuration, bone % 5 == 1 ? 1 : keyCount(generator), bone == 0);
+			track.rotationTimes = RandomTimes<T>(generator, aDuration, bone % 7 == 2 ? 0 : keyCount(generator), false);
+			track.scaleTimes = RandomTimes<T>(generator, aDuration, bone % 3 == 0 ? 0 : keyCount(generator), false);
+			for (size_t key = 0; key < track.translationTimes.size(); key++)
+			{
+				track.translations.push_back(Vector3<T>(value(generator), value(generator), value(generator)));
+			}
+			for (size_t key = 0; key < track.rotationTimes.size(); key++)
+			{
+				track.rotations.push_back(Quaternion<T>(value(generator), value(generator), value(generator), value(generator)).GetNormalized());
+			}
+			for (size_t key = 0; key < track.scaleTimes.size(); key++)
+			{
+				track.scales.push_back(Vector3<T>(value(generator), value(generator), value(generator)) * static_cast<T>(0.1) + Vector3<T>(static_cast<T>(1)));
+			}
+		}
+		return tracks;
+	}
+
+	// Straight from the source keys: binary search, then Vector3 lerp or Quaternion Nlerp.
+	template<typename T, typename Value, typename Interpolate>
+	Value SampleReference(const std::vector<T>& aTimes, const std::vector<Value>& aValues, T aTime, const Value& aDefault, Interpolate&& aInterpolate)
+	{
+		if (aValues.empty())
+		{
+			return aDefault;
+		}
+
+		const size_t next = std::upper_bound(aTimes.begin(), aTimes.end(), aTime) - aTimes.begin();
+		if (next == 0)
+		{
+			return aValues.front();
+		}
+		if (next == aTimes.size())
+		{
+			return aValues.back();
+		}
+		return aInterpolate(aValues[next - 1], aValues[next], (aTime - aTimes[next - 1]) / (aTimes[next] - aTimes[next - 1]));
+	}
+
+	template<typename T>
+	void CheckSameRotation(const Quaternion<T>& aValue, const Quaternion<T>& aExpected, T aTolerance)
+	{
+		const T sign = aValue.Dot(aExpected) < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+		OHM_CHECK_NEAR(aValue.x * sign, aExpected.x, aTolerance);
+		OHM_CHECK_NEAR(aValue.y * sign, aExpected.y, aTolerance);
+		OHM_CHECK_NEAR(aValue.z * sign, aExpected.z, aTolerance);
+		OHM_CHECK_NEAR(aValue.w * sign, aExpected.w, aTolerance);
+	}
+
+	template<typename T>
+	struct Pose
+	{
+		std::vector<Vector3<T>> translations = std::vector<Vector3<T>>(BoneCount);
+		std::vector<Quaternion<T>> rotations = std::vector<Quaternion<T>>(BoneCount);
+		std::vector<Vector3<T>> scales = std::vector<Vector3<T>>(BoneCount);
+
+		bool operator==(const Pose& aOther) const
+		{
+			return std::memcmp(translations.data(), aOther.translations.data(), sizeof(Vector3<T>) * BoneCount) == 0 &&
+				std::memcmp(rotations.data(), aOther.rotations.data(), sizeof(Quaternion<T>) * BoneCount) == 0 &&
+				std::memcmp(scales.data(), aOther.scales.data(), sizeof(Vector3<T>) * BoneCount) == 0;
+		}
+	};
+
+	template<typename T>
+	void TestClip()
+	{
+		const T duration = static_cast<T>(2.5);
+		const std::vector<AnimationTrack<T>> tracks = RandomTracks<T>(duration);
+		const AnimationClip<T> clip(tracks.data(), BoneCount);
+		OHM_CHECK(clip.GetBoneCount() == BoneCount);
+		OHM_CHECK(clip.GetDuration() == duration);
+
+		// Forward playback, looping twice, then random jumps.
+		std::vector<T> sampleTimes;
+		for (int frame = 0; frame < 400; frame++)
+		{
+			sampleTimes.push_back(static_cast<T>(frame % 170) / static_cast<T>(60));
+		}
+		std::mt19937 generator(9);
+		std::uniform_real_distribution<T> randomTime(static_cast<T>(-0.5), duration + static_cast<T>(0.5));
+		for (int sample = 0; sample < 50; sample++)
+		{
+			sampleTimes.push_back(randomTime(generator));
+		}
+
+		AnimationCursor cursor;
+		Pose<T> pose;
+		Pose<T> searched;
+		for (const T time : sampleTimes)
+		{
+			clip.Sample(time, cursor, pose.translations.data(), pose.rotations.data(), pose.scales.data());
+			clip.Sample(time, searched.translations.data(), searched.rotations.data(), searched.scales.data());
+			OHM_CHECK(pose == searched);
+
+			const T clamped = Ohm::Math::Min(Ohm::Math::Max(time, static_cast<T>(0)), duration);
+			const auto lerp = [](const Vector3<T>& aFrom, const Vector3<T>& aTo, T aT) { return aFrom + (aTo - aFrom) * aT; };
+			for (size_t bone = 0; bone < BoneCount; bone += 4)
+			{
+				const AnimationTrack<T>& track = tracks[bone];
+				OHM_CHECK_NEAR_VECTOR(pose.translations[bone], SampleReference(track.translationTimes, track.translations, clamped, Vector3<T>(static_cast<T>(0)), lerp), static_cast<T>(5e-4));
+				CheckSameRotation(pose.rotations[bone], SampleReference(track.rotationTimes, track.rotations, clamped, Quaternion<T>(), Quaternion<T>::Nlerp), static_cast<T>(5e-4));
+				OHM_CHECK_NEAR_VECTOR(pose.scales[bone], SampleReference(track.scaleTimes, track.scales, clamped, Vector3<T>(static_cast<T>(1)), lerp), static_cast<T>(5e-4));
+			}
+		}
+
+		// Channels can be skipped, a cursor of another clip only needs a search.
+		const AnimationClip<T> other(tracks.data() + 1, BoneCount - 1);
+		AnimationCursor otherCursor;
+		std::vector<Vector3<T>> translations(BoneCount);
+		other.Sample(duration, otherCursor, translations.data(), nullptr, nullptr);
+		clip.Sample(static_cast<T>(1), otherCursor, nullptr, pose.rotations.data(), nullptr);
+		clip.Sample(static_cast<T>(1), nullptr, searched.rotations.data(), nullptr);
+		OHM_CHECK(std::memcmp(pose.rotations.data(), searched.rotations.data(), sizeof(Quaternion<T>) * BoneCount) == 0);
+
+		// 8 bytes per key against at least 16, plus the ranges of every bone.
+		size_t sourceSize = 0;
+		for (const AnimationTrack<T>& track : tracks)
+		{
+			sourceSize += (track.translationTimes.size() + track.rotationTimes.size() + track.scaleTimes.size()) * sizeof(T);
+			sourceSize += (track.translations.size() + track.scales.size()) * sizeof(Vector3<T>) + track.rotations.size() * sizeof(Quaternion<T>);
+		}
+		OHM_CHECK(clip.GetMemorySize() * 10 < sourceSize * 6);
+	}
+}
+
+OHM_TEST(AnimationClip, MatchesSourceKeys)
+{
+	TestClip<float>();
+	TestClip<double>();
+}
+
+OHM_TEST(AnimationClip, Defaults)
+{
+	AnimationTrack<float> track;
+	track.translationTimes = { 1.f };
+	track.translations = { Vector3<float>(1.f, 2.f, 3.f) };
+	const AnimationClip<float> clip(&track, 1);
+
+	Vector3<float> translation;
+	Quaternion<float> rotation(1.f, 1.f, 1.f, 1.f);
+	Vector3<float> scale;
+	clip.Sample(0.5f, &translation, &rotation, &scale);
+	OHM_CHECK(translation == Vector3<float>(1.f, 2.f, 3.f));
+	// The smallest three encoding keeps the identity within its 2.2e-5 error.
+	CheckSameRotation(rotation, Quaternion<float>(), 1e-4f);
+	OHM_CHECK(scale == Vector3<float>(1.f));
+
+	const AnimationClip<float> empty;
+	AnimationCursor cursor;
+	empty.Sample(1.f, cursor, nullptr, nullptr, nullptr);
+	OHM_CHECK(empty.GetDuration() == 0.f);
+}
@@ -0,0 +1,227 @@
+#include "Test.hpp"
+
+#include <Ohm/Geometry/BVH.hpp>
+#include <Ohm/Utility/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Every primitive sits in exactly one leaf and every slot box contains what is below it.
+	template<typename T>
+	void CheckStructure(const BVH<T>& aBVH, const std::vector<AABB<T>>& aBoxes)
+	{
+		std::vector<uint32_t> order = aBVH.GetPrimitiveOrder();
+		std::sort(order.begin(), order.end());
+		OHM_CHECK(order.size() == aBoxes.size());
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			OHM_CHECK(order[i] == i);
+		}
+
+		size_t leafPrimitives = 0;
+		const std::vector<BVHNode<T>>& nodes = aBVH.GetNodes();
+		for (size_t i = 0; i < nodes.size(); i++)
+		{
+			const BVHNode<T>& node = nodes[i];
+			OHM_CHECK(node.childCount >= 1 && node.childCount <= BVHNode<T>::Width);
+			for (size_t slot = 0; slot < node.childCount; slot++)
+			{
+				const AABB<T> bounds = node.GetBounds(slot);
+				if (node.IsLeaf(slot))
+				{
+					leafPrimitives += node.count[slot];
+					for (uint32_t primitive = node.child[slot]; primitive < node.child[slot] + node.count[slot]; primitive++)
+					{
+						OHM_CHECK(bounds.Contains(aBoxes[aBVH.GetPrimitiveOrder()[primitive]]));
+					}
+				}
+				else
+				{
+					OHM_CHECK(node.child[slot] > i && node.child[slot] < nodes.size());
+					OHM_CHECK(bounds.Contains(nodes[node.child[slot]].GetBounds()));
+				}
+			}
+		}
+		OHM_CHECK(leafPrimitives == aBoxes.size());
+	}
+
+	// Brute force references for the queries, compared as sorted index lists.
+	template<typename T>
+	void CheckQueries(const BVH<T>& aBVH, const std::vector<AABB<T>>& aBoxes, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_real_distribution<T> position(static_cast<T>(-60), static_cast<T>(60));
+		std::normal_distribution<T> direction;
+
+		for (int query = 0; query < 64; query++)
+		{
+			const Ray<T> ray(Vector3<T>(position(generator), position(generator), position(generator)), Vector3<T>(direction(generator), direction(generator), direction(generator)));
+
+			T expectedDistance = std::numeric_limits<T>::max();
+			bool expectedHit = false;
+			for (const AABB<T>& box : aBoxes)
+			{
+				T distance = 0;
+				if (ray.Intersects(box, distance) && distance < expectedDistance)
+				{
+					expectedDistance = distance;
+					expectedHit = true;
+				}
+			}
+
+			T distance = std::numeric_limits<T>::max();
+			const uint32_t hit = aBVH.Raycast(ray, distance);
+			OHM_CHECK((hit != BVH<T>::InvalidIndex) == expectedHit);
+			if (hit != BVH<T>::InvalidIndex)
+			{
+				T hitDistance = 0;
+				OHM_CHECK(ray.Intersects(aBoxes[hit], hitDistance) && hitDistance == distance);
+				OHM_CHECK(distance == expectedDistance);
+			}
+
+			const Vector3<T> center(position(generator), position(generator), position(generator));
+			const AABB<T> region = AABB<T>::FromCenterExtents(center, Vector3<T>(static_cast<T>(8)));
+			std::vector<uint32_t> expected;
+			for (size_t i = 0; i < aBoxes.size(); i++)
+			{
+				if (aBoxes[i].Intersects(region))
+				{
+					expected.push_back(static_cast<uint32_t>(i));
+				}
+			}
+			std::vector<uint32_t> found;
+			aBVH.QueryOverlap(region, [&](uint32_t aIndex) { found.push_back(aIndex); });
+			std::sort(found.begin(), found.end());
+			OHM_CHECK(found == expected);
+
+			const Matrix4x4<T> view = Matrix4x4<T>::GetFastInverse(Matrix4x4<T>::CreateLookAt(ray.origin, ray.origin + ray.direction, Vector3<T>(0, 1, 0)));
+			const Frustum<T> frustum(view * Matrix4x4<T>::CreatePerspective(static_cast<T>(1.2), static_cast<T>(1), static_cast<T>(0.5), static_cast<T>(80)));
+			expected.clear();
+			for (size_t i = 0; i < aBoxes.size(); i++)
+			{
+				if (frustum.Intersects(aBoxes[i]))
+				{
+					expected.push_back(static_cast<uint32_t>(i));
+				}
+			}
+			found.clear();
+			aBVH.QueryFrustum(frustum, [&](uint32_t aIndex) { found.push_back(aIndex); });
+			std::sort(found.begin(), found.end());
+			OHM_CHECK(found == expected);
+		}
+	}
+
+	template<typename T>
+	void TestBuildAndQuery()
+	{
+		const std::vector<AABB<T>> boxes = Test::RandomBoxes<T>(Test::Count, 1);
+		const BVH<T> bvh(boxes.data(), boxes.size());
+		CheckStructure(bvh, boxes);
+		CheckQueries(bvh, boxes, 2);
+
+		AABB<T> bounds;
+		for (const AABB<T>& box : boxes)
+		{
+			bounds.Merge(box);
+		}
+		OHM_CHECK(bvh.GetBounds().min == bounds.min && bvh.GetBounds().max == bounds.max);
+	}
+}
+
+OHM_TEST(BVH, BuildAndQuery)
+{
+	TestBuildAndQuery<float>();
+	TestBuildAndQuery<double>();
+}
+
+OHM_TEST(BVH, Refit)
+{
+	std::vector<AABB<float>> boxes = Test::RandomBoxes<float>(Test::Count, 3);
+	BVH<float> bvh(boxes.data(), boxes.size());
+
+	std::mt19937 generator(4);
+	std::uniform_real_distribution<float> offset(-5.f, 5.f);
+	for (AABB<float>& box : boxes)
+	{
+		const Vector3<float> move(offset(generator), offset(generator), offset(generator));
+		box = AABB<float>(box.min + move, box.max + move);
+	}
+	bvh.Refit(boxes.data());
+	CheckStructure(bvh, boxes);
+	CheckQueries(bvh, boxes, 5);
+}
+
+OHM_TEST(BVH, Options)
+{
+	// Enough primitives for the parallel path, which has to produce the same tree as the serial one.
+	const std::vector<AABB<float>> boxes = Test::RandomBoxes<float>(20000, 6);
+	BVHBuildOptions options;
+	const BVH<float> serial(boxes.data(), boxes.size(), options);
+	ThreadPool pool(3);
+	options.pool = &pool;
+	const BVH<float> parallel(boxes.data(), boxes.size(), options);
+	OHM_CHECK(serial.GetPrimitiveOrder() == parallel.GetPrimitiveOrder());
+	OHM_CHECK(serial.GetNodes().size() == parallel.GetNodes().size());
+	CheckStructure(parallel, boxes);
+
+	options.maxLeafSize = 1;
+	options.binCount = 4;
+	const BVH<float> fine(boxes.data(), boxes.size(), options);
+	CheckStructure(fine, boxes);
+	for (const BVHNode<float>& node : fine.GetNodes())
+	{
+		for (size_t slot = 0; slot < node.childCount; slot++)
+		{
+			OHM_CHECK(node.count[slot] <= 1);
+		}
+	}
+}
+
+OHM_TEST(BVH, EdgeCases)
+{
+	BVH<float> empty;
+	empty.Build(nullptr, 0);
+	float distance = 1.f;
+	OHM_CHECK(empty.Raycast(Ray<float>(), distance) == BVH<float>::InvalidIndex);
+	OHM_CHECK(empty.GetBounds().IsEmpty());
+	empty.QueryOverlap(AABB<float>(Vector3<float>(-1.f), Vector3<float>(1.f)), [](uint32_t) { OHM_CHECK(false); });
+
+	const AABB<float> single(Vector3<float>(1.f), Vector3<float>(2.f));
+	const BVH<float> one(&single, 1);
+	OHM_CHECK(one.GetNodes().size() == 1 && one.GetNodes()[0].childCount == 1);
+	distance = 100.f;
+	OHM_CHECK(one.Raycast(Ray<float>(Vector3<float>(0.f), Vector3<float>(1.f)), distance) == 0);
+	OHM_CHECK(distance == 1.f);
+
+	// Identical boxes can't be split by the SAH and still end up in bounded leaves.
+	const std::vector<AABB<float>> same(100, single);
+	const BVH<float> stacked(same.data(), same.size());
+	CheckStructure(stacked, same);
+
+	// The custom intersection sees original indices and limits the hit distance.
+	const std::vector<AABB<float>> boxes = Test::RandomBoxes<float>(Test::Count, 7);
+	const BVH<float> bvh(boxes.data(), boxes.size());
+	const Ray<float> ray(Vector3<float>(-60.f, 0.f, 0.f), Vector3<float>(1.f, 0.01f, 0.02f));
+	std::vector<uint32_t> tested;
+	distance = 30.f;
+	const uint32_t hit = bvh.Raycast(ray, distance, [&](uint32_t aIndex, float& aDistance)
+	{
+		tested.push_back(aIndex);
+		float boxDistance = 0.f;
+		if (ray.Intersects(boxes[aIndex], boxDistance) && boxDistance < aDistance)
+		{
+			aDistance = boxDistance;
+			return true;
+		}
+		return false;
+	});
+	OHM_CHECK(tested.size() < Test::Count / 4);
+	if (hit != BVH<float>::InvalidIndex)
+	{
+		OHM_CHECK(distance < 30.f && std::find(tested.begin(), tested.end(), hit) != tested.end());
+	}
+}
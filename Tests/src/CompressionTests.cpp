@@ -0,0 +1,219 @@
+#include "Test.hpp"
+
+#include <Ohm/Quaternion/PackedQuaternion.hpp>
+#include <Ohm/Vector/OctahedralNormal.hpp>
+#include <Ohm/Vector/VectorHalf.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<Vector3<float>> RandomDirections(size_t aCount, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::normal_distribution<float> distribution;
+
+		std::vector<Vector3<float>> directions(aCount);
+		for (Vector3<float>& direction : directions)
+		{
+			direction = Vector3<float>(distribution(generator), distribution(generator), distribution(generator)).GetNormalized();
+		}
+		return directions;
+	}
+
+	std::vector<Quaternion<float>> RandomRotations(size_t aCount, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::normal_distribution<float> distribution;
+
+		std::vector<Quaternion<float>> rotations(aCount);
+		for (Quaternion<float>& rotation : rotations)
+		{
+			rotation = Quaternion<float>(distribution(generator), distribution(generator), distribution(generator), distribution(generator)).GetNormalized();
+		}
+		return rotations;
+	}
+
+	double AngleBetween(const Vector3<float>& aA, const Vector3<float>& aB)
+	{
+		const Vector3<double> a(aA.x, aA.y, aA.z);
+		const Vector3<double> b(aB.x, aB.y, aB.z);
+		return std::atan2(a.Cross(b).Length(), a.Dot(b));
+	}
+
+	// Angle of the rotation taking aA to aB, independent of the quaternion sign. Uses the chord length,
+	// which stays accurate for tiny angles where acos of the dot product does not.
+	double RotationAngleBetween(const Quaternion<float>& aA, const Quaternion<float>& aB)
+	{
+		const Quaternion<double> a = Quaternion<double>(aA.x, aA.y, aA.z, aA.w).GetNormalized();
+		const Quaternion<double> b(aB.x, aB.y, aB.z, aB.w);
+		const double difference = std::sqrt((a - b).Dot(a - b));
+		const double sum = std::sqrt((a + b).Dot(a + b));
+		return 4.0 * std::asin(std::min(difference, sum) / 2.0);
+	}
+}
+
+OHM_TEST(Compression, HalfKnownValues)
+{
+	OHM_CHECK(Ohm::Math::FloatToHalf(1.f) == 0x3C00);
+	OHM_CHECK(Ohm::Math::FloatToHalf(-2.f) == 0xC000);
+	OHM_CHECK(Ohm::Math::FloatToHalf(65504.f) == 0x7BFF);
+	OHM_CHECK(Ohm::Math::FloatToHalf(65520.f) == 0x7C00);
+	OHM_CHECK(Ohm::Math::FloatToHalf(std::ldexp(1.f, -24)) == 0x0001);
+	OHM_CHECK(Ohm::Math::FloatToHalf(std::ldexp(1.f, -26)) == 0x0000);
+	OHM_CHECK(Ohm::Math::FloatToHalf(-0.f) == 0x8000);
+
+	// 1 + 2^-11 is halfway between two halves and rounds to the even one.
+	OHM_CHECK(Ohm::Math::FloatToHalf(1.f + std::ldexp(1.f, -11)) == 0x3C00);
+	OHM_CHECK(Ohm::Math::FloatToHalf(1.f + 3.f * std::ldexp(1.f, -11)) == 0x3C02);
+
+	OHM_CHECK(Ohm::Math::HalfToFloat(0x3555) == 0.333251953125f);
+	OHM_CHECK(Ohm::Math::HalfToFloat(0x0001) == std::ldexp(1.f, -24));
+	OHM_CHECK(std::isinf(Ohm::Math::HalfToFloat(0xFC00)));
+	OHM_CHECK(std::isnan(Ohm::Math::HalfToFloat(0x7E00)));
+
+	// NaN keeps its sign and top payload bits and is quieted, through every path like F16C.
+	const std::vector<uint32_t> nanBits = { 0x7FA12345u, 0xFFA12345u, 0x7FC00000u, 0x7F800001u, 0xFFFFFFFFu, 0x7FE00000u, 0x7F802000u, 0xFF800000u, 0x7FA12345u };
+	const std::vector<uint16_t> expected = { 0x7F09, 0xFF09, 0x7E00, 0x7E00, 0xFFFF, 0x7F00, 0x7E01, 0xFC00, 0x7F09 };
+	std::vector<float> nans(nanBits.size());
+	std::memcpy(nans.data(), nanBits.data(), nanBits.size() * sizeof(uint32_t));
+	std::vector<uint16_t> packed(nans.size());
+	PackHalves(nans.data(), packed.data(), nans.size());
+	for (size_t i = 0; i < nans.size(); i++)
+	{
+		OHM_CHECK(Ohm::Math::FloatToHalf(nans[i]) == expected[i]);
+		OHM_CHECK(packed[i] == expected[i]);
+	}
+}
+
+OHM_TEST(Compression, HalfRoundTripAndBatch)
+{
+	// Every finite half survives float and back, through both the batch and the scalar path.
+	std::vector<uint16_t> halves;
+	for (uint32_t half = 0; half < 0x10000; half++)
+	{
+		if ((half & 0x7C00) != 0x7C00)
+		{
+			halves.push_back(static_cast<uint16_t>(half));
+		}
+	}
+
+	std::vector<float> floats(halves.size());
+	std::vector<uint16_t> roundTrip(halves.size());
+	UnpackHalves(halves.data(), floats.data(), halves.size());
+	PackHalves(floats.data(), roundTrip.data(), floats.size());
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < halves.size(); i++)
+	{
+		mismatches += roundTrip[i] != halves[i] || floats[i] != Ohm::Math::HalfToFloat(halves[i]) ? 1 : 0;
+	}
+	OHM_CHECK(mismatches == 0);
+
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<float> exponent(-20.f, 16.f);
+	std::vector<float> values(Test::Count);
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		values[i] = std::exp2(exponent(generator)) * (i % 2 == 0 ? 1.f : -1.f);
+	}
+
+	std::vector<uint16_t> packed(Test::Count);
+	PackHalves(values.data(), packed.data(), Test::Count);
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		OHM_CHECK(packed[i] == Ohm::Math::FloatToHalf(values[i]));
+
+		const float tolerance = std::max(std::abs(values[i]) * std::ldexp(1.f, -11), std::ldexp(1.f, -25));
+		OHM_CHECK_NEAR(Ohm::Math::HalfToFloat(packed[i]), values[i], tolerance);
+	}
+}
+
+OHM_TEST(Compression, VectorHalf)
+{
+	const std::vector<Vector3<float>> vectors = RandomDirections(Test::Count, 1);
+	std::vector<Vector3Half> packed(Test::Count);
+	std::vector<Vector3<float>> unpacked(Test::Count);
+	PackVectors(vectors.data(), packed.data(), Test::Count);
+	UnpackVectors(packed.data(), unpacked.data(), Test::Count);
+
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		const Vector3Half single(vectors[i]);
+		OHM_CHECK(single.x == packed[i].x && single.y == packed[i].y && single.z == packed[i].z);
+		OHM_CHECK_NEAR(unpacked[i].x, vectors[i].x, 4.9e-4f);
+		OHM_CHECK_NEAR(unpacked[i].y, vectors[i].y, 4.9e-4f);
+		OHM_CHECK_NEAR(unpacked[i].z, vectors[i].z, 4.9e-4f);
+	}
+
+	const Vector4Half point(Vector4<float>(1.5f, -2.f, 1000.f, 1.f));
+	const Vector4<float> restored = point.ToVector4();
+	OHM_CHECK(restored.x == 1.5f && restored.y == -2.f && restored.z == 1000.f && restored.w == 1.f);
+}
+
+OHM_TEST(Compression, OctahedralNormal)
+{
+	std::vector<Vector3<float>> normals = RandomDirections(Test::Count, 2);
+	normals[0] = Vector3<float>(0.f, 0.f, 1.f);
+	normals[1] = Vector3<float>(0.f, 0.f, -1.f);
+	normals[2] = Vector3<float>(-1.f, 0.f, 0.f);
+	normals[3] = Vector3<float>(0.f, 1.f, 0.f);
+
+	std::vector<OctahedralNormal> encoded(Test::Count);
+	std::vector<Vector3<float>> decoded(Test::Count);
+	EncodeNormals(normals.data(), encoded.data(), Test::Count);
+	DecodeNormals(encoded.data(), decoded.data(), Test::Count);
+
+	double maxError = 0.0;
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		const OctahedralNormal single(normals[i]);
+		OHM_CHECK(single.x == encoded[i].x && single.y == encoded[i].y);
+
+		const Vector3<float> singleDecoded = encoded[i].ToVector3();
+		OHM_CHECK_NEAR(singleDecoded.x, decoded[i].x, 1e-6f);
+		OHM_CHECK_NEAR(singleDecoded.y, decoded[i].y, 1e-6f);
+		OHM_CHECK_NEAR(singleDecoded.z, decoded[i].z, 1e-6f);
+		OHM_CHECK_NEAR(decoded[i].Length(), 1.f, 1e-6f);
+
+		maxError = std::max(maxError, AngleBetween(normals[i], decoded[i]));
+	}
+	OHM_CHECK(maxError < 7e-5);
+	OHM_CHECK(decoded[1].z == -1.f && decoded[2].x == -1.f && decoded[3].y == 1.f);
+}
+
+OHM_TEST(Compression, PackedQuaternion)
+{
+	std::vector<Quaternion<float>> rotations = RandomRotations(Test::Count, 3);
+	rotations[0] = Quaternion<float>(0.f, 0.f, 0.f, 1.f);
+	rotations[1] = Quaternion<float>(0.f, -1.f, 0.f, 0.f);
+	rotations[2] = Quaternion<float>(0.5f, -0.5f, 0.5f, -0.5f);
+
+	std::vector<PackedQuaternion> packed(Test::Count);
+	std::vector<Quaternion<float>> unpacked(Test::Count);
+	PackQuaternions(rotations.data(), packed.data(), Test::Count);
+	UnpackQuaternions(packed.data(), unpacked.data(), Test::Count);
+
+	double maxError = 0.0;
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		OHM_CHECK(PackedQuaternion(rotations[i]).GetBits() == packed[i].GetBits());
+		OHM_CHECK(packed[i].GetBits() < (uint64_t(1) << 47));
+
+		const Quaternion<float> single = packed[i].ToQuaternion();
+		OHM_CHECK_NEAR(single.x, unpacked[i].x, 1e-6f);
+		OHM_CHECK_NEAR(single.y, unpacked[i].y, 1e-6f);
+		OHM_CHECK_NEAR(single.z, unpacked[i].z, 1e-6f);
+		OHM_CHECK_NEAR(single.w, unpacked[i].w, 1e-6f);
+
+		maxError = std::max(maxError, RotationAngleBetween(rotations[i], unpacked[i]));
+	}
+	OHM_CHECK(maxError < 1.5e-4);
+
+	OHM_CHECK(unpacked[0].w == 1.f);
+	OHM_CHECK(unpacked[1].y == 1.f);
+}
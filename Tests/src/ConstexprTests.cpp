@@ -0,0 +1,80 @@
+#include "Test.hpp"
+
+#include <Ohm/Matrix/Matrix4x4.hpp>
+#include <Ohm/Quaternion/Quaternion.hpp>
+
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<Vector2<float>>);
+static_assert(std::is_trivially_copyable_v<Vector3<float>>);
+static_assert(std::is_trivially_copyable_v<Vector4<float>>);
+static_assert(std::is_trivially_copyable_v<Vector4<double>>);
+static_assert(std::is_trivially_copyable_v<Matrix3x3<float>>);
+static_assert(std::is_trivially_copyable_v<Matrix4x4<float>>);
+static_assert(std::is_trivially_copyable_v<Matrix4x4<double>>);
+static_assert(std::is_trivially_copyable_v<Quaternion<float>>);
+
+namespace
+{
+	template<typename T>
+	constexpr Matrix4x4<T> CreateBakedTransform()
+	{
+		return Matrix4x4<T>::CreateRotationAroundX(static_cast<T>(0.3)) * Matrix4x4<T>::CreateRotationAroundY(static_cast<T>(-1.1)) *
+			Matrix4x4<T>::CreateRotationAroundZ(static_cast<T>(2.2)) * Matrix4x4<T>::CreateTranslation(Vector3<T>(static_cast<T>(4), static_cast<T>(-2), static_cast<T>(0.5)));
+	}
+
+	template<typename T>
+	Matrix4x4<T> CreateRuntimeTransform()
+	{
+		volatile T angle = static_cast<T>(0.3);
+		return Matrix4x4<T>::CreateRotationAroundX(angle) * Matrix4x4<T>::CreateRotationAroundY(static_cast<T>(-1.1)) *
+			Matrix4x4<T>::CreateRotationAroundZ(static_cast<T>(2.2)) * Matrix4x4<T>::CreateTranslation(Vector3<T>(static_cast<T>(4), static_cast<T>(-2), static_cast<T>(0.5)));
+	}
+
+	template<typename T>
+	void CheckMatrixNear(const Matrix4x4<T>& aActual, const Matrix4x4<T>& aExpected, T aTolerance)
+	{
+		for (int row = 1; row <= 4; row++)
+		{
+			for (int column = 1; column <= 4; column++)
+			{
+				OHM_CHECK_NEAR(aActual(row, column), aExpected(row, column), aTolerance);
+			}
+		}
+	}
+}
+
+// Everything below is evaluated by the compiler, a failure is a build error.
+constexpr Matrix4x4<float> BakedTransform = CreateBakedTransform<float>();
+static_assert(BakedTransform(4, 4) == 1.f);
+static_assert(Matrix4x4<float>::Transpose(BakedTransform)(1, 4) == BakedTransform(4, 1));
+static_assert(Matrix4x4<float>::CreateTranslation(Vector3<float>(1.f, 2.f, 3.f))(4, 3) == 3.f);
+static_assert((Vector4<float>(1.f, 2.f, 3.f, 1.f) * Matrix4x4<float>::CreateTranslation(Vector3<float>(1.f, 2.f, 3.f))).z == 6.f);
+static_assert(Vector3<double>(3.0, 0.0, 4.0).Length() == 5.0);
+static_assert(Ohm::Math::Abs(Ohm::Math::Sin(Ohm::Math::Pi / 6.0) - 0.5) < 1e-15);
+
+OHM_TEST(Constexpr, BakedMatrixMatchesRuntime)
+{
+	CheckMatrixNear(BakedTransform, CreateRuntimeTransform<float>(), 1e-5f);
+
+	constexpr Matrix4x4<double> bakedDouble = CreateBakedTransform<double>();
+	CheckMatrixNear(bakedDouble, CreateRuntimeTransform<double>(), 1e-12);
+}
+
+OHM_TEST(Constexpr, BakedQuaternionMatchesRuntime)
+{
+	constexpr Quaternion<double> baked = Quaternion<double>::FromMatrix(Matrix3x3<double>::Rotate(0.4, -0.2, 1.3));
+	constexpr Vector3<double> bakedRotated = baked.Rotate(Vector3<double>(1.0, 2.0, 3.0));
+
+	volatile double angle = 0.4;
+	const Quaternion<double> runtime = Quaternion<double>::FromMatrix(Matrix3x3<double>::Rotate(angle, -0.2, 1.3));
+	const Vector3<double> runtimeRotated = runtime.Rotate(Vector3<double>(1.0, 2.0, 3.0));
+
+	OHM_CHECK_NEAR(baked.x, runtime.x, 1e-12);
+	OHM_CHECK_NEAR(baked.y, runtime.y, 1e-12);
+	OHM_CHECK_NEAR(baked.z, runtime.z, 1e-12);
+	OHM_CHECK_NEAR(baked.w, runtime.w, 1e-12);
+	OHM_CHECK_NEAR(bakedRotated.x, runtimeRotated.x, 1e-12);
+	OHM_CHECK_NEAR(bakedRotated.y, runtimeRotated.y, 1e-12);
+	OHM_CHECK_NEAR(bakedRotated.z, runtimeRotated.z, 1e-12);
+}
@@ -0,0 +1,103 @@
+#include "Test.hpp"
+
+#include <Ohm/Utility/Dispatch.hpp>
+
+#include <vector>
+
+namespace
+{
+	constexpr Ohm::InstructionSet InstructionSets[] =
+	{
+		Ohm::InstructionSet::Scalar,
+		Ohm::InstructionSet::SSE2,
+		Ohm::InstructionSet::SSE4_1,
+		Ohm::InstructionSet::AVX2,
+		Ohm::InstructionSet::AVX512
+	};
+}
+
+OHM_TEST(Dispatch, InstructionSetSelection)
+{
+	const Ohm::InstructionSet original = Ohm::GetInstructionSet();
+
+	OHM_CHECK(Ohm::IsSupported(Ohm::GetBestInstructionSet()));
+	OHM_CHECK(Ohm::SetInstructionSet(Ohm::InstructionSet::Scalar));
+	OHM_CHECK(Ohm::GetInstructionSet() == Ohm::InstructionSet::Scalar);
+
+	Ohm::InstructionSet parsed = Ohm::InstructionSet::Scalar;
+	OHM_CHECK(Ohm::ParseInstructionSet("AVX2", parsed) && parsed == Ohm::InstructionSet::AVX2);
+	OHM_CHECK(!Ohm::ParseInstructionSet("neon", parsed));
+
+	Ohm::SetInstructionSet(original);
+}
+
+OHM_TEST(Dispatch, KernelsMatchScalar)
+{
+	// 37 elements cover the 16, 8 and 4 wide bodies as well as the scalar tails.
+	constexpr size_t count = 37;
+
+	std::vector<Matrix4x4<float>> lhs(count);
+	std::vector<Matrix4x4<float>> rhs(count);
+	std::vector<Vector3<float>> points(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const float value = static_cast<float>(i);
+		lhs[i] = Matrix4x4<float>::CreateRotation(value * 0.1f, 0.5f, -value * 0.2f) * Matrix4x4<float>::CreateTranslation(Vector3<float>(value, 1.f, -2.f));
+		rhs[i] = Matrix4x4<float>::CreatePerspective(1.f + value * 0.01f, 1.5f, 0.1f, 100.f);
+		points[i] = Vector3<float>(value - 10.f, 2.f * value, 3.f - value);
+	}
+
+	const Matrix4x4<float> transform = lhs[7] * rhs[3];
+	const Vector3SoA<float> vectors(points.data(), count);
+
+	const Ohm::Dispatch::KernelTable& reference = Ohm::Dispatch::GetKernels(Ohm::InstructionSet::Scalar);
+	std::vector<Matrix4x4<float>> expectedProducts(count);
+	std::vector<Vector3<float>> expectedPoints(count);
+	std::vector<Vector3<float>> expectedProjected(count);
+	Vector3SoA<float> expectedNormalized(count);
+	reference.MultiplyMatrices(lhs.data(), rhs.data(), expectedProducts.data(), count);
+	reference.TransformPoints(transform, points.data(), expectedPoints.data(), count);
+	reference.TransformPointsProjective(transform, points.data(), expectedProjected.data(), count);
+	reference.NormalizeVector3(vectors.X(), vectors.Y(), vectors.Z(), expectedNormalized.X(), expectedNormalized.Y(), expectedNormalized.Z(), count);
+
+	const Ohm::InstructionSet original = Ohm::GetInstructionSet();
+	for (Ohm::InstructionSet set : InstructionSets)
+	{
+		if (!Ohm::SetInstructionSet(set))
+		{
+			continue;
+		}
+
+		std::vector<Matrix4x4<float>> products(count);
+		std::vector<Vector3<float>> transformed(count);
+		std::vector<Vector3<float>> projected(count);
+		Vector3SoA<float> normalized;
+		Ohm::Dispatch::MultiplyMatrices(lhs.data(), rhs.data(), products.data(), count);
+		Ohm::Dispatch::TransformPoints(transform, points.data(), transformed.data(), count);
+		Ohm::Dispatch::TransformPointsProjective(transform, points.data(), projected.data(), count);
+		Ohm::Dispatch::Normalize(vectors, normalized);
+		Ohm::Dispatch::TransformPoints(transform, nullptr, nullptr, 0);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			for (int row = 1; row <= 4; row++)
+			{
+				for (int column = 1; column <= 4; column++)
+				{
+					OHM_CHECK_NEAR(products[i](row, column), expectedProducts[i](row, column), 1e-3f);
+				}
+			}
+
+			OHM_CHECK_NEAR(transformed[i].x, expectedPoints[i].x, 1e-3f);
+			OHM_CHECK_NEAR(transformed[i].y, expectedPoints[i].y, 1e-3f);
+			OHM_CHECK_NEAR(transformed[i].z, expectedPoints[i].z, 1e-3f);
+			OHM_CHECK_NEAR(projected[i].x, expectedProjected[i].x, 1e-3f);
+			OHM_CHECK_NEAR(projected[i].z, expectedProjected[i].z, 1e-3f);
+			OHM_CHECK_NEAR(normalized[i].x, expectedNormalized[i].x, 1e-6f);
+			OHM_CHECK_NEAR(normalized[i].y, expectedNormalized[i].y, 1e-6f);
+			OHM_CHECK_NEAR(normalized[i].z, expectedNormalized[i].z, 1e-6f);
+		}
+	}
+
+	Ohm::SetInstructionSet(original);
+}
@@ -0,0 +1,167 @@
+#include "Test.hpp"
+
+#include <Ohm/Fixed/Fixed.hpp>
+#include <Ohm/Matrix/Matrix3x3.hpp>
+#include <Ohm/Quaternion/Quaternion.hpp>
+#include <Ohm/Vector/Vector3.hpp>
+
+#include <cstdint>
+
+static_assert(Fixed16(3).GetRaw() == 3 << 16);
+static_assert(Fixed16(-3).GetRaw() == -3 * 65536);
+static_assert(static_cast<Fixed16>(1.5) * static_cast<Fixed16>(2.25) == static_cast<Fixed16>(3.375));
+static_assert(Fixed32::Sqrt(Fixed32(9)) == Fixed32(3));
+
+namespace
+{
+	// A small lockstep style simulation, every step mixes all the kernels into a running hash of the raw bits.
+	template<typename T>
+	uint64_t SimulateChecksum()
+	{
+		Vector3<T> position(T(1), T(2), T(-3));
+		Vector3<T> velocity(static_cast<T>(0.25), static_cast<T>(-0.5), static_cast<T>(0.125));
+		T angle = static_cast<T>(0.1);
+
+		uint64_t hash = 14695981039346656037ull;
+		const auto mix = [&hash](const T& aValue)
+		{
+			hash = (hash ^ static_cast<uint64_t>(aValue.GetRaw())) * 1099511628211ull;
+		};
+
+		for (int step = 0; step < 256; step++)
+		{
+			const Matrix3x3<T> rotation = Matrix3x3<T>::CreateRotationAroundY(angle);
+			velocity = velocity * rotation;
+			position += velocity / T(4);
+
+			const T length = position.Length();
+			if (length > T(8))
+			{
+				position = position.GetNormalized() * T(2);
+			}
+			angle += Ohm::Math::Sin(angle) / T(16) + static_cast<T>(0.03125);
+
+			mix(position.x);
+			mix(position.y);
+			mix(position.z);
+			mix(length);
+			mix(angle);
+		}
+		return hash;
+	}
+}
+
+OHM_TEST(Fixed, Arithmetic)
+{
+	const Fixed16 a = static_cast<Fixed16>(1.5);
+	const Fixed16 b = static_cast<Fixed16>(-2.25);
+
+	OHM_CHECK(a + b == static_cast<Fixed16>(-0.75));
+	OHM_CHECK(a - b == static_cast<Fixed16>(3.75));
+	OHM_CHECK(a * b == static_cast<Fixed16>(-3.375));
+	OHM_CHECK(b / a == static_cast<Fixed16>(-1.5));
+	OHM_CHECK(-a == static_cast<Fixed16>(-1.5));
+	OHM_CHECK(a < Fixed16(2) && b < a);
+
+	// Multiplication floors and division truncates, for both signs.
+	OHM_CHECK(Fixed16::FromRaw(1) * static_cast<Fixed16>(0.5) == Fixed16::FromRaw(0));
+	OHM_CHECK(Fixed16::FromRaw(-1) * static_cast<Fixed16>(0.5) == Fixed16::FromRaw(-1));
+	OHM_CHECK(Fixed16(1) / Fixed16(3) == Fixed16::FromRaw(21845));
+	OHM_CHECK(Fixed16(-1) / Fixed16(3) == Fixed16::FromRaw(-21845));
+
+	const Fixed32 c = static_cast<Fixed32>(-12345.678);
+	const Fixed32 d = static_cast<Fixed32>(0.001);
+	OHM_CHECK_NEAR(static_cast<double>(c * d), static_cast<double>(c) * static_cast<double>(d), 1e-9);
+	OHM_CHECK_NEAR(static_cast<double>(c / d), static_cast<double>(c) / static_cast<double>(d), 1e-6);
+	OHM_CHECK(Fixed32::FromRaw(-1) * static_cast<Fixed32>(0.5) == Fixed32::FromRaw(-1));
+
+	// Integers outside the range wrap.
+	OHM_CHECK(Fixed16(100000) == Fixed16(100000 - 65536));
+	OHM_CHECK(Fixed16(-32769) == Fixed16(32767));
+	OHM_CHECK(Fixed16(32768).GetRaw() == INT32_MIN);
+}
+
+OHM_TEST(Fixed, SqrtAndReciprocal)
+{
+	for (int i = 0; i < 1000; i++)
+	{
+		const double value = i * 0.37;
+		OHM_CHECK_NEAR(static_cast<double>(Fixed16::Sqrt(static_cast<Fixed16>(value))), std::sqrt(static_cast<double>(static_cast<Fixed16>(value))), 1e-4);
+		OHM_CHECK_NEAR(static_cast<double>(Fixed32::Sqrt(static_cast<Fixed32>(value))), std::sqrt(static_cast<double>(static_cast<Fixed32>(value))), 1e-9);
+	}
+
+	OHM_CHECK(Ohm::Math::Sqrt(Fixed16(16)) == Fixed16(4));
+	OHM_CHECK(Ohm::Math::Sqrt(17) == 4);
+	OHM_CHECK_NEAR(static_cast<double>(Fixed32::Reciprocal(Fixed32(-3))), -1.0 / 3.0, 1e-9);
+}
+
+OHM_TEST(Fixed, SinCos)
+{
+	for (int i = -2000; i <= 2000; i++)
+	{
+		const Fixed16 angle16 = static_cast<Fixed16>(i * 0.01);
+		const Fixed32 angle32 = static_cast<Fixed32>(i * 0.01);
+
+		OHM_CHECK_NEAR(static_cast<double>(Ohm::Math::Sin(angle16)), std::sin(static_cast<double>(angle16)), 5e-5);
+		OHM_CHECK_NEAR(static_cast<double>(Ohm::Math::Cos(angle16)), std::cos(static_cast<double>(angle16)), 5e-5);
+		OHM_CHECK_NEAR(static_cast<double>(Ohm::Math::Sin(angle32)), std::sin(static_cast<double>(angle32)), 1e-7);
+		OHM_CHECK_NEAR(static_cast<double>(Ohm::Math::Cos(angle32)), std::cos(static_cast<double>(angle32)), 1e-7);
+	}
+}
+
+OHM_TEST(Fixed, VectorMatrixQuaternion)
+{
+	const Vector3<Fixed16> vector(Fixed16(3), Fixed16(0), Fixed16(-4));
+	OHM_CHECK(vector.Length() == Fixed16(5));
+	OHM_CHECK_NEAR(static_cast<double>(vector.GetNormalized().z), -0.8, 1e-4);
+
+	const Vector3<Fixed16> rotated = Vector3<Fixed16>(Fixed16(2), Fixed16(0), Fixed16(1)) * Matrix3x3<Fixed16>::CreateRotationAroundZ(static_cast<Fixed16>(0.5));
+	OHM_CHECK_NEAR(static_cast<double>(rotated.x), 2.0 * std::cos(0.5), 1e-4);
+	OHM_CHECK_NEAR(static_cast<double>(rotated.y), 2.0 * std::sin(0.5), 1e-4);
+	OHM_CHECK(rotated.z == Fixed16(1));
+
+	const Quaternion<Fixed32> rotation = Quaternion<Fixed32>::FromMatrix(Matrix3x3<Fixed32>::Rotate(static_cast<Fixed32>(0.4), static_cast<Fixed32>(-0.2), static_cast<Fixed32>(1.3)));
+	const Vector3<Fixed32> fixedRotated = rotation.Rotate(Vector3<Fixed32>(Fixed32(1), Fixed32(2), Fixed32(3)));
+	const Vector3<double> expected = Quaternion<double>::FromMatrix(Matrix3x3<double>::Rotate(0.4, -0.2, 1.3)).Rotate(Vector3<double>(1.0, 2.0, 3.0));
+
+	OHM_CHECK_NEAR(static_cast<double>(fixedRotated.x), expected.x, 1e-6);
+	OHM_CHECK_NEAR(static_cast<double>(fixedRotated.y), expected.y, 1e-6);
+	OHM_CHECK_NEAR(static_cast<double>(fixedRotated.z), expected.z, 1e-6);
+}
+
+OHM_TEST(Fixed, Deterministic)
+{
+	// Golden values, these must not change between compilers, platforms or OHM_NO_INT128.
+	OHM_CHECK(SimulateChecksum<Fixed16>() == 0xce124f96960f06a3ull);
+	OHM_CHECK(SimulateChecksum<Fixed32>() == 0x969c67381d4becd8ull);
+}
+
+OHM_TEST(Fixed, RuntimeMatchesConstexpr)
+{
+	// The run time Sqrt and Divide take shortcuts, they must still produce the exact same bits as the compile time path.
+	uint64_t seed = 88172645463325252ull;
+	for (int i = 0; i < 100000; i++)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+
+		const int32_t raw16 = static_cast<int32_t>(seed >> (33 + i % 31));
+		const int64_t raw32 = static_cast<int64_t>(seed >> (1 + i % 63));
+		const uint64_t root16 = Ohm::Math::Detail::IntegerSqrt(static_cast<uint64_t>(raw16) << 16);
+		const Ohm::Detail::UInt128 root32 = Ohm::Math::Detail::IntegerSqrt(Ohm::Detail::UInt128(static_cast<uint64_t>(raw32)) << 32);
+
+		OHM_CHECK(Fixed16::Sqrt(Fixed16::FromRaw(raw16)).GetRaw() == static_cast<int32_t>(root16));
+		OHM_CHECK(Fixed32::Sqrt(Fixed32::FromRaw(raw32)).GetRaw() == static_cast<int64_t>(root32.myLow));
+
+#if defined(__SIZEOF_INT128__)
+		const uint64_t divisor = (seed * 0x9E3779B97F4A7C15ull) >> (i % 64);
+		const Ohm::Detail::UInt128 numerator = Ohm::Detail::UInt128(static_cast<uint64_t>(raw32)) << 32;
+		if (divisor != 0)
+		{
+			const unsigned __int128 wide = (static_cast<unsigned __int128>(numerator.myHigh) << 64) | numerator.myLow;
+			OHM_CHECK(Ohm::Detail::Divide128x64(numerator, divisor) == static_cast<uint64_t>(wide / divisor));
+		}
+#endif
+	}
+}
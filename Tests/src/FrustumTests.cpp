@@ -0,0 +1,130 @@
+#include "Test.hpp"
+
+#include <Ohm/Geometry/FrustumBatch.hpp>
+
+#include <random>
+#include <vector>
+
+namespace
+{
+	template<typename T>
+	Matrix4x4<T> ViewProjection(const Vector3<T>& aEye, const Vector3<T>& aTarget)
+	{
+		const Matrix4x4<T> view = Matrix4x4<T>::GetFastInverse(Matrix4x4<T>::CreateLookAt(aEye, aTarget, Vector3<T>(0, 1, 0)));
+		return view * Matrix4x4<T>::CreatePerspective(static_cast<T>(Ohm::Math::Pi / 2.0), static_cast<T>(1), static_cast<T>(1), static_cast<T>(100));
+	}
+
+	template<typename T>
+	bool Visible(const Matrix4x4<T>& aViewProjection, const Vector3<T>& aPoint)
+	{
+		const Vector4<T> clip = Vector4<T>(aPoint, static_cast<T>(1)) * aViewProjection;
+		return clip.w > 0 && std::abs(clip.x) <= clip.w && std::abs(clip.y) <= clip.w && clip.z >= 0 && clip.z <= clip.w;
+	}
+}
+
+OHM_TEST(Frustum, Planes)
+{
+	const Frustum<float> frustum(ViewProjection(Vector3<float>(0.f), Vector3<float>(0.f, 0.f, 1.f)));
+
+	const Vector4<float>& nearPlane = frustum.GetPlane(FrustumPlane::Near);
+	const Vector4<float>& farPlane = frustum.GetPlane(FrustumPlane::Far);
+	const Vector4<float>& leftPlane = frustum.GetPlane(FrustumPlane::Left);
+	OHM_CHECK_NEAR(nearPlane.z, 1.f, 1e-6f);
+	OHM_CHECK_NEAR(nearPlane.w, -1.f, 1e-5f);
+	OHM_CHECK_NEAR(farPlane.z, -1.f, 1e-6f);
+	OHM_CHECK_NEAR(farPlane.w, 100.f, 1e-3f);
+	OHM_CHECK_NEAR(leftPlane.x, std::sqrt(0.5f), 1e-6f);
+	OHM_CHECK_NEAR(leftPlane.z, std::sqrt(0.5f), 1e-6f);
+
+	OHM_CHECK(frustum.Contains(Vector3<float>(0.f, 0.f, 10.f)));
+	OHM_CHECK(frustum.Contains(Vector3<float>(9.f, -9.f, 10.f)));
+	OHM_CHECK(!frustum.Contains(Vector3<float>(0.f, 0.f, 0.5f)));
+	OHM_CHECK(!frustum.Contains(Vector3<float>(0.f, 0.f, 101.f)));
+	OHM_CHECK(!frustum.Contains(Vector3<float>(11.f, 0.f, 10.f)));
+	OHM_CHECK(!frustum.Contains(Vector3<float>(0.f, 0.f, -10.f)));
+
+	OHM_CHECK(frustum.IntersectsSphere(Vector3<float>(11.f, 0.f, 10.f), 1.f));
+	OHM_CHECK(!frustum.IntersectsSphere(Vector3<float>(12.f, 0.f, 10.f), 1.f));
+	OHM_CHECK(frustum.Intersects(AABB<float>(Vector3<float>(10.5f, -1.f, 9.f), Vector3<float>(12.f, 1.f, 11.f))));
+	OHM_CHECK(!frustum.Intersects(AABB<float>(Vector3<float>(-1.f, -1.f, -5.f), Vector3<float>(1.f, 1.f, 0.5f))));
+
+	// OpenGL style depth: the near plane comes from w + z instead of z.
+	const double nearDistance = 2.0;
+	const double farDistance = 50.0;
+	Matrix4x4<double> glProjection = Matrix4x4<double>::CreatePerspective(Ohm::Math::Pi / 2.0, 1.0, nearDistance, farDistance);
+	glProjection(3, 3) = (farDistance + nearDistance) / (farDistance - nearDistance);
+	glProjection(4, 3) = -2.0 * farDistance * nearDistance / (farDistance - nearDistance);
+	const Frustum<double> glFrustum(glProjection, ClipDepth::MinusOneToOne);
+	OHM_CHECK_NEAR(glFrustum.GetPlane(FrustumPlane::Near).w, -nearDistance, 1e-12);
+	OHM_CHECK_NEAR(glFrustum.GetPlane(FrustumPlane::Far).w, farDistance, 1e-12);
+}
+
+OHM_TEST(Frustum, ConservativeTests)
+{
+	const Matrix4x4<double> viewProjection = ViewProjection(Vector3<double>(5.0, 2.0, -3.0), Vector3<double>(-4.0, 0.0, 20.0));
+	const Frustum<double> frustum(viewProjection);
+
+	std::mt19937 generator(1);
+	std::uniform_real_distribution<double> position(-60.0, 60.0);
+	std::uniform_real_distribution<double> size(0.1, 10.0);
+
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		const Vector3<double> point(position(generator), position(generator), position(generator));
+		OHM_CHECK(frustum.Contains(point) == Visible(viewProjection, point));
+
+		// A box with a visible corner must never be culled, a culled box has no visible corner.
+		const AABB<double> box = AABB<double>::FromCenterExtents(point, Vector3<double>(size(generator), size(generator), size(generator)));
+		bool anyCornerVisible = false;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			anyCornerVisible |= Visible(viewProjection, Vector3<double>((corner & 1) ? box.max.x : box.min.x, (corner & 2) ? box.max.y : box.min.y, (corner & 4) ? box.max.z : box.min.z));
+		}
+		OHM_CHECK(!anyCornerVisible || frustum.Intersects(box));
+
+		const double radius = size(generator);
+		const Vector3<double> offset = Vector3<double>(position(generator), position(generator), position(generator)).GetNormalized() * radius * 0.999;
+		OHM_CHECK(!Visible(viewProjection, point + offset) || frustum.IntersectsSphere(point, radius));
+	}
+}
+
+OHM_TEST(Frustum, BatchCulling)
+{
+	const Frustum<float> frustum(ViewProjection(Vector3<float>(1.f, 2.f, 3.f), Vector3<float>(10.f, -2.f, 30.f)));
+
+	std::mt19937 generator(2);
+	std::uniform_real_distribution<float> position(-80.f, 80.f);
+	std::uniform_real_distribution<float> size(0.1f, 8.f);
+
+	Vector3SoA<float> centers(Test::Count);
+	std::vector<float> radii(Test::Count);
+	AABBSoA<float> boxes(Test::Count);
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		const Vector3<float> center(position(generator), position(generator), position(generator));
+		centers.Set(i, center);
+		radii[i] = size(generator);
+		boxes.Set(i, AABB<float>::FromCenterExtents(center, Vector3<float>(size(generator), size(generator), size(generator))));
+	}
+
+	std::vector<uint64_t> sphereMask(Ohm::Simd::MaskWordCount(Test::Count), ~uint64_t(0));
+	std::vector<uint64_t> boxMask(Ohm::Simd::MaskWordCount(Test::Count), ~uint64_t(0));
+	CullSpheres(frustum, centers, radii.data(), sphereMask.data());
+	CullAABBs(frustum, boxes, boxMask.data());
+
+	size_t visibleSpheres = 0;
+	size_t visibleBoxes = 0;
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		OHM_CHECK(Test::GetBit(sphereMask, i) == frustum.IntersectsSphere(centers[i], radii[i]));
+		OHM_CHECK(Test::GetBit(boxMask, i) == frustum.Intersects(boxes[i]));
+		visibleSpheres += Test::GetBit(sphereMask, i) ? 1 : 0;
+		visibleBoxes += Test::GetBit(boxMask, i) ? 1 : 0;
+	}
+	OHM_CHECK(visibleSpheres > 0 && visibleSpheres < Test::Count);
+	OHM_CHECK(visibleBoxes > 0 && visibleBoxes < Test::Count);
+
+	// Bits past the last object are cleared.
+	OHM_CHECK((sphereMask.back() >> (Test::Count % 64)) == 0);
+	OHM_CHECK((boxMask.back() >> (Test::Count % 64)) == 0);
+}
@@ -0,0 +1,40 @@
+#include "Test.hpp"
+
+#include <cstring>
+
+// Usage: Tests [filter], only tests whose "Suite.Name" contains the filter are run.
+int main(int argc, char** argv)
+{
+	const char* filter = argc > 1 ? argv[1] : nullptr;
+
+	size_t run = 0;
+	size_t failed = 0;
+
+	for (const Test::Case& testCase : Test::GetCases())
+	{
+		char fullName[256];
+		std::snprintf(fullName, sizeof(fullName), "%s.%s", testCase.mySuite, testCase.myName);
+
+		if (filter && !std::strstr(fullName, filter))
+		{
+			continue;
+		}
+
+		const size_t failuresBefore = Test::GetFailureCount();
+		testCase.myFunction();
+		run++;
+
+		if (Test::GetFailureCount() != failuresBefore)
+		{
+			std::printf("[FAIL] %s\n", fullName);
+			failed++;
+		}
+		else
+		{
+			std::printf("[ OK ] %s\n", fullName);
+		}
+	}
+
+	std::printf("%zu tests run, %zu failed\n", run, failed);
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include "Test.hpp"
+
+#include <Ohm/Utility/FastMath.hpp>
+#include <Ohm/Matrix/Matrix4x4.hpp>
+#include <Ohm/Quaternion/Quaternion.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	// Largest error of aApproximate against aExact over aCount evenly spaced inputs in [aMin, aMax].
+	template<typename T, typename Approximate, typename Exact>
+	double MaxError(T aMin, T aMax, int aCount, bool aRelative, Approximate&& aApproximate, Exact&& aExact)
+	{
+		double maxError = 0.0;
+		for (int i = 0; i <= aCount; ++i)
+		{
+			const T value = aMin + (aMax - aMin) * static_cast<T>(i) / static_cast<T>(aCount);
+			const double exact = aExact(static_cast<double>(value));
+			double error = std::abs(static_cast<double>(aApproximate(value)) - exact);
+			if (aRelative)
+			{
+				error /= std::abs(exact);
+			}
+			maxError = std::max(maxError, error);
+		}
+		return maxError;
+	}
+
+	template<MathAccuracy Accuracy, typename T>
+	void CheckTier(double aTolerance)
+	{
+		using namespace Ohm::Math;
+
+		OHM_CHECK(MaxError<T>(static_cast<T>(1e-6), static_cast<T>(1e6), 20000, true, [](T aValue) { return InvSqrt<Accuracy>(aValue); }, [](double aValue) { return 1.0 / std::sqrt(aValue); }) < aTolerance);
+		OHM_CHECK(MaxError<T>(static_cast<T>(1e-6), static_cast<T>(1e6), 20000, true, [](T aValue) { return Sqrt<Accuracy>(aValue); }, [](double aValue) { return std::sqrt(aValue); }) < aTolerance);
+		OHM_CHECK(MaxError<T>(static_cast<T>(-100), static_cast<T>(100), 20000, false, [](T aValue) { T sin = 0; T cos = 0; SinCos<Accuracy>(aValue, sin, cos); return sin; }, [](double aValue) { return std::sin(aValue); }) < aTolerance);
+		OHM_CHECK(MaxError<T>(static_cast<T>(-100), static_cast<T>(100), 20000, false, [](T aValue) { T sin = 0; T cos = 0; SinCos<Accuracy>(aValue, sin, cos); return cos; }, [](double aValue) { return std::cos(aValue); }) < aTolerance);
+		OHM_CHECK(MaxError<T>(static_cast<T>(-1), static_cast<T>(1), 20000, false, [](T aValue) { return Acos<Accuracy>(aValue); }, [](double aValue) { return std::acos(aValue); }) < aTolerance);
+
+		// Every octant, including the axes.
+		double maxError = 0.0;
+		for (int i = 0; i < 3600; ++i)
+		{
+			const double angle = static_cast<double>(i) * Pi / 1800.0 - Pi;
+			const T y = static_cast<T>(std::sin(angle) * 3.0);
+			const T x = static_cast<T>(std::cos(angle) * 3.0);
+			maxError = std::max(maxError, std::abs(static_cast<double>(Atan2<Accuracy>(y, x)) - std::atan2(static_cast<double>(y), static_cast<double>(x))));
+		}
+		OHM_CHECK(maxError < aTolerance);
+		OHM_CHECK(Atan2<Accuracy>(static_cast<T>(0), static_cast<T>(0)) == static_cast<T>(0));
+
+		// Angles beyond the range reduction and non finite ones match the exact functions.
+		for (const T angle : { static_cast<T>(1e10), static_cast<T>(-3e5), std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN() })
+		{
+			T sin = 0;
+			T cos = 0;
+			SinCos<Accuracy>(angle, sin, cos);
+			if (std::isfinite(angle))
+			{
+				OHM_CHECK(sin == std::sin(angle) && cos == std::cos(angle));
+			}
+			else
+			{
+				OHM_CHECK(std::isnan(sin) && std::isnan(cos));
+			}
+		}
+	}
+}
+
+OHM_TEST(Math, FastTier)
+{
+	CheckTier<MathAccuracy::Fast, float>(2e-6);
+	CheckTier<MathAccuracy::Fast, double>(1e-6);
+}
+
+OHM_TEST(Math, ApproximateTier)
+{
+	CheckTier<MathAccuracy::Approximate, float>(1e-3);
+	CheckTier<MathAccuracy::Approximate, double>(1e-3);
+}
+
+OHM_TEST(Math, ExactTierMatchesStandard)
+{
+	OHM_CHECK(Ohm::Math::Sqrt<MathAccuracy::Exact>(2.0) == std::sqrt(2.0));
+	OHM_CHECK(Ohm::Math::Acos<MathAccuracy::Exact>(0.3) == std::acos(0.3));
+	OHM_CHECK(Ohm::Math::Atan2<MathAccuracy::Exact>(0.3, -0.7) == std::atan2(0.3, -0.7));
+	// Types without approximations take the exact path on every tier.
+	OHM_CHECK(Ohm::Math::Sqrt<MathAccuracy::Fast>(49) == 7);
+
+	static_assert(Ohm::Math::InvSqrt<MathAccuracy::Fast>(4.0) == 0.5);
+	static_assert(Ohm::Math::Sqrt<MathAccuracy::Approximate>(16.f) == 4.f);
+}
+
+#if defined(OHM_SIMD_SSE2)
+OHM_TEST(Math, SimdInvSqrtMatchesScalar)
+{
+	const __m128 values = _mm_setr_ps(0.001f, 2.f, 17.5f, 4096.f);
+	alignas(16) float fast[4];
+	alignas(16) float approximate[4];
+	alignas(16) float input[4];
+	_mm_store_ps(fast, Ohm::Simd::InvSqrt<MathAccuracy::Fast>(values));
+	_mm_store_ps(approximate, Ohm::Simd::InvSqrt<MathAccuracy::Approximate>(values));
+	_mm_store_ps(input, values);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		OHM_CHECK(fast[i] == Ohm::Math::InvSqrt<MathAccuracy::Fast>(input[i]));
+		OHM_CHECK(approximate[i] == Ohm::Math::InvSqrt<MathAccuracy::Approximate>(input[i]));
+	}
+}
+#endif
+
+OHM_TEST(Math, BuildersOptIn)
+{
+	const Vector3<float> vector(3.f, -4.f, 12.f);
+	const Vector3<float> exact = vector.GetNormalizedWith<MathAccuracy::Exact>();
+	const Vector3<float> fast = vector.GetNormalizedWith<MathAccuracy::Fast>();
+	OHM_CHECK_NEAR(fast.x, exact.x, 1e-6f);
+	OHM_CHECK_NEAR(fast.y, exact.y, 1e-6f);
+	OHM_CHECK_NEAR(fast.z, exact.z, 1e-6f);
+	OHM_CHECK_NEAR(vector.LengthWith<MathAccuracy::Approximate>(), 13.f, 13e-3f);
+
+	Vector4<float> simdVector(1.f, 2.f, -2.f, 4.f);
+	simdVector.NormalizeWith<MathAccuracy::Fast>();
+	OHM_CHECK_NEAR(simdVector.x, 0.2f, 1e-6f);
+	OHM_CHECK_NEAR(simdVector.w, 0.8f, 1e-6f);
+
+	const Matrix4x4<float> exactRotation = Matrix4x4<float>::CreateRotation(0.3f, -1.2f, 2.5f);
+	const Matrix4x4<float> fastRotation = Matrix4x4<float>::CreateRotationWith<MathAccuracy::Fast>(0.3f, -1.2f, 2.5f);
+	const Matrix3x3<float> approximateRotation = Matrix3x3<float>::CreateRotationAroundYWith<MathAccuracy::Approximate>(-1.2f);
+	for (int row = 1; row <= 3; ++row)
+	{
+		for (int column = 1; column <= 3; ++column)
+		{
+			OHM_CHECK_NEAR(fastRotation(row, column), exactRotation(row, column), 2e-6f);
+			OHM_CHECK_NEAR(approximateRotation(row, column), Matrix3x3<float>::CreateRotationAroundY(-1.2f)(row, column), 1e-3f);
+		}
+	}
+
+	const Quaternion<double> from = Quaternion<double>(0.2, -0.5, 0.7, 0.4).GetNormalized();
+	const Quaternion<double> to = Quaternion<double>(-0.6, 0.1, 0.3, 0.5).GetNormalizedWith<MathAccuracy::Fast>();
+	const Quaternion<double> exactSlerp = Quaternion<double>::Slerp(from, to, 0.35);
+	const Quaternion<double> fastSlerp = Quaternion<double>::SlerpWith<MathAccuracy::Fast>(from, to, 0.35);
+	const Quaternion<double> approximateSlerp = Quaternion<double>::SlerpWith<MathAccuracy::Approximate>(from, to, 0.35);
+	OHM_CHECK_NEAR(fastSlerp.x, exactSlerp.x, 1e-6);
+	OHM_CHECK_NEAR(fastSlerp.y, exactSlerp.y, 1e-6);
+	OHM_CHECK_NEAR(fastSlerp.z, exactSlerp.z, 1e-6);
+	OHM_CHECK_NEAR(fastSlerp.w, exactSlerp.w, 1e-6);
+	OHM_CHECK_NEAR(approximateSlerp.x, exactSlerp.x, 2e-3);
+	OHM_CHECK_NEAR(approximateSlerp.y, exactSlerp.y, 2e-3);
+	OHM_CHECK_NEAR(approximateSlerp.z, exactSlerp.z, 2e-3);
+	OHM_CHECK_NEAR(approximateSlerp.w, exactSlerp.w, 2e-3);
+}
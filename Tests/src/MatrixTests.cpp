@@ -0,0 +1,260 @@
+#include "Test.hpp"
+
+#include <Ohm/Matrix/Matrix3x4.hpp>
+#include <Ohm/Matrix/Matrix4x4.hpp>
+#include <Ohm/Matrix/TransformBatch.hpp>
+
+#include <vector>
+
+namespace
+{
+	template<typename T>
+	Matrix4x4<T> CreateTestTransform()
+	{
+		return Matrix4x4<T>::CreateRotation(static_cast<T>(0.3), static_cast<T>(-1.1), static_cast<T>(2.2)) *
+			Matrix4x4<T>::CreateTranslation(Vector3<T>(static_cast<T>(4), static_cast<T>(-2), static_cast<T>(0.5)));
+	}
+
+	template<typename T>
+	bool IsIdentity(const Matrix4x4<T>& aMatrix, T aTolerance)
+	{
+		for (int row = 1; row <= 4; row++)
+		{
+			for (int column = 1; column <= 4; column++)
+			{
+				const T expected = row == column ? static_cast<T>(1) : static_cast<T>(0);
+				if (std::abs(aMatrix(row, column) - expected) > aTolerance)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// Rotation, translation and a sheared non-uniform scale, so every element of the 3x4 part is used.
+	template<typename T>
+	Matrix4x4<T> CreateTestAffine()
+	{
+		Matrix4x4<T> scale;
+		scale(1, 1) = static_cast<T>(2);
+		scale(2, 2) = static_cast<T>(0.5);
+		scale(3, 3) = static_cast<T>(1.5);
+		scale(2, 1) = static_cast<T>(0.25);
+		return scale * CreateTestTransform<T>();
+	}
+
+	template<typename T>
+	void CheckSameTransform(const Matrix3x4<T>& aMatrix, const Matrix4x4<T>& aExpected, T aTolerance)
+	{
+		for (int row = 1; row <= 4; row++)
+		{
+			for (int column = 1; column <= 4; column++)
+			{
+				OHM_CHECK_NEAR(aMatrix.ToMatrix4x4()(row, column), aExpected(row, column), aTolerance);
+			}
+		}
+	}
+
+	template<typename T>
+	void TestMatrix3x4(T aTolerance)
+	{
+		const Matrix4x4<T> a = CreateTestAffine<T>();
+		const Matrix4x4<T> b = CreateTestTransform<T>() * Matrix4x4<T>::CreateTranslation(Vector3<T>(static_cast<T>(-1), static_cast<T>(3), static_cast<T>(2)));
+		const Matrix3x4<T> compactA(a);
+		const Matrix3x4<T> compactB(b);
+
+		OHM_CHECK(compactA.ToMatrix4x4() == a);
+		OHM_CHECK(compactA(1, 4) == a(4, 1) && compactA(3, 2) == a(2, 3));
+		OHM_CHECK(Matrix3x4<T>(compactA.ToMatrix3x3(), compactA.GetTranslation()) == compactA);
+		CheckSameTransform(compactA * compactB, a * b, aTolerance);
+
+		Matrix3x4<T> product = compactA;
+		product *= compactB;
+		OHM_CHECK(product == compactA * compactB);
+
+		const Vector3<T> point(static_cast<T>(1.5), static_cast<T>(-2), static_cast<T>(0.75));
+		const Vector4<T> expectedPoint = Vector4<T>(point, static_cast<T>(1)) * a;
+		const Vector4<T> expectedDirection = Vector4<T>(point, static_cast<T>(0)) * a;
+		OHM_CHECK_NEAR(compactA.TransformPoint(point).x, expectedPoint.x, aTolerance);
+		OHM_CHECK_NEAR(compactA.TransformPoint(point).y, expectedPoint.y, aTolerance);
+		OHM_CHECK_NEAR(compactA.TransformPoint(point).z, expectedPoint.z, aTolerance);
+		OHM_CHECK_NEAR(compactA.TransformDirection(point).x, expectedDirection.x, aTolerance);
+		OHM_CHECK_NEAR(compactA.TransformDirection(point).y, expectedDirection.y, aTolerance);
+		OHM_CHECK_NEAR(compactA.TransformDirection(point).z, expectedDirection.z, aTolerance);
+
+		Matrix3x4<T> inverse;
+		T determinant = 0;
+		OHM_CHECK(Matrix3x4<T>::Inverse(compactA, inverse, &determinant));
+		OHM_CHECK_NEAR(determinant, static_cast<T>(1.5), aTolerance);
+		OHM_CHECK(IsIdentity((compactA * inverse).ToMatrix4x4(), aTolerance));
+		OHM_CHECK(IsIdentity((inverse * compactA).ToMatrix4x4(), aTolerance));
+		OHM_CHECK(IsIdentity((compactB * Matrix3x4<T>::GetFastInverse(compactB)).ToMatrix4x4(), aTolerance));
+
+		Matrix3x4<T> singular = Matrix3x4<T>::CreateTranslation(point);
+		singular(2) = singular(1);
+		Matrix3x4<T> untouched;
+		OHM_CHECK(!Matrix3x4<T>::Inverse(singular, untouched));
+		OHM_CHECK(untouched == Matrix3x4<T>());
+
+		// Same local matrix as Quaternion::ToMatrix4x4 with the rows scaled and the translation appended.
+		const Quaternion<T> rotation = Quaternion<T>(static_cast<T>(0.2), static_cast<T>(-0.7), static_cast<T>(0.4), static_cast<T>(0.5)).GetNormalized();
+		const Vector3<T> scale(static_cast<T>(2), static_cast<T>(0.5), static_cast<T>(3));
+		Matrix4x4<T> local = rotation.ToMatrix4x4();
+		local(1) = local(1) * scale.x;
+		local(2) = local(2) * scale.y;
+		local(3) = local(3) * scale.z;
+		local(4) = Vector4<T>(point, static_cast<T>(1));
+		CheckSameTransform(Matrix3x4<T>::CreateTransform(point, rotation, scale), local, aTolerance);
+		CheckSameTransform(Matrix3x4<T>::CreateTranslation(point), Matrix4x4<T>::CreateTranslation(point), static_cast<T>(0));
+	}
+}
+
+OHM_TEST(Matrix4x4, MultiplyFloatMatchesDouble)
+{
+	const Matrix4x4<float> a = CreateTestTransform<float>();
+	const Matrix4x4<float> b = Matrix4x4<float>::CreatePerspective(1.2f, 1.5f, 0.1f, 100.f);
+	const Matrix4x4<double> ad = CreateTestTransform<double>();
+	const Matrix4x4<double> bd = Matrix4x4<double>::CreatePerspective(1.2, 1.5, 0.1, 100.0);
+
+	const Matrix4x4<float> product = a * b;
+	const Matrix4x4<double> productDouble = ad * bd;
+
+	for (int row = 1; row <= 4; row++)
+	{
+		for (int column = 1; column <= 4; column++)
+		{
+			OHM_CHECK_NEAR(static_cast<double>(product(row, column)), productDouble(row, column), 1e-4);
+		}
+	}
+}
+
+OHM_TEST(Matrix4x4, Inverse)
+{
+	const Matrix4x4<float> matrix = CreateTestTransform<float>() * Matrix4x4<float>::CreatePerspective(1.f, 1.f, 1.f, 10.f);
+
+	Matrix4x4<float> inverse;
+	OHM_CHECK(Matrix4x4<float>::Inverse(matrix, inverse));
+	OHM_CHECK(IsIdentity(matrix * inverse, 1e-4f));
+
+	Matrix4x4<double> singular;
+	singular(2) = singular(1);
+	Matrix4x4<double> untouched;
+	OHM_CHECK(!Matrix4x4<double>::Inverse(singular, untouched));
+	OHM_CHECK(IsIdentity(untouched, 0.0));
+
+	// The float SIMD path has its own early return.
+	Matrix4x4<float> singularFloat;
+	singularFloat(2) = singularFloat(1);
+	Matrix4x4<float> untouchedFloat;
+	OHM_CHECK(!Matrix4x4<float>::Inverse(singularFloat, untouchedFloat));
+	OHM_CHECK(IsIdentity(untouchedFloat, 0.f));
+}
+
+OHM_TEST(Matrix4x4, AffineAndFastInverse)
+{
+	const Matrix4x4<double> transform = CreateTestTransform<double>();
+
+	Matrix4x4<double> inverse;
+	double determinant = 0.0;
+	OHM_CHECK(Matrix4x4<double>::InverseAffine(transform, inverse, &determinant));
+	OHM_CHECK_NEAR(determinant, 1.0, 1e-12);
+	OHM_CHECK(IsIdentity(transform * inverse, 1e-12));
+	OHM_CHECK(IsIdentity(transform * Matrix4x4<double>::GetFastInverse(transform), 1e-12));
+
+	// The float SIMD kernel against the double result.
+	const Matrix4x4<float> transformFloat = CreateTestTransform<float>();
+	Matrix4x4<float> inverseFloat;
+	float determinantFloat = 0.f;
+	OHM_CHECK(Matrix4x4<float>::InverseAffine(transformFloat, inverseFloat, &determinantFloat));
+	OHM_CHECK_NEAR(determinantFloat, 1.f, 1e-5f);
+	for (int row = 1; row <= 4; row++)
+	{
+		for (int column = 1; column <= 4; column++)
+		{
+			OHM_CHECK_NEAR(static_cast<double>(inverseFloat(row, column)), inverse(row, column), 1e-4);
+		}
+	}
+
+	Matrix4x4<float> singular = transformFloat;
+	singular(3) = Vector4<float>(0.f, 0.f, 0.f, 0.f);
+	Matrix4x4<float> untouched;
+	OHM_CHECK(!Matrix4x4<float>::InverseAffine(singular, untouched));
+	OHM_CHECK(IsIdentity(untouched, 0.f));
+}
+
+OHM_TEST(TransformBatch, MatchesSingleTransform)
+{
+	constexpr size_t count = 19;
+
+	const Matrix4x4<float> transform = CreateTestTransform<float>();
+	std::vector<Vector3<float>> points(count);
+	std::vector<Vector3<float>> transformed(count);
+	std::vector<Vector3<float>> directions(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const float value = static_cast<float>(i);
+		points[i] = Vector3<float>(value, 1.f - value, value * 0.25f);
+	}
+
+	TransformPoints(transform, points.data(), transformed.data(), count);
+	TransformDirections(transform, points.data(), directions.data(), count);
+
+	// Empty batches may pass null pointers.
+	TransformPoints(transform, static_cast<const Vector3<float>*>(nullptr), static_cast<Vector3<float>*>(nullptr), 0);
+	TransformDirections(transform, static_cast<const Vector4<float>*>(nullptr), static_cast<Vector4<float>*>(nullptr), 0);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const Vector4<float> point = Vector4<float>(points[i], 1.f) * transform;
+		const Vector4<float> direction = Vector4<float>(points[i], 0.f) * transform;
+
+		OHM_CHECK_NEAR(transformed[i].x, point.x, 1e-4f);
+		OHM_CHECK_NEAR(transformed[i].y, point.y, 1e-4f);
+		OHM_CHECK_NEAR(transformed[i].z, point.z, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].x, direction.x, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].y, direction.y, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].z, direction.z, 1e-4f);
+	}
+}
+
+OHM_TEST(Matrix3x4, MatchesMatrix4x4)
+{
+	TestMatrix3x4<float>(1e-5f);
+	TestMatrix3x4<double>(1e-12);
+
+	constexpr Matrix3x4<float> translation = Matrix3x4<float>::CreateTranslation(Vector3<float>(1.f, 2.f, 3.f));
+	constexpr Matrix3x4<float> product = translation * translation;
+	static_assert(product(2, 4) == 4.f);
+}
+
+OHM_TEST(TransformBatch, Matrix3x4MatchesSingleTransform)
+{
+	constexpr size_t count = 19;
+
+	const Matrix3x4<float> transform(CreateTestAffine<float>());
+	std::vector<Vector3<float>> points(count);
+	std::vector<Vector3<float>> transformed(count);
+	std::vector<Vector3<float>> directions(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const float value = static_cast<float>(i);
+		points[i] = Vector3<float>(value, 1.f - value, value * 0.25f);
+	}
+
+	TransformPoints(transform, points.data(), transformed.data(), count);
+	TransformDirections(transform, points.data(), directions.data(), count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const Vector3<float> point = transform.TransformPoint(points[i]);
+		const Vector3<float> direction = transform.TransformDirection(points[i]);
+
+		OHM_CHECK_NEAR(transformed[i].x, point.x, 1e-4f);
+		OHM_CHECK_NEAR(transformed[i].y, point.y, 1e-4f);
+		OHM_CHECK_NEAR(transformed[i].z, point.z, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].x, direction.x, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].y, direction.y, 1e-4f);
+		OHM_CHECK_NEAR(directions[i].z, direction.z, 1e-4f);
+	}
+}
@@ -0,0 +1,165 @@
+#include "Test.hpp"
+
+#include <Ohm/Matrix/TransformBatch.hpp>
+#include <Ohm/Utility/Memory.hpp>
+#include <Ohm/Vector/Vector3SoA.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	bool IsAligned(const void* aPointer, size_t aAlignment)
+	{
+		return reinterpret_cast<uintptr_t>(aPointer) % aAlignment == 0;
+	}
+}
+
+OHM_TEST(Memory, AllocationStats)
+{
+	Ohm::Memory::ResetAllocationStats();
+	const Ohm::Memory::AllocationStats before = Ohm::Memory::GetAllocationStats();
+	OHM_CHECK(before.allocationCount == 0 && before.freeCount == 0 && before.bytesAllocated == 0);
+
+	void* block = Ohm::Memory::AllocateAligned(1000, 32);
+	OHM_CHECK(IsAligned(block, 32));
+	{
+		const Ohm::Memory::AllocationStats stats = Ohm::Memory::GetAllocationStats();
+		OHM_CHECK(stats.allocationCount == 1 && stats.bytesAllocated == 1000);
+		OHM_CHECK(stats.bytesInUse == before.bytesInUse + 1000);
+		OHM_CHECK(stats.peakBytesInUse >= stats.bytesInUse);
+	}
+	Ohm::Memory::FreeAligned(block, 1000, 32);
+
+	// The SoA containers allocate through the same counters.
+	{
+		Vector3SoA<float> soa(100);
+	}
+	const Ohm::Memory::AllocationStats after = Ohm::Memory::GetAllocationStats();
+	OHM_CHECK(after.allocationCount == 2 && after.freeCount == 2);
+	OHM_CHECK(after.bytesInUse == before.bytesInUse);
+}
+
+OHM_TEST(Memory, AlignedAllocator)
+{
+	std::vector<Vector4<float>, AlignedAllocator<Vector4<float>>> vectors;
+	for (int i = 0; i < 100; i++)
+	{
+		vectors.push_back(Vector4<float>(static_cast<float>(i)));
+		OHM_CHECK(IsAligned(vectors.data(), Ohm::Simd::Alignment));
+	}
+	OHM_CHECK(vectors[42].x == 42.f);
+
+	std::vector<double, AlignedAllocator<double, 16>> doubles(7, 1.0);
+	OHM_CHECK(IsAligned(doubles.data(), 16));
+}
+
+OHM_TEST(Memory, FrameArena)
+{
+	FrameArena arena(256);
+	OHM_CHECK(arena.GetCapacity() == 256);
+
+	// Allocations are aligned and do not overlap.
+	char* a = static_cast<char*>(arena.Allocate(3, 1));
+	float* b = arena.Allocate<float>(5);
+	char* c = static_cast<char*>(arena.Allocate(8, 8));
+	OHM_CHECK(IsAligned(b, Ohm::Simd::Alignment) && IsAligned(c, 8));
+	OHM_CHECK(a + 3 <= reinterpret_cast<char*>(b) && reinterpret_cast<char*>(b + Ohm::Simd::PaddedCount<float>(5)) <= c);
+	OHM_CHECK(arena.GetOverflowCount() == 0);
+
+	// Overflow while full, then one block for the whole frame after Reset.
+	Vector4<float>* large = arena.Allocate<Vector4<float>>(100);
+	OHM_CHECK(IsAligned(large, Ohm::Simd::Alignment));
+	large[99] = Vector4<float>(1.f);
+	OHM_CHECK(arena.GetOverflowCount() == 1);
+	const size_t frameBytes = arena.GetUsed();
+	OHM_CHECK(arena.GetPeak() == frameBytes);
+
+	arena.Reset();
+	OHM_CHECK(arena.GetUsed() == 0);
+	OHM_CHECK(arena.GetCapacity() >= frameBytes);
+
+	// The same frame again stays within the arena and off the heap.
+	const uint64_t allocations = Ohm::Memory::GetAllocationStats().allocationCount;
+	for (int frame = 0; frame < 3; frame++)
+	{
+		arena.Allocate(3, 1);
+		arena.Allocate<float>(5);
+		arena.Allocate(8, 8);
+		arena.Allocate<Vector4<float>>(100);
+		arena.Reset();
+	}
+	OHM_CHECK(arena.GetOverflowCount() == 1);
+	OHM_CHECK(Ohm::Memory::GetAllocationStats().allocationCount == allocations);
+}
+
+OHM_TEST(Memory, AlignedArray)
+{
+	AlignedArray<Vector3<float>> points(10);
+	OHM_CHECK(points.Size() == 10 && points.Capacity() == points.PaddedSize());
+	OHM_CHECK(IsAligned(points.Data(), Ohm::Simd::Alignment));
+	OHM_CHECK(points[9].x == 0.f && points[9].y == 0.f && points[9].z == 0.f);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		points.PushBack(Vector3<float>(static_cast<float>(i), 1.f, 2.f));
+	}
+	OHM_CHECK(points.Size() == 1010 && points[1009].x == 999.f);
+	OHM_CHECK(IsAligned(points.Data(), Ohm::Simd::Alignment));
+
+	// Self referencing PushBack across a reallocation.
+	AlignedArray<float> values;
+	values.PushBack(3.f);
+	for (int i = 0; i < 100; i++)
+	{
+		values.PushBack(values[0]);
+	}
+	OHM_CHECK(values.Size() == 101 && values[100] == 3.f);
+
+	const AlignedArray<Vector3<float>> copy = points;
+	OHM_CHECK(copy.Size() == points.Size() && copy[500].x == points[500].x && copy.Data() != points.Data());
+
+	AlignedArray<Vector3<float>> moved = std::move(points);
+	OHM_CHECK(moved.Size() == 1010 && points.Size() == 0 && points.Data() == nullptr);
+
+	// Shrinking keeps the storage, growing again value initializes.
+	const Vector3<float>* storage = moved.Data();
+	moved.Resize(5);
+	moved.Resize(20);
+	OHM_CHECK(moved.Data() == storage && moved[10].x == 0.f);
+	moved.Clear();
+	OHM_CHECK(moved.Empty() && moved.Capacity() > 0);
+}
+
+OHM_TEST(Memory, ArenaScratchForBatchKernels)
+{
+	constexpr size_t Count = 1001;
+	std::vector<Vector3<float>> points(Count);
+	for (size_t i = 0; i < Count; i++)
+	{
+		points[i] = Vector3<float>(static_cast<float>(i), -static_cast<float>(i), 0.5f);
+	}
+	const Matrix4x4<float> matrix = Matrix4x4<float>::CreateRotation(0.3f, -1.1f, 0.7f) * Matrix4x4<float>::CreateTranslation(Vector3<float>(1.f, -2.f, 3.f));
+
+	std::vector<Vector3<float>> expected(Count);
+	TransformPoints(matrix, points.data(), expected.data(), Count);
+
+	// Per-frame outputs and temporaries from the arena, the first frame sizes it and later ones never allocate.
+	FrameArena arena;
+	uint64_t allocations = 0;
+	for (int frame = 0; frame < 4; frame++)
+	{
+		if (frame == 1)
+		{
+			allocations = Ohm::Memory::GetAllocationStats().allocationCount;
+		}
+
+		AlignedArray<Vector3<float>> transformed(Count, arena);
+		AlignedArray<Vector3<float>> temporary(Count, arena);
+		TransformPoints(matrix, points.data(), temporary.Data(), Count);
+		TransformPoints(Matrix4x4<float>(), temporary.Data(), transformed.Data(), Count);
+		OHM_CHECK(transformed[Count - 1].x == expected[Count - 1].x && transformed[7].y == expected[7].y);
+		arena.Reset();
+	}
+	OHM_CHECK(Ohm::Memory::GetAllocationStats().allocationCount == allocations);
+}
@@ -1,18 +0,0 @@
-#include "CppUnitTest.h"
-
-#include <Ohm/Matrix/Matrix4x4.hpp>
-#include <Ohm/Matrix/Matrix3x3.hpp>
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-
-namespace OhmTest
-{
-	TEST_CLASS(OhmTest)
-	{
-	public:
-
-		TEST_METHOD(TestMethod1)
-		{
-		}
-	};
-}
@@ -0,0 +1,118 @@
+#include "Test.hpp"
+
+#include <Ohm/Quaternion/Quaternion.hpp>
+#include <Ohm/Quaternion/QuaternionBatch.hpp>
+
+#include <vector>
+
+OHM_TEST(Quaternion, HamiltonProduct)
+{
+	const Quaternion<float> i(1.f, 0.f, 0.f, 0.f);
+	const Quaternion<float> j(0.f, 1.f, 0.f, 0.f);
+	const Quaternion<float> k = i * j;
+
+	OHM_CHECK_NEAR(k.x, 0.f, 0.f);
+	OHM_CHECK_NEAR(k.y, 0.f, 0.f);
+	OHM_CHECK_NEAR(k.z, 1.f, 0.f);
+	OHM_CHECK_NEAR(k.w, 0.f, 0.f);
+}
+
+OHM_TEST(Quaternion, RotateMatchesMatrix)
+{
+	const Quaternion<double> rotation = Quaternion<double>(0.2, -0.5, 0.7, 0.4).GetNormalized();
+	const Vector3<double> vector(1.0, -2.0, 3.0);
+
+	const Vector3<double> rotated = rotation.Rotate(vector);
+	const Vector3<double> expected = vector * rotation.ToMatrix3x3();
+
+	OHM_CHECK_NEAR(rotated.x, expected.x, 1e-12);
+	OHM_CHECK_NEAR(rotated.y, expected.y, 1e-12);
+	OHM_CHECK_NEAR(rotated.z, expected.z, 1e-12);
+
+	const Quaternion<double> roundTrip = Quaternion<double>::FromMatrix(rotation.ToMatrix4x4());
+	OHM_CHECK_NEAR(std::abs(roundTrip.Dot(rotation)), 1.0, 1e-12);
+}
+
+OHM_TEST(Quaternion, Slerp)
+{
+	const Quaternion<float> from(0.f, 0.f, 0.f, 1.f);
+	const Quaternion<float> to(0.f, 0.f, std::sin(0.5f), std::cos(0.5f));
+	const Quaternion<float> halfway = Quaternion<float>::Slerp(from, to, 0.5f);
+
+	OHM_CHECK_NEAR(halfway.z, std::sin(0.25f), 1e-6f);
+	OHM_CHECK_NEAR(halfway.w, std::cos(0.25f), 1e-6f);
+}
+
+OHM_TEST(QuaternionBatch, MatchesScalar)
+{
+	constexpr size_t count = 21;
+
+	std::vector<Quaternion<float>> a(count);
+	std::vector<Quaternion<float>> b(count);
+	std::vector<Vector3<float>> vectors(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const float value = static_cast<float>(i);
+		a[i] = Quaternion<float>(std::sin(value), 0.5f, -0.25f * value, 2.f).GetNormalized();
+		b[i] = Quaternion<float>(0.3f, std::cos(value), 1.f, -0.5f).GetNormalized();
+		vectors[i] = Vector3<float>(value, -1.f, 2.f);
+	}
+
+	std::vector<Quaternion<float>> products(count);
+	std::vector<Quaternion<float>> slerped(count);
+	std::vector<Vector3<float>> rotated(count);
+	std::vector<Quaternion<float>> nlerped(count);
+	std::vector<float> factors(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		factors[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+	}
+	MultiplyQuaternions(a.data(), b.data(), products.data(), count);
+	SlerpQuaternions(a.data(), b.data(), 0.3f, slerped.data(), count, QuaternionInterpolation::Approximate);
+	RotateVectors(a.data(), vectors.data(), rotated.data(), count);
+	NlerpQuaternions(a.data(), b.data(), factors.data(), nlerped.data(), count);
+
+	std::vector<Quaternion<float>> unnormalized(count);
+	std::vector<Quaternion<float>> normalized(count);
+	std::vector<Matrix4x4<float>> matrices(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		unnormalized[i] = Quaternion<float>(a[i].x * 3.f, a[i].y * 3.f, a[i].z * 3.f, a[i].w * 3.f);
+	}
+	NormalizeQuaternions(unnormalized.data(), normalized.data(), count);
+	QuaternionsToMatrices(a.data(), matrices.data(), count);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const Quaternion<float> product = a[i] * b[i];
+		const Quaternion<float> slerp = Quaternion<float>::Slerp(a[i], b[i], 0.3f);
+		const Vector3<float> rotation = a[i].Rotate(vectors[i]);
+		const Quaternion<float> nlerp = Quaternion<float>::Nlerp(a[i], b[i], factors[i]);
+
+		OHM_CHECK_NEAR(products[i].x, product.x, 1e-6f);
+		OHM_CHECK_NEAR(products[i].w, product.w, 1e-6f);
+		OHM_CHECK_NEAR(std::abs(slerped[i].Dot(slerp)), 1.f, 1e-5f);
+		OHM_CHECK_NEAR(rotated[i].x, rotation.x, 1e-5f);
+		OHM_CHECK_NEAR(rotated[i].y, rotation.y, 1e-5f);
+		OHM_CHECK_NEAR(rotated[i].z, rotation.z, 1e-5f);
+		OHM_CHECK_NEAR(nlerped[i].x, nlerp.x, 1e-6f);
+		OHM_CHECK_NEAR(nlerped[i].y, nlerp.y, 1e-6f);
+		OHM_CHECK_NEAR(nlerped[i].z, nlerp.z, 1e-6f);
+		OHM_CHECK_NEAR(nlerped[i].w, nlerp.w, 1e-6f);
+
+		const Quaternion<float> normal = unnormalized[i].GetNormalized();
+		OHM_CHECK_NEAR(normalized[i].x, normal.x, 1e-6f);
+		OHM_CHECK_NEAR(normalized[i].y, normal.y, 1e-6f);
+		OHM_CHECK_NEAR(normalized[i].z, normal.z, 1e-6f);
+		OHM_CHECK_NEAR(normalized[i].w, normal.w, 1e-6f);
+
+		const Matrix4x4<float> matrix = a[i].ToMatrix4x4();
+		for (int row = 1; row <= 4; row++)
+		{
+			for (int column = 1; column <= 4; column++)
+			{
+				OHM_CHECK_NEAR(matrices[i](row, column), matrix(row, column), 1e-6f);
+			}
+		}
+	}
+}
@@ -0,0 +1,158 @@
+#include "Test.hpp"
+
+#include <Ohm/Geometry/RayBatch.hpp>
+
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	std::vector<Ray<float>> RandomRays(size_t aCount, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_real_distribution<float> position(-10.f, 10.f);
+		std::normal_distribution<float> direction;
+
+		// Aimed roughly at the origin so about half of them hit the test objects.
+		std::vector<Ray<float>> rays(aCount);
+		for (Ray<float>& ray : rays)
+		{
+			const Vector3<float> origin(position(generator), position(generator), position(generator));
+			const Vector3<float> jitter(direction(generator), direction(generator), direction(generator));
+			ray = Ray<float>(origin, (jitter * 2.f - origin).GetNormalized() * 1.5f);
+		}
+		return rays;
+	}
+
+	// Runs a packet query and checks it against the single ray function, returns the hit count.
+	template<typename Packet, typename Single>
+	size_t CheckPacket(const std::vector<Ray<float>>& aRays, Packet&& aPacket, Single&& aSingle)
+	{
+		const RaySoA<float> packet(aRays.data(), aRays.size());
+		std::vector<float> distances(aRays.size(), std::numeric_limits<float>::max());
+		std::vector<uint64_t> hits(Ohm::Simd::MaskWordCount(aRays.size()), ~uint64_t(0));
+		aPacket(packet, distances.data(), hits.data());
+
+		size_t hitCount = 0;
+		for (size_t i = 0; i < aRays.size(); i++)
+		{
+			float distance = std::numeric_limits<float>::max();
+			const bool hit = aSingle(aRays[i], distance);
+			OHM_CHECK(Test::GetBit(hits, i) == hit);
+			OHM_CHECK_NEAR(distances[i], distance, 1e-4f * std::max(1.f, distance));
+			hitCount += hit ? 1 : 0;
+		}
+		OHM_CHECK((hits.back() >> (aRays.size() % 64)) == 0);
+		return hitCount;
+	}
+}
+
+OHM_TEST(Ray, Single)
+{
+	const AABB<float> box(Vector3<float>(-1.f), Vector3<float>(1.f));
+	const Sphere<float> sphere(Vector3<float>(0.f, 0.f, 5.f), 2.f);
+	const Plane<float> plane = Plane<float>::FromPointNormal(Vector3<float>(0.f, 3.f, 0.f), Vector3<float>(0.f, 1.f, 0.f));
+
+	float distance = -1.f;
+	OHM_CHECK(Ray<float>(Vector3<float>(-5.f, 0.f, 0.f), Vector3<float>(2.f, 0.f, 0.f)).Intersects(box, distance));
+	OHM_CHECK(distance == 2.f);
+	OHM_CHECK(Ray<float>(Vector3<float>(0.5f, 0.f, 0.f), Vector3<float>(0.f, 0.f, -1.f)).Intersects(box, distance));
+	OHM_CHECK(distance == 0.f);
+	OHM_CHECK(!Ray<float>(Vector3<float>(-5.f, 0.f, 0.f), Vector3<float>(-1.f, 0.f, 0.f)).Intersects(box, distance));
+	OHM_CHECK(!Ray<float>(Vector3<float>(-5.f, 2.f, 0.f), Vector3<float>(1.f, 0.f, 0.f)).Intersects(box, distance));
+	OHM_CHECK(distance == 0.f);
+
+	OHM_CHECK(Ray<float>(Vector3<float>(0.f), Vector3<float>(0.f, 0.f, 1.f)).Intersects(sphere, distance));
+	OHM_CHECK_NEAR(distance, 3.f, 1e-6f);
+	OHM_CHECK(Ray<float>(Vector3<float>(0.f, 0.f, 5.f), Vector3<float>(1.f, 0.f, 0.f)).Intersects(sphere, distance));
+	OHM_CHECK(distance == 0.f);
+	OHM_CHECK(!Ray<float>(Vector3<float>(0.f, 2.1f, 0.f), Vector3<float>(0.f, 0.f, 1.f)).Intersects(sphere, distance));
+	OHM_CHECK(!Ray<float>(Vector3<float>(0.f, 0.f, 8.f), Vector3<float>(0.f, 0.f, 1.f)).Intersects(sphere, distance));
+
+	OHM_CHECK(Ray<float>(Vector3<float>(1.f, 0.f, 1.f), Vector3<float>(0.f, 0.5f, 0.f)).Intersects(plane, distance));
+	OHM_CHECK(distance == 6.f);
+	OHM_CHECK(Ray<float>(Vector3<float>(1.f, 5.f, 1.f), Vector3<float>(0.f, -1.f, 0.f)).Intersects(plane, distance));
+	OHM_CHECK(distance == 2.f);
+	OHM_CHECK(!Ray<float>(Vector3<float>(1.f, 5.f, 1.f), Vector3<float>(0.f, 1.f, 0.f)).Intersects(plane, distance));
+	OHM_CHECK(!Ray<float>(Vector3<float>(1.f, 0.f, 1.f), Vector3<float>(1.f, 0.f, 0.f)).Intersects(plane, distance));
+	OHM_CHECK_NEAR(plane.SignedDistance(Vector3<float>(4.f, 1.f, 2.f)), -2.f, 1e-6f);
+
+	const Vector3<float> a(0.f, 0.f, 0.f);
+	const Vector3<float> b(2.f, 0.f, 0.f);
+	const Vector3<float> c(0.f, 2.f, 0.f);
+	OHM_CHECK(Ray<float>(Vector3<float>(0.5f, 0.5f, 4.f), Vector3<float>(0.f, 0.f, -2.f)).IntersectsTriangle(a, b, c, distance));
+	OHM_CHECK(distance == 2.f);
+	OHM_CHECK(Ray<float>(Vector3<float>(0.5f, 0.5f, -4.f), Vector3<float>(0.f, 0.f, 1.f)).IntersectsTriangle(a, b, c, distance));
+	OHM_CHECK(distance == 4.f);
+	OHM_CHECK(!Ray<float>(Vector3<float>(1.5f, 1.5f, 4.f), Vector3<float>(0.f, 0.f, -1.f)).IntersectsTriangle(a, b, c, distance));
+	OHM_CHECK(!Ray<float>(Vector3<float>(0.5f, 0.5f, 4.f), Vector3<float>(0.f, 0.f, 1.f)).IntersectsTriangle(a, b, c, distance));
+	OHM_CHECK(!Ray<float>(Vector3<float>(0.5f, 0.5f, 4.f), Vector3<float>(0.f, 0.f, -1.f)).IntersectsTriangle(a, b, b * 2.f, distance));
+
+	const Ray<double> ray(Vector3<double>(1.0, 2.0, 3.0), Vector3<double>(0.0, 0.0, 2.0));
+	OHM_CHECK(ray.GetPoint(1.5).z == 6.0);
+	const Plane<double> fromPoints = Plane<double>::FromPoints(Vector3<double>(0.0, 0.0, 1.0), Vector3<double>(1.0, 0.0, 1.0), Vector3<double>(0.0, 1.0, 1.0));
+	OHM_CHECK(fromPoints.normal.z == 1.0 && fromPoints.distance == -1.0);
+	OHM_CHECK(fromPoints.ClosestPoint(Vector3<double>(3.0, 4.0, 5.0)).z == 1.0);
+
+	OHM_CHECK(Sphere<double>(Vector3<double>(0.0), 1.0).Intersects(AABB<double>(Vector3<double>(0.5, 0.5, 0.5), Vector3<double>(2.0))));
+	OHM_CHECK(!Sphere<double>(Vector3<double>(0.0), 1.0).Intersects(AABB<double>(Vector3<double>(0.6, 0.6, 0.6), Vector3<double>(2.0))));
+	OHM_CHECK(Sphere<double>(Vector3<double>(0.0), 1.0).Intersects(Sphere<double>(Vector3<double>(3.0, 0.0, 0.0), 2.0)));
+	OHM_CHECK(!Sphere<double>(Vector3<double>(0.0), 1.0).Contains(Vector3<double>(0.0, 1.01, 0.0)));
+}
+
+OHM_TEST(Ray, Packets)
+{
+	const std::vector<Ray<float>> rays = RandomRays(Test::Count, 1);
+	const AABB<float> box(Vector3<float>(-2.f, -1.f, -3.f), Vector3<float>(1.f, 2.f, 1.5f));
+	const Sphere<float> sphere(Vector3<float>(0.5f, -0.5f, 0.f), 2.5f);
+	const Plane<float> plane = Plane<float>::FromPointNormal(Vector3<float>(0.f, 1.f, 0.f), Vector3<float>(0.3f, 0.9f, -0.2f).GetNormalized());
+	const Vector3<float> a(-3.f, -2.f, 0.f);
+	const Vector3<float> b(3.f, -1.f, 1.f);
+	const Vector3<float> c(0.f, 3.f, -1.f);
+
+	const size_t boxHits = CheckPacket(rays,
+		[&](const RaySoA<float>& aRays, float* aDistances, uint64_t* aHits) { IntersectRays(aRays, box, aDistances, aHits); },
+		[&](const Ray<float>& aRay, float& aDistance) { return aRay.Intersects(box, aDistance); });
+	const size_t sphereHits = CheckPacket(rays,
+		[&](const RaySoA<float>& aRays, float* aDistances, uint64_t* aHits) { IntersectRays(aRays, sphere, aDistances, aHits); },
+		[&](const Ray<float>& aRay, float& aDistance) { return aRay.Intersects(sphere, aDistance); });
+	const size_t planeHits = CheckPacket(rays,
+		[&](const RaySoA<float>& aRays, float* aDistances, uint64_t* aHits) { IntersectRays(aRays, plane, aDistances, aHits); },
+		[&](const Ray<float>& aRay, float& aDistance) { return aRay.Intersects(plane, aDistance); });
+	const size_t triangleHits = CheckPacket(rays,
+		[&](const RaySoA<float>& aRays, float* aDistances, uint64_t* aHits) { IntersectRaysTriangle(aRays, a, b, c, aDistances, aHits); },
+		[&](const Ray<float>& aRay, float& aDistance) { return aRay.IntersectsTriangle(a, b, c, aDistance); });
+
+	OHM_CHECK(boxHits > Test::Count / 8 && boxHits < Test::Count);
+	OHM_CHECK(sphereHits > Test::Count / 8 && sphereHits < Test::Count);
+	OHM_CHECK(planeHits > Test::Count / 8 && planeHits < Test::Count);
+	OHM_CHECK(triangleHits > Test::Count / 8 && triangleHits < Test::Count);
+}
+
+OHM_TEST(Ray, ClosestHit)
+{
+	// Two objects queried in turn leave the nearer hit of each ray, a limited range rejects further hits.
+	const std::vector<Ray<float>> rays = RandomRays(Test::Count, 2);
+	const RaySoA<float> packet(rays.data(), rays.size());
+	const Sphere<float> near(Vector3<float>(0.f), 1.f);
+	const AABB<float> far(Vector3<float>(-3.f), Vector3<float>(3.f));
+
+	std::vector<float> distances(Test::Count, 4.f);
+	std::vector<uint64_t> sphereHits(Ohm::Simd::MaskWordCount(Test::Count));
+	std::vector<uint64_t> boxHits(Ohm::Simd::MaskWordCount(Test::Count));
+	IntersectRays(packet, near, distances.data(), sphereHits.data());
+	IntersectRays(packet, far, distances.data(), boxHits.data());
+
+	for (size_t i = 0; i < Test::Count; i++)
+	{
+		float sphereDistance = 0.f;
+		float boxDistance = 0.f;
+		const bool sphereHit = rays[i].Intersects(near, sphereDistance) && sphereDistance <= 4.f;
+		const bool boxHit = rays[i].Intersects(far, boxDistance) && boxDistance <= (sphereHit ? sphereDistance : 4.f);
+
+		OHM_CHECK(Test::GetBit(sphereHits, i) == sphereHit);
+		OHM_CHECK(Test::GetBit(boxHits, i) == boxHit);
+		OHM_CHECK_NEAR(distances[i], boxHit ? boxDistance : sphereHit ? sphereDistance : 4.f, 1e-5f);
+	}
+}
@@ -0,0 +1,219 @@
+#include "Test.hpp"
+
+#include <Ohm/Animation/Skinning.hpp>
+#include <Ohm/Quaternion/DualQuaternion.hpp>
+#include <Ohm/Utility/ThreadPool.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr size_t BoneCount = 37;
+
+	template<typename T>
+	struct Mesh
+	{
+		std::vector<SkinInfluences<T>> influences;
+		Vector3SoA<T> positions;
+		Vector3SoA<T> normals;
+	};
+
+	template<typename T>
+	Quaternion<T> RandomRotation(std::mt19937& aGenerator)
+	{
+		std::uniform_real_distribution<T> unit(static_cast<T>(-1), static_cast<T>(1));
+		return Quaternion<T>(unit(aGenerator), unit(aGenerator), unit(aGenerator), unit(aGenerator)).GetNormalized();
+	}
+
+	template<typename T>
+	Vector3<T> RandomVector(std::mt19937& aGenerator, T aRange)
+	{
+		std::uniform_real_distribution<T> value(-aRange, aRange);
+		return Vector3<T>(value(aGenerator), value(aGenerator), value(aGenerator));
+	}
+
+	// One to four bones per vertex, the unused slots keep bone 0 and weight 0.
+	template<typename T>
+	Mesh<T> RandomMesh(unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_int_distribution<int> bone(0, BoneCount - 1);
+		std::uniform_int_distribution<int> boneCount(1, SkinInfluences<T>::Count);
+		std::uniform_real_distribution<T> weight(static_cast<T>(0.1), static_cast<T>(1));
+
+		Mesh<T> mesh;
+		mesh.influences.resize(Test::Count);
+		mesh.positions.Resize(Test::Count);
+		mesh.normals.Resize(Test::Count);
+		for (size_t i = 0; i < Test::Count; i++)
+		{
+			SkinInfluences<T>& influences = mesh.influences[i];
+			const int used = boneCount(generator);
+			T sum = 0;
+			for (int influence = 0; influence < used; influence++)
+			{
+				influences.bones[influence] = static_cast<uint16_t>(bone(generator));
+				influences.weights[influence] = weight(generator);
+				sum += influences.weights[influence];
+			}
+			for (int influence = 0; influence < used; influence++)
+			{
+				influences.weights[influence] /= sum;
+			}
+
+			mesh.positions.Set(i, RandomVector<T>(generator, static_cast<T>(2)));
+			mesh.normals.Set(i, RandomVector<T>(generator, static_cast<T>(1)).GetNormalized());
+		}
+		return mesh;
+	}
+
+	template<typename T>
+	bool SameStreams(const Vector3SoA<T>& aFirst, const Vector3SoA<T>& aSecond)
+	{
+		return std::memcmp(aFirst.X(), aSecond.X(), sizeof(T) * Test::Count) == 0 &&
+			std::memcmp(aFirst.Y(), aSecond.Y(), sizeof(T) * Test::Count) == 0 &&
+			std::memcmp(aFirst.Z(), aSecond.Z(), sizeof(T) * Test::Count) == 0;
+	}
+
+	template<typename T>
+	void TestLinearBlend(T aTolerance)
+	{
+		std::mt19937 generator(1);
+		std::uniform_real_distribution<T> scale(static_cast<T>(0.5), static_cast<T>(2));
+		std::vector<Matrix3x4<T>> palette(BoneCount);
+		std::vector<Matrix4x4<T>> palette4(BoneCount);
+		for (size_t bone = 0; bone < BoneCount; bone++)
+		{
+			palette[bone] = Matrix3x4<T>::CreateTransform(RandomVector<T>(generator, static_cast<T>(10)), RandomRotation<T>(generator), Vector3<T>(scale(generator)));
+			palette4[bone] = palette[bone].ToMatrix4x4();
+		}
+
+		const Mesh<T> mesh = RandomMesh<T>(2);
+		Vector3SoA<T> positions(Test::Count);
+		Vector3SoA<T> normals(Test::Count);
+		SkinLinearBlend(palette.data(), mesh.influences.data(), mesh.positions, &mesh.normals, positions, &normals);
+
+		for (size_t i = 0; i < Test::Count; i++)
+		{
+			// Element wise blend of the matrices, then one transform.
+			Matrix3x4<T> blended(Vector4<T>(static_cast<T>(0)), Vector4<T>(static_cast<T>(0)), Vector4<T>(static_cast<T>(0)));
+			for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+			{
+				const Matrix3x4<T>& matrix = palette[mesh.influences[i].bones[influence]];
+				for (int row = 1; row <= 3; row++)
+				{
+					blended(row) = blended(row) + matrix(row) * mesh.influences[i].weights[influence];
+				}
+			}
+
+			OHM_CHECK_NEAR_VECTOR(positions[i], blended.TransformPoint(mesh.positions[i]), aTolerance);
+			OHM_CHECK_NEAR_VECTOR(normals[i], blended.TransformDirection(mesh.normals[i]).GetNormalized(), aTolerance);
+		}
+
+		// Matrix4x4 palettes, positions only and threads all give the same results.
+		Vector3SoA<T> positions4(Test::Count);
+		Vector3SoA<T> normals4(Test::Count);
+		SkinLinearBlend(palette4.data(), BoneCount, mesh.influences.data(), mesh.positions, &mesh.normals, positions4, &normals4);
+		OHM_CHECK(SameStreams(positions, positions4) && SameStreams(normals, normals4));
+
+		// With a warm scratch arena the conversion does not touch the heap.
+		FrameArena scratch(BoneCount * sizeof(Matrix3x4<T>) + Ohm::Simd::Alignment);
+		const uint64_t allocations = Ohm::Memory::GetAllocationStats().allocationCount;
+		SkinLinearBlend(palette4.data(), BoneCount, mesh.influences.data(), mesh.positions, &mesh.normals, positions4, &normals4, nullptr, &scratch);
+		OHM_CHECK(Ohm::Memory::GetAllocationStats().allocationCount == allocations);
+		OHM_CHECK(SameStreams(positions, positions4) && SameStreams(normals, normals4));
+
+		Vector3SoA<T> positionsOnly(Test::Count);
+		SkinLinearBlend<T>(palette.data(), mesh.influences.data(), mesh.positions, nullptr, positionsOnly, nullptr);
+		OHM_CHECK(SameStreams(positions, positionsOnly));
+
+		ThreadPool pool(3);
+		Vector3SoA<T> threadedPositions(Test::Count);
+		Vector3SoA<T> threadedNormals(Test::Count);
+		SkinLinearBlend(palette.data(), mesh.influences.data(), mesh.positions, &mesh.normals, threadedPositions, &threadedNormals, &pool);
+		OHM_CHECK(SameStreams(positions, threadedPositions) && SameStreams(normals, threadedNormals));
+	}
+
+	template<typename T>
+	void TestDualQuaternion(T aTolerance)
+	{
+		std::mt19937 generator(3);
+		std::vector<DualQuaternion<T>> palette(BoneCount);
+		for (size_t bone = 0; bone < BoneCount; bone++)
+		{
+			// Random signs, the blend has to pick the shortest path on its own.
+			Quaternion<T> rotation = RandomRotation<T>(generator);
+			palette[bone] = DualQuaternion<T>(bone % 2 == 0 ? rotation : rotation * static_cast<T>(-1), RandomVector<T>(generator, static_cast<T>(10)));
+		}
+
+		const Mesh<T> mesh = RandomMesh<T>(4);
+		Vector3SoA<T> positions(Test::Count);
+		Vector3SoA<T> normals(Test::Count);
+		SkinDualQuaternion(palette.data(), mesh.influences.data(), mesh.positions, &mesh.normals, positions, &normals);
+
+		for (size_t i = 0; i < Test::Count; i++)
+		{
+			const SkinInfluences<T>& influences = mesh.influences[i];
+			const Quaternion<T>& pivot = palette[influences.bones[0]].real;
+			DualQuaternion<T> blended(Quaternion<T>(0, 0, 0, 0), Quaternion<T>(0, 0, 0, 0));
+			for (int influence = 0; influence < SkinInfluences<T>::Count; influence++)
+			{
+				const DualQuaternion<T>& bone = palette[influences.bones[influence]];
+				const T weight = pivot.Dot(bone.real) < 0 ? -influences.weights[influence] : influences.weights[influence];
+				blended.real += bone.real * weight;
+				blended.dual += bone.dual * weight;
+			}
+			blended.Normalize();
+
+			OHM_CHECK_NEAR_VECTOR(positions[i], blended.TransformPoint(mesh.positions[i]), aTolerance);
+			OHM_CHECK_NEAR_VECTOR(normals[i], blended.TransformDirection(mesh.normals[i]), aTolerance);
+		}
+
+		// A single bone moves the vertex exactly like the bone's own transform.
+		SkinInfluences<T> single;
+		single.bones[0] = 5;
+		single.weights[0] = 1;
+		const std::vector<SkinInfluences<T>> singles(Test::Count, single);
+		SkinDualQuaternion<T>(palette.data(), singles.data(), mesh.positions, nullptr, positions, nullptr);
+		for (size_t i = 0; i < Test::Count; i += 97)
+		{
+			OHM_CHECK_NEAR_VECTOR(positions[i], palette[5].ToMatrix3x4().TransformPoint(mesh.positions[i]), aTolerance * 10);
+		}
+	}
+}
+
+OHM_TEST(DualQuaternion, Basics)
+{
+	const Quaternion<double> rotationA = Quaternion<double>(0.3, -0.2, 0.8, 0.4).GetNormalized();
+	const Quaternion<double> rotationB = Quaternion<double>(-0.5, 0.1, 0.2, 0.9).GetNormalized();
+	const DualQuaternion<double> a(rotationA, Vector3<double>(1.0, 2.0, 3.0));
+	const DualQuaternion<double> b(rotationB, Vector3<double>(-4.0, 0.5, 2.0));
+	const Vector3<double> point(0.7, -1.3, 2.1);
+
+	OHM_CHECK_NEAR_VECTOR(a.GetTranslation(), Vector3<double>(1.0, 2.0, 3.0), 1e-12);
+	OHM_CHECK_NEAR_VECTOR(a.TransformPoint(point), Matrix3x4<double>::CreateTransform(Vector3<double>(1.0, 2.0, 3.0), rotationA).TransformPoint(point), 1e-12);
+
+	// a * b applies b first, the matrix product applies its left side first.
+	OHM_CHECK_NEAR_VECTOR((a * b).TransformPoint(point), (b.ToMatrix3x4() * a.ToMatrix3x4()).TransformPoint(point), 1e-12);
+
+	const DualQuaternion<double> roundTrip = DualQuaternion<double>::FromMatrix(a.ToMatrix3x4());
+	OHM_CHECK_NEAR_VECTOR(roundTrip.TransformPoint(point), a.TransformPoint(point), 1e-12);
+
+	const DualQuaternion<double> scaled(a.real * 3.0, a.dual * 3.0);
+	OHM_CHECK_NEAR_VECTOR(scaled.GetNormalized().TransformPoint(point), a.TransformPoint(point), 1e-12);
+	OHM_CHECK_NEAR_VECTOR(DualQuaternion<double>().TransformPoint(point), point, 0.0);
+}
+
+OHM_TEST(Skinning, LinearBlend)
+{
+	TestLinearBlend<float>(1e-4f);
+	TestLinearBlend<double>(1e-10);
+}
+
+OHM_TEST(Skinning, DualQuaternion)
+{
+	TestDualQuaternion<float>(1e-4f);
+	TestDualQuaternion<double>(1e-10);
+}
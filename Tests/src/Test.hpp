@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Ohm/Geometry/AABB.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// Minimal portable unit test runner.
+// Tests register themselves through OHM_TEST and are run by Main.cpp, a failed check is reported and the test continues.
+namespace Test
+{
+	using Function = void(*)();
+
+	struct Case
+	{
+		const char* mySuite;
+		const char* myName;
+		Function myFunction;
+	};
+
+	inline std::vector<Case>& GetCases()
+	{
+		static std::vector<Case> cases;
+		return cases;
+	}
+
+	inline size_t& GetFailureCount()
+	{
+		static size_t failures = 0;
+		return failures;
+	}
+
+	struct Registrar
+	{
+		Registrar(const char* aSuite, const char* aName, Function aFunction)
+		{
+			GetCases().push_back({ aSuite, aName, aFunction });
+		}
+	};
+
+	inline void ReportFailure(const char* aFile, int aLine, const char* aExpression)
+	{
+		std::printf("  %s(%d): check failed: %s\n", aFile, aLine, aExpression);
+		GetFailureCount()++;
+	}
+
+	template<typename T>
+	inline void CheckNear(const char* aFile, int aLine, const char* aExpression, T aActual, T aExpected, T aTolerance)
+	{
+		if (!(std::abs(aActual - aExpected) <= aTolerance))
+		{
+			std::printf("  %s(%d): check failed: %s (actual %.9g, expected %.9g, tolerance %.3g)\n", aFile, aLine, aExpression,
+				static_cast<double>(aActual), static_cast<double>(aExpected), static_cast<double>(aTolerance));
+			GetFailureCount()++;
+		}
+	}
+
+	template<typename T>
+	inline void CheckNearVector(const char* aFile, int aLine, const char* aExpression, const Vector3<T>& aActual, const Vector3<T>& aExpected, T aTolerance)
+	{
+		CheckNear<T>(aFile, aLine, aExpression, aActual.x, aExpected.x, aTolerance);
+		CheckNear<T>(aFile, aLine, aExpression, aActual.y, aExpected.y, aTolerance);
+		CheckNear<T>(aFile, aLine, aExpression, aActual.z, aExpected.z, aTolerance);
+	}
+
+	// Element count for batch kernel tests, odd so both the SIMD blocks and the scalar tail run.
+	constexpr size_t Count = 1003;
+
+	// Boxes with centers in [-50, 50] and half extents in [0.1, 3].
+	template<typename T>
+	std::vector<AABB<T>> RandomBoxes(size_t aCount, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_real_distribution<T> position(static_cast<T>(-50), static_cast<T>(50));
+		std::uniform_real_distribution<T> size(static_cast<T>(0.1), static_cast<T>(3));
+
+		std::vector<AABB<T>> boxes(aCount);
+		for (AABB<T>& box : boxes)
+		{
+			const Vector3<T> center(position(generator), position(generator), position(generator));
+			box = AABB<T>::FromCenterExtents(center, Vector3<T>(size(generator), size(generator), size(generator)));
+		}
+		return boxes;
+	}
+
+	// Bit aIndex of a visibility or hit mask written by the batch kernels.
+	inline bool GetBit(const std::vector<uint64_t>& aMask, size_t aIndex)
+	{
+		return ((aMask[aIndex / 64] >> (aIndex % 64)) & 1) != 0;
+	}
+}
+
+#define OHM_TEST(aSuite, aName) \
+	static void aSuite##_##aName(); \
+	static const Test::Registrar aSuite##_##aName##_Registrar(#aSuite, #aName, &aSuite##_##aName); \
+	static void aSuite##_##aName()
+
+#define OHM_CHECK(aExpression) \
+	do { if (!(aExpression)) { Test::ReportFailure(__FILE__, __LINE__, #aExpression); } } while (false)
+
+#define OHM_CHECK_NEAR(aActual, aExpected, aTolerance) \
+	Test::CheckNear<decltype((aActual) + (aExpected))>(__FILE__, __LINE__, #aActual " == " #aExpected, (aActual), (aExpected), (aTolerance))
+
+// Component wise OHM_CHECK_NEAR for Vector3.
+#define OHM_CHECK_NEAR_VECTOR(aActual, aExpected, aTolerance) \
+	Test::CheckNearVector(__FILE__, __LINE__, #aActual " == " #aExpected, (aActual), (aExpected), (aTolerance))
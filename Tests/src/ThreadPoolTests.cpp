@@ -0,0 +1,160 @@
+#include "Test.hpp"
+
+#include <Ohm/Utility/ThreadPool.hpp>
+#include <Ohm/Geometry/AABBBatch.hpp>
+#include <Ohm/Matrix/TransformBatch.hpp>
+#include <Ohm/Quaternion/QuaternionBatch.hpp>
+#include <Ohm/Vector/Vector3SoA.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <vector>
+
+OHM_TEST(ThreadPool, CoversEveryIndexOnce)
+{
+	for (size_t workers : { 0, 1, 3 })
+	{
+		ThreadPool pool(workers);
+		OHM_CHECK(pool.GetWorkerCount() == workers);
+		OHM_CHECK(pool.GetThreadCount() == workers + 1);
+
+		for (size_t count : { 0, 1, 63, 64, 65, 1000, 4099 })
+		{
+			for (size_t grain : { 1, 7, 64, 5000 })
+			{
+				std::vector<std::atomic<int>> visits(count);
+				std::atomic<bool> aligned{ true };
+				pool.ParallelFor(count, grain, [&](size_t aBegin, size_t aEnd)
+				{
+					if (aBegin % grain != 0 || (aEnd != count && aEnd - aBegin != grain))
+					{
+						aligned = false;
+					}
+					for (size_t i = aBegin; i < aEnd; ++i)
+					{
+						visits[i].fetch_add(1);
+					}
+				});
+
+				bool once = true;
+				for (const std::atomic<int>& visit : visits)
+				{
+					once = once && visit.load() == 1;
+				}
+				OHM_CHECK(once);
+				OHM_CHECK(aligned.load());
+			}
+		}
+	}
+}
+
+OHM_TEST(ThreadPool, Nested)
+{
+	ThreadPool pool(3);
+	constexpr size_t Outer = 37;
+	constexpr size_t Inner = 500;
+
+	std::vector<std::atomic<int>> visits(Outer * Inner);
+	pool.ParallelFor(Outer, 1, [&](size_t aBegin, size_t aEnd)
+	{
+		for (size_t outer = aBegin; outer < aEnd; ++outer)
+		{
+			pool.ParallelFor(Inner, 16, [&](size_t aInnerBegin, size_t aInnerEnd)
+			{
+				for (size_t inner = aInnerBegin; inner < aInnerEnd; ++inner)
+				{
+					visits[outer * Inner + inner].fetch_add(1);
+				}
+			});
+		}
+	});
+
+	bool once = true;
+	for (const std::atomic<int>& visit : visits)
+	{
+		once = once && visit.load() == 1;
+	}
+	OHM_CHECK(once);
+
+	// Without a pool the whole range is a single chunk.
+	size_t calls = 0;
+	Ohm::Detail::ParallelFor(nullptr, 1000, 64, [&](size_t aBegin, size_t aEnd) { calls++; OHM_CHECK(aBegin == 0 && aEnd == 1000); });
+	OHM_CHECK(calls == 1);
+}
+
+OHM_TEST(ThreadPool, GrainEndsOnCacheLines)
+{
+	OHM_CHECK(Ohm::Detail::ParallelGrain(0) % 64 == 0);
+	OHM_CHECK(Ohm::Detail::ParallelGrain(12) % 64 == 0);
+	OHM_CHECK(Ohm::Detail::ParallelGrain(100000) == 64);
+}
+
+OHM_TEST(ThreadPool, ThreadedKernelsMatchSerial)
+{
+	constexpr size_t Count = 100003;
+	ThreadPool pool(3);
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+
+	std::vector<Vector3<float>> points(Count);
+	for (Vector3<float>& point : points)
+	{
+		point = Vector3<float>(distribution(random), distribution(random), distribution(random));
+	}
+	const Matrix4x4<float> matrix = Matrix4x4<float>::CreateRotation(0.3f, -1.1f, 0.7f) * Matrix4x4<float>::CreateTranslation(Vector3<float>(1.f, -2.f, 3.f));
+
+	std::vector<Vector3<float>> serialPoints(Count);
+	std::vector<Vector3<float>> threadedPoints(Count);
+	TransformPoints(matrix, points.data(), serialPoints.data(), Count);
+	TransformPoints(matrix, points.data(), threadedPoints.data(), Count, &pool);
+	OHM_CHECK(std::memcmp(serialPoints.data(), threadedPoints.data(), Count * sizeof(Vector3<float>)) == 0);
+
+	const Vector3SoA<float> soa(points.data(), Count);
+	Vector3SoA<float> serialSoA;
+	Vector3SoA<float> threadedSoA;
+	Vector3SoA<float>::Normalize(soa, serialSoA);
+	Vector3SoA<float>::Normalize(soa, threadedSoA, &pool);
+	OHM_CHECK(std::memcmp(serialSoA.X(), threadedSoA.X(), Count * sizeof(float)) == 0);
+	OHM_CHECK(std::memcmp(serialSoA.Z(), threadedSoA.Z(), Count * sizeof(float)) == 0);
+
+	std::vector<AABB<float>> boxes(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		boxes[i] = AABB<float>(points[i], points[i] + Vector3<float>(1.f, 2.f, 3.f));
+	}
+	const AABBSoA<float> boxSoA(boxes.data(), Count);
+	AABBSoA<float> serialBoxes;
+	AABBSoA<float> threadedBoxes;
+	AABBSoA<float>::Transform(boxSoA, matrix, serialBoxes);
+	AABBSoA<float>::Transform(boxSoA, matrix, threadedBoxes, &pool);
+	OHM_CHECK(std::memcmp(serialBoxes.Min().Y(), threadedBoxes.Min().Y(), Count * sizeof(float)) == 0);
+	OHM_CHECK(std::memcmp(serialBoxes.Max().Z(), threadedBoxes.Max().Z(), Count * sizeof(float)) == 0);
+
+	std::vector<Quaternion<float>> from(Count);
+	std::vector<Quaternion<float>> to(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		from[i] = Quaternion<float>(distribution(random), distribution(random), distribution(random), distribution(random)).GetNormalized();
+		to[i] = Quaternion<float>(distribution(random), distribution(random), distribution(random), distribution(random)).GetNormalized();
+	}
+	std::vector<Quaternion<float>> serialBlend(Count);
+	std::vector<Quaternion<float>> threadedBlend(Count);
+	NlerpQuaternions(from.data(), to.data(), 0.3f, serialBlend.data(), Count);
+	NlerpQuaternions(from.data(), to.data(), 0.3f, threadedBlend.data(), Count, &pool);
+	OHM_CHECK(std::memcmp(serialBlend.data(), threadedBlend.data(), Count * sizeof(Quaternion<float>)) == 0);
+
+	std::vector<Quaternion<float>> scaled(Count);
+	for (size_t i = 0; i < Count; ++i)
+	{
+		scaled[i] = Quaternion<float>(from[i].x * 2.f, from[i].y * 2.f, from[i].z * 2.f, from[i].w * 2.f);
+	}
+	NormalizeQuaternions(scaled.data(), serialBlend.data(), Count);
+	NormalizeQuaternions(scaled.data(), threadedBlend.data(), Count, &pool);
+	OHM_CHECK(std::memcmp(serialBlend.data(), threadedBlend.data(), Count * sizeof(Quaternion<float>)) == 0);
+
+	SlerpQuaternions(from.data(), to.data(), 0.6f, serialBlend.data(), Count, QuaternionInterpolation::Approximate);
+	SlerpQuaternions(from.data(), to.data(), 0.6f, threadedBlend.data(), Count, QuaternionInterpolation::Approximate, &pool);
+	OHM_CHECK(std::memcmp(serialBlend.data(), threadedBlend.data(), Count * sizeof(Quaternion<float>)) == 0);
+}
@@ -0,0 +1,196 @@
+#include "Test.hpp"
+
+#include <Ohm/Matrix/TransformHierarchy.hpp>
+#include <Ohm/Utility/ThreadPool.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+	template<typename T>
+	struct Local
+	{
+		Vector3<T> translation;
+		Quaternion<T> rotation;
+		Vector3<T> scale;
+	};
+
+	template<typename T>
+	Local<T> RandomLocal(std::mt19937& aGenerator)
+	{
+		std::uniform_real_distribution<T> position(static_cast<T>(-5), static_cast<T>(5));
+		std::uniform_real_distribution<T> unit(static_cast<T>(-1), static_cast<T>(1));
+		std::uniform_real_distribution<T> scale(static_cast<T>(0.5), static_cast<T>(1.5));
+
+		Local<T> local;
+		local.translation = Vector3<T>(position(aGenerator), position(aGenerator), position(aGenerator));
+		local.rotation = Quaternion<T>(unit(aGenerator), unit(aGenerator), unit(aGenerator), unit(aGenerator)).GetNormalized();
+		local.scale = Vector3<T>(scale(aGenerator), scale(aGenerator), scale(aGenerator));
+		return local;
+	}
+
+	// Shallow random forest: about one node in twenty is a root, every other node hangs below one of the last few nodes.
+	template<typename T>
+	TransformHierarchy<T> RandomHierarchy(std::vector<Local<T>>& aOutLocals, unsigned aSeed)
+	{
+		std::mt19937 generator(aSeed);
+		std::uniform_int_distribution<uint32_t> back(1, 8);
+		std::uniform_int_distribution<int> rootChance(0, 19);
+
+		TransformHierarchy<T> hierarchy;
+		aOutLocals.clear();
+		for (uint32_t i = 0; i < Test::Count; i++)
+		{
+			const uint32_t parent = i == 0 || rootChance(generator) == 0 ? TransformHierarchy<T>::InvalidIndex : i - Ohm::Math::Min(back(generator), i);
+			aOutLocals.push_back(RandomLocal<T>(generator));
+			OHM_CHECK(hierarchy.Add(parent, aOutLocals[i].translation, aOutLocals[i].rotation, aOutLocals[i].scale) == i);
+		}
+		return hierarchy;
+	}
+
+	// Chained matrix products, the way world matrices were built before.
+	template<typename T>
+	std::vector<Matrix4x4<T>> ReferenceWorld(const TransformHierarchy<T>& aHierarchy, const std::vector<Local<T>>& aLocals)
+	{
+		std::vector<Matrix4x4<T>> world(aLocals.size());
+		for (uint32_t i = 0; i < aLocals.size(); i++)
+		{
+			Matrix4x4<T> local = aLocals[i].rotation.ToMatrix4x4();
+			local(1) = local(1) * aLocals[i].scale.x;
+			local(2) = local(2) * aLocals[i].scale.y;
+			local(3) = local(3) * aLocals[i].scale.z;
+			local(4) = Vector4<T>(aLocals[i].translation, static_cast<T>(1));
+
+			const uint32_t parent = aHierarchy.GetParent(i);
+			world[i] = parent == TransformHierarchy<T>::InvalidIndex ? local : local * world[parent];
+		}
+		return world;
+	}
+
+	template<typename T>
+	void CheckWorld(const TransformHierarchy<T>& aHierarchy, const std::vector<Local<T>>& aLocals, T aTolerance)
+	{
+		const std::vector<Matrix4x4<T>> reference = ReferenceWorld(aHierarchy, aLocals);
+		for (uint32_t i = 0; i < aLocals.size(); i++)
+		{
+			for (int row = 1; row <= 4; row++)
+			{
+				for (int column = 1; column <= 4; column++)
+				{
+					OHM_CHECK_NEAR(aHierarchy.GetWorldMatrix(i)(row, column), reference[i](row, column), aTolerance);
+				}
+			}
+		}
+	}
+
+	template<typename T>
+	void TestMatchesReference(T aTolerance)
+	{
+		std::vector<Local<T>> locals;
+		TransformHierarchy<T> hierarchy = RandomHierarchy<T>(locals, 1);
+		OHM_CHECK(hierarchy.IsDirty());
+		hierarchy.Update();
+		OHM_CHECK(!hierarchy.IsDirty());
+		CheckWorld(hierarchy, locals, aTolerance);
+	}
+}
+
+OHM_TEST(TransformHierarchy, Basics)
+{
+	TransformHierarchy<float> hierarchy;
+	const uint32_t root = hierarchy.Add(TransformHierarchy<float>::InvalidIndex, Vector3<float>(10.f, 0.f, 0.f), Quaternion<float>(), Vector3<float>(2.f));
+	const uint32_t child = hierarchy.Add(root, Vector3<float>(1.f, 0.f, 0.f));
+	// A quarter turn around z takes x to y.
+	const float half = std::sqrt(0.5f);
+	const uint32_t grandchild = hierarchy.Add(child, Vector3<float>(0.f), Quaternion<float>(0.f, 0.f, half, half));
+	hierarchy.Update();
+
+	const Vector4<float> origin(0.f, 0.f, 0.f, 1.f);
+	OHM_CHECK((origin * hierarchy.GetWorldMatrix(child)).x == 12.f);
+	const Vector4<float> point = Vector4<float>(1.f, 0.f, 0.f, 1.f) * hierarchy.GetWorldMatrix(grandchild);
+	OHM_CHECK_NEAR(point.x, 12.f, 1e-5f);
+	OHM_CHECK_NEAR(point.y, 2.f, 1e-5f);
+	OHM_CHECK(hierarchy.GetParent(grandchild) == child);
+	OHM_CHECK(hierarchy.GetTranslation(child).x == 1.f);
+	OHM_CHECK(hierarchy.GetRotation(grandchild).z == half);
+	OHM_CHECK(hierarchy.GetScale(root).y == 2.f);
+
+	hierarchy.SetScale(root, Vector3<float>(1.f));
+	hierarchy.Update();
+	OHM_CHECK((origin * hierarchy.GetWorldMatrix(child)).x == 11.f);
+
+	hierarchy.Clear();
+	OHM_CHECK(hierarchy.Size() == 0);
+	hierarchy.Update();
+}
+
+OHM_TEST(TransformHierarchy, MatchesReference)
+{
+	TestMatchesReference<float>(1e-3f);
+	TestMatchesReference<double>(1e-9);
+}
+
+OHM_TEST(TransformHierarchy, DirtySubtrees)
+{
+	std::vector<Local<float>> locals;
+	TransformHierarchy<float> hierarchy = RandomHierarchy<float>(locals, 2);
+	hierarchy.Update();
+	const std::vector<Matrix4x4<float>> before(hierarchy.GetWorldMatrices(), hierarchy.GetWorldMatrices() + Test::Count);
+
+	// Changing one node only touches it and its descendants, pick one from the middle that has children.
+	uint32_t changed = Test::Count / 2;
+	while (changed + 2 < Test::Count && hierarchy.GetParent(changed + 1) != changed)
+	{
+		changed++;
+	}
+	std::mt19937 generator(3);
+	locals[changed] = RandomLocal<float>(generator);
+	hierarchy.SetLocal(changed, locals[changed].translation, locals[changed].rotation, locals[changed].scale);
+	hierarchy.Update();
+	CheckWorld(hierarchy, locals, 1e-3f);
+
+	std::vector<bool> below(Test::Count, false);
+	below[changed] = true;
+	for (uint32_t i = changed + 1; i < Test::Count; i++)
+	{
+		below[i] = hierarchy.GetParent(i) != TransformHierarchy<float>::InvalidIndex && below[hierarchy.GetParent(i)];
+	}
+	size_t moved = 0;
+	for (uint32_t i = 0; i < Test::Count; i++)
+	{
+		const bool same = std::memcmp(&before[i], &hierarchy.GetWorldMatrix(i), sizeof(Matrix4x4<float>)) == 0;
+		OHM_CHECK(same != below[i]);
+		moved += below[i] ? 1 : 0;
+	}
+	OHM_CHECK(moved > 1 && moved < Test::Count / 2);
+
+	// Updating again without changes leaves everything as it is.
+	const std::vector<Matrix4x4<float>> after(hierarchy.GetWorldMatrices(), hierarchy.GetWorldMatrices() + Test::Count);
+	hierarchy.Update();
+	OHM_CHECK(std::memcmp(after.data(), hierarchy.GetWorldMatrices(), sizeof(Matrix4x4<float>) * Test::Count) == 0);
+}
+
+OHM_TEST(TransformHierarchy, Threads)
+{
+	std::vector<Local<float>> locals;
+	TransformHierarchy<float> serial = RandomHierarchy<float>(locals, 4);
+	TransformHierarchy<float> threaded = serial;
+	ThreadPool pool(3);
+	serial.Update();
+	threaded.Update(&pool);
+	OHM_CHECK(std::memcmp(serial.GetWorldMatrices(), threaded.GetWorldMatrices(), sizeof(Matrix4x4<float>) * Test::Count) == 0);
+
+	std::mt19937 generator(5);
+	for (const uint32_t node : { 3u, 400u, 1002u })
+	{
+		const Local<float> local = RandomLocal<float>(generator);
+		serial.SetLocal(node, local.translation, local.rotation, local.scale);
+		threaded.SetLocal(node, local.translation, local.rotation, local.scale);
+	}
+	ThreadPool smallerPool(1);
+	serial.Update();
+	threaded.Update(&smallerPool);
+	OHM_CHECK(std::memcmp(serial.GetWorldMatrices(), threaded.GetWorldMatrices(), sizeof(Matrix4x4<float>) * Test::Count) == 0);
+}
@@ -0,0 +1,160 @@
+#include "Test.hpp"
+
+#include <Ohm/Vector/Vector3.hpp>
+#include <Ohm/Vector/Vector4.hpp>
+#include <Ohm/Vector/Vector3SoA.hpp>
+#include <Ohm/Vector/Vector4SoA.hpp>
+#include <Ohm/Vector/VectorExpression.hpp>
+
+#include <vector>
+
+OHM_TEST(Vector3, DotAndCross)
+{
+	const Vector3<float> x(1.f, 0.f, 0.f);
+	const Vector3<float> y(0.f, 1.f, 0.f);
+	const Vector3<float> z = x.Cross(y);
+
+	OHM_CHECK_NEAR(z.x, 0.f, 0.f);
+	OHM_CHECK_NEAR(z.y, 0.f, 0.f);
+	OHM_CHECK_NEAR(z.z, 1.f, 0.f);
+	OHM_CHECK_NEAR(Vector3<float>(1.f, 2.f, 3.f).Dot(Vector3<float>(4.f, -5.f, 6.f)), 12.f, 0.f);
+}
+
+OHM_TEST(Vector3, Normalize)
+{
+	const Vector3<double> normalized = Vector3<double>(3.0, 0.0, 4.0).GetNormalized();
+
+	OHM_CHECK_NEAR(normalized.x, 0.6, 1e-12);
+	OHM_CHECK_NEAR(normalized.z, 0.8, 1e-12);
+	OHM_CHECK_NEAR(normalized.Length(), 1.0, 1e-12);
+}
+
+OHM_TEST(Vector4, FloatMatchesDouble)
+{
+	const Vector4<float> a(1.5f, -2.f, 3.25f, 4.f);
+	const Vector4<float> b(-0.5f, 6.f, 2.f, -1.f);
+	const Vector4<double> ad(1.5, -2.0, 3.25, 4.0);
+	const Vector4<double> bd(-0.5, 6.0, 2.0, -1.0);
+
+	const Vector4<float> sum = a + b;
+	const Vector4<float> product = a * 2.f;
+	const Vector4<float> normalized = a.GetNormalized();
+	const Vector4<double> normalizedDouble = ad.GetNormalized();
+
+	OHM_CHECK_NEAR(sum.y, 4.f, 0.f);
+	OHM_CHECK_NEAR(product.z, 6.5f, 0.f);
+	OHM_CHECK_NEAR(static_cast<double>(a.Dot(b)), ad.Dot(bd), 1e-5);
+	OHM_CHECK_NEAR(static_cast<double>(normalized.x), normalizedDouble.x, 1e-6);
+	OHM_CHECK_NEAR(static_cast<double>(normalized.w), normalizedDouble.w, 1e-6);
+}
+
+OHM_TEST(Vector3SoA, KernelsMatchScalar)
+{
+	// An odd count exercises both the SIMD body and the scalar tail.
+	constexpr size_t count = 37;
+
+	std::vector<Vector3<float>> a(count);
+	std::vector<Vector3<float>> b(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const float value = static_cast<float>(i);
+		a[i] = Vector3<float>(value + 1.f, value * 0.5f - 3.f, 2.f - value);
+		b[i] = Vector3<float>(0.25f * value, 1.f, value - 7.f);
+	}
+
+	const Vector3SoA<float> soaA(a.data(), count);
+	const Vector3SoA<float> soaB(b.data(), count);
+	Vector3SoA<float> cross;
+	Vector3SoA<float> normalized;
+	std::vector<float> dot(count);
+
+	Vector3SoA<float>::Cross(soaA, soaB, cross);
+	Vector3SoA<float>::Normalize(soaA, normalized);
+	Vector3SoA<float>::Dot(soaA, soaB, dot.data());
+
+	OHM_CHECK(cross.Size() == count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const Vector3<float> expectedCross = a[i].Cross(b[i]);
+		const Vector3<float> expectedNormalized = a[i].GetNormalized();
+
+		OHM_CHECK_NEAR(cross[i].x, expectedCross.x, 1e-4f);
+		OHM_CHECK_NEAR(cross[i].y, expectedCross.y, 1e-4f);
+		OHM_CHECK_NEAR(cross[i].z, expectedCross.z, 1e-4f);
+		OHM_CHECK_NEAR(normalized[i].x, expectedNormalized.x, 1e-6f);
+		OHM_CHECK_NEAR(normalized[i].y, expectedNormalized.y, 1e-6f);
+		OHM_CHECK_NEAR(normalized[i].z, expectedNormalized.z, 1e-6f);
+		OHM_CHECK_NEAR(dot[i], a[i].Dot(b[i]), 1e-4f);
+	}
+}
+
+OHM_TEST(Vector4SoA, MultiplyAddMatchesScalar)
+{
+	constexpr size_t count = 13;
+
+	std::vector<Vector4<double>> a(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		const double value = static_cast<double>(i);
+		a[i] = Vector4<double>(value, -value, value * 2.0, 1.0);
+	}
+
+	const Vector4SoA<double> soa(a.data(), count);
+	Vector4SoA<double> result;
+	Vector4SoA<double>::MultiplyAdd(soa, soa, soa, result);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		OHM_CHECK_NEAR(result[i].x, a[i].x * a[i].x + a[i].x, 0.0);
+		OHM_CHECK_NEAR(result[i].y, a[i].y * a[i].y + a[i].y, 0.0);
+		OHM_CHECK_NEAR(result[i].z, a[i].z * a[i].z + a[i].z, 0.0);
+		OHM_CHECK_NEAR(result[i].w, 2.0, 0.0);
+	}
+}
+
+OHM_TEST(VectorExpression, MatchesEagerOperators)
+{
+	const Vector3<float> a(1.5f, -2.f, 3.25f);
+	const Vector3<float> b(-0.5f, 6.f, 2.f);
+	const Vector3<float> c(4.f, 0.25f, -1.f);
+
+	// Fused results may differ from the eager ones by one rounding.
+	const Vector3<float> eager = a * 0.75f + b * -1.25f - c;
+	const Vector3<float> lazy = (Ohm::Lazy(a) * 0.75f + Ohm::Lazy(b) * -1.25f - c).Evaluate();
+	OHM_CHECK_NEAR(lazy.x, eager.x, 1e-5f);
+	OHM_CHECK_NEAR(lazy.y, eager.y, 1e-5f);
+	OHM_CHECK_NEAR(lazy.z, eager.z, 1e-5f);
+
+	const Vector3<float> divided = (c - Ohm::Lazy(a) * b / 2).Evaluate();
+	OHM_CHECK_NEAR(divided.y, 0.25f - (-2.f * 6.f) / 2.f, 1e-6f);
+
+	Vector3<float> accumulator = a;
+	accumulator += -Ohm::Lazy(b) * 2.f;
+	OHM_CHECK_NEAR(accumulator.z, 3.25f - 4.f, 1e-6f);
+
+	const Vector2<double> a2(1.0, 2.0);
+	const Vector2<double> lerped = (Ohm::Lazy(a2) * 0.25 + Vector2<double>(3.0, -1.0) * 0.75).Evaluate();
+	OHM_CHECK_NEAR(lerped.x, 2.5, 1e-12);
+	OHM_CHECK_NEAR(lerped.y, -0.25, 1e-12);
+}
+
+OHM_TEST(VectorExpression, Vector4MatchesEagerOperators)
+{
+	const Vector4<float> a(1.5f, -2.f, 3.25f, 4.f);
+	const Vector4<float> b(-0.5f, 6.f, 2.f, -1.f);
+	const Vector4<double> ad(1.5, -2.0, 3.25, 4.0);
+	const Vector4<double> bd(-0.5, 6.0, 2.0, -1.0);
+
+	const Vector4<float> lazy = (a - Ohm::Lazy(b) * a * 3.f + b).Evaluate();
+	const Vector4<double> lazyDouble = (ad - Ohm::Lazy(bd) * ad * 3.0 + bd).Evaluate();
+	const Vector4<double> eagerDouble = ad - bd * ad * 3.0 + bd;
+
+	OHM_CHECK_NEAR(static_cast<double>(lazy.x), eagerDouble.x, 1e-5);
+	OHM_CHECK_NEAR(static_cast<double>(lazy.y), eagerDouble.y, 1e-5);
+	OHM_CHECK_NEAR(static_cast<double>(lazy.z), eagerDouble.z, 1e-5);
+	OHM_CHECK_NEAR(static_cast<double>(lazy.w), eagerDouble.w, 1e-5);
+	OHM_CHECK_NEAR(lazyDouble.w, eagerDouble.w, 1e-12);
+
+	constexpr Vector3<float> baked = (Ohm::Lazy(Vector3<float>(1.f, 2.f, 3.f)) * 2.f + Vector3<float>(1.f, 1.f, 1.f)).Evaluate();
+	static_assert(baked.z == 7.f);
+}
@@ -8,13 +8,49 @@ workspace "Ohm"
 		"Release",
 		"Dist"
 	}
-	
+
+	-- Instruction set the SIMD paths are compiled for, see Ohm/Utility/Simd.hpp.
+	platforms
+	{
+		"SSE2",
+		"SSE41",
+		"AVX2",
+		"AVX512",
+		"Scalar"
+	}
+
+	defaultplatform "SSE2"
+
 	flags
 	{
 		"MultiProcessorCompile"
 	}
-	
-outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
+
+	filter "platforms:Scalar"
+		defines { "OHM_NO_SIMD" }
+
+	filter "platforms:SSE41"
+		vectorextensions "SSE4.1"
+
+	filter "platforms:AVX2"
+		vectorextensions "AVX2"
+
+	filter { "platforms:AVX2", "system:linux" }
+		buildoptions { "-mfma" }
+
+	filter { "platforms:AVX512", "system:windows" }
+		buildoptions { "/arch:AVX512" }
+
+	filter { "platforms:AVX512", "system:linux" }
+		buildoptions { "-mavx512f", "-mavx512vl", "-mavx2", "-mfma" }
+
+	filter "system:linux"
+		pic "On"
+
+	filter {}
+
+outputdir = "%{cfg.buildcfg}-%{cfg.platform}-%{cfg.system}-%{cfg.architecture}"
 
 include "Ohm"
-include "Tests"
\ No newline at end of file
+include "Tests"
+include "Benchmarks"
@@ -0,0 +1,12 @@
+#!/bin/sh
+# Generates GNU makefiles, pass --cc=clang to build with Clang instead of GCC.
+# Build with e.g. "make config=release_avx2" and run bin/Release-AVX2-linux-x86_64/Tests/Tests.
+
+cd "$(dirname "$0")/.."
+
+PREMAKE=vendor/bin/premake/premake5
+if [ ! -x "$PREMAKE" ]; then
+	PREMAKE=premake5
+fi
+
+"$PREMAKE" gmake2 "$@"